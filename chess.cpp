@@ -1,9 +1,60 @@
+#ifndef CHESS_HEADLESS
 #define UNICODE           // Use Unicode (for special chess symbols ♔♕)
 #define _UNICODE          // Same as above
 #define WIN32_LEAN_AND_MEAN // Speeds up compilation by excluding rare Windows APIs
 #include <windows.h>      // Core Windows functions (CreateWindow, messages, etc.)
 #include <windowsx.h>     // Extra Windows macros (GET_X_LPARAM, etc.)
 #include <tchar.h>        // Handles Unicode/ANSI text
+#include <mutex>          // Analysis panel worker thread
+#include <condition_variable>
+#else
+// Headless build (-DCHESS_HEADLESS): engine + command-line search driver, no window.
+// Used for profiling and benchmarking on Linux, see profile_chess.sh
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <condition_variable> // Multi-game server
+#include <deque>
+#include <map>
+#include <memory>
+#include <csignal>
+#include <poll.h>
+#include <pthread.h>          // NUMA thread pinning
+#include <sched.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <algorithm>          // PGN index: sorted runs and their merge
+struct POINT { long x, y; };
+#include "game_search.h" // Shared alpha-beta searcher, used by the "gbench" command
+#endif
+#include <atomic>           // Pondering: stop and done flags shared with the ponder thread
+#include <thread>
+#include <chrono>           // Timing for the search statistics, the time manager and the bench driver
+#include <cstdint>          // NNUE weights and accumulators
+#include <cstdio>           // JSON dump of the search statistics, NNUE weights file
+#include <memory>           // Evaluation weights loaded for an engine config
+#include <vector>
+#ifdef CHESS_HEADLESS
+#include <fcntl.h>          // Memory-mapped analysis cache (the GUI uses the Win32 file mapping)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define NNUE_X86
+#include <immintrin.h>      // SSE4.1/AVX2 NNUE kernels, picked at runtime
+#ifdef _MSC_VER
+#include <intrin.h>         // __cpuid
+#endif
+#endif
+#ifdef CHESS_MICROBENCH
+#include <benchmark/benchmark.h> // Google Benchmark, headless micro-benchmark build only
+#endif
 
 using namespace std;
 
@@ -39,10 +90,107 @@ enum GameMode { MODE_PVP, MODE_PVAI };
 enum GamePhase { OPENING, MIDGAME, ENDGAME };
 GameMode currentGameMode = MODE_PVP; // Default to Player vs Player
 bool aiThinking = false;
+thread_local unsigned long long searchNodes = 0; // Minimax + quiescence nodes, used by the bench driver
 const int AI_TIMER_ID = 1;
 
+// Evaluation weights: EvaluatePosition() is the dot product of a weight vector and the
+// position's term counts from EvaluationTerms(), so the weights can be tuned (see "tune")
+enum EvalParam {
+    EVAL_ROOK, EVAL_KNIGHT, EVAL_BISHOP, EVAL_QUEEN, EVAL_KING, EVAL_PAWN, // Material, index abs(piece) - 1
+    EVAL_MOBILITY,          // Per pseudo-legal move of the side to move
+    EVAL_PAWN_SHIELD,       // Per own pawn next to the king
+    EVAL_KING_EXPOSED,      // Penalty per shield pawn short of three
+    EVAL_ISOLATED_PAWN,     // Penalty per isolated pawn of the side to move
+    EVAL_PASSED_PAWN,       // Per rank a passed pawn of the side to move has advanced
+    EVAL_KID_FIANCHETTO,    // King's Indian: castled king behind the fianchetto
+    EVAL_KID_CENTER,        // King's Indian: black attacks two or more centre squares
+    EVAL_KID_STORM,         // King's Indian: per rank of the f/g pawn storm
+    EVAL_CENTER_CONTROL,    // Opening: per attacked centre square
+    EVAL_KING_CENTER,       // Endgame: per step of the king towards the centre
+    EVAL_PARAM_COUNT
+};
+const char* const evalParamNames[EVAL_PARAM_COUNT] = {
+    "rook", "knight", "bishop", "queen", "king", "pawn", "mobility", "pawn_shield", "king_exposed",
+    "isolated_pawn", "passed_pawn", "kid_fianchetto", "kid_center", "kid_storm",
+    "center_control", "king_center",
+};
+const int defaultEvalWeights[EVAL_PARAM_COUNT] = {
+    500, 300, 300, 900, 20000, 100, 2, 20, 30, 20, 15, 50, 30, 10, 10, 5,
+};
+
+// Forward pruning near the leaves of MinimaxT(), each switchable on its own (EngineConfig::pruning)
+enum PruneTechnique {
+    PRUNE_REVERSE_FUTILITY = 1,  // Static null move: eval far above beta, the node fails high
+    PRUNE_RAZORING = 2,          // Eval far below alpha: the quiescence search decides
+    PRUNE_FUTILITY = 4,          // Eval far below alpha: quiet moves are skipped
+    PRUNE_LATE_MOVES = 8,        // Quiet moves late in the history order are skipped
+    PRUNE_PROBCUT = 16,          // A capture that beats beta + margin at reduced depth cuts the node
+    PRUNE_ALL = 31,
+    // Late-move pruning stays opt-in: even in history order it did not gain at the shallow
+    // fixed depths the engine plays at
+    PRUNE_DEFAULT = PRUNE_REVERSE_FUTILITY | PRUNE_RAZORING | PRUNE_FUTILITY | PRUNE_PROBCUT
+};
+const char* const pruneNames[] = {"rfp", "razor", "futility", "lmp", "probcut"};
+const int PRUNE_MAX_DEPTH = 3;              // Static-eval pruning only this close to the leaves
+const int PRUNE_MATE_BOUND = 90000;         // Windows reaching past this hold mate scores
+const int REVERSE_FUTILITY_MARGIN = 120;    // Per ply of depth
+const int razorMargins[3] = {0, 300, 500};
+const int futilityMargins[3] = {0, 200, 350};
+const int lateMoveCounts[PRUNE_MAX_DEPTH + 1] = {0, 16, 24, 36}; // Moves searched before the rest are skipped
+const int PROBCUT_MIN_DEPTH = 3;
+const int PROBCUT_MARGIN = 200;
+const int PROBCUT_REDUCTION = 2;
+
+// Search settings, per thread so self-play can pit two configurations against each other
+struct EngineConfig {
+    int depth;               // Search depth used for the AI's moves
+    bool openingHeuristics;  // FindBestMove's castling/knight/KID shortcuts in the opening
+
+    bool nnue;               // Leaves scored by NnueEvaluate() instead of EvaluatePosition()
+    const int* evalWeights;  // EVAL_PARAM_COUNT weights used by EvaluatePosition()
+    std::shared_ptr<const std::vector<int>> loadedWeights; // Storage of evalWeights when read from a file
+    int pruning;             // PruneTechnique bits
+    int timeMs;              // Game clock for self-play, 0 to search to 'depth' instead
+    int incrementMs;         // ... added after each move
+    int movesToGo;           // ... moves per time control, 0 for the whole game
+
+    EngineConfig() : depth(3), openingHeuristics(true), nnue(false), evalWeights(defaultEvalWeights),
+                     pruning(PRUNE_DEFAULT), timeMs(0), incrementMs(0), movesToGo(0) {}
+};
+thread_local EngineConfig engineConfig;
+
+// Clock of the side to move for a timed search, see AllocateTime()
+struct TimeControl {
+    long long remainingMs;
+    long long incrementMs;   // Added after the move
+    int movesToGo;           // Moves until the clock is topped up, 0 for sudden death
+};
+const int TIME_DEFAULT_MOVES_TO_GO = 30;   // Moves the remaining time is spread over in sudden death
+const int TIME_MOVE_OVERHEAD_MS = 20;      // Kept back per move for what happens outside the search
+const int TIME_HARD_FACTOR = 4;            // Hard limit as a multiple of the soft one
+const int TIME_MAX_DEPTH = 32;             // Iterations of a timed search
+const int TIME_DOMINANT_PERCENT = 90;      // Share of the root nodes that makes the best move obvious
+const int TIME_GROWTH_MARGIN = 2;          // Headroom over the estimated length of the next iteration
+
+// The opponent's reply expected by the last SearchBestMove() on this thread (the best
+// move of the node below the chosen root move), pondered on in MODE_PVAI
+thread_local ChessMove predictedReply;
+thread_local bool hasPredictedReply = false;
+thread_local int replyDepth = -1;             // Depth of the nodes below the root during SearchBestMove()
+thread_local ChessMove childBestMove;         // Best move of the last node searched at replyDepth
+thread_local bool childHasMove = false;
+thread_local const std::atomic<bool>* searchStop = NULL; // Set on the ponder thread, MinimaxT() bails out when raised
+thread_local const TimeControl* searchClock = NULL; // Set while FindBestMove() should search by time, see SearchTimed()
+thread_local long long searchDeadlineUs = 0;  // Hard limit of SearchTimed() in SteadyMicros(), 0 for none
+thread_local bool searchTimedOut = false;     // ... reached: MinimaxT() bails out, the iteration is thrown away
+thread_local int timeCheckCountdown = 0;      // MinimaxT() calls until the clock is read again
+thread_local int quietHistory[2][64][64];     // Beta cutoffs of quiet moves by side, from and to square, depth^2 weighted
+
 // Initilaize Pieces
-int board[8][8] = {
+// The position (board, side to move, king squares, castling and en passant state) is
+// thread_local: the GUI only ever uses the main thread's copy, while the headless tools
+// run one independent game per thread.
+thread_local int board[8][8] = {
     {BLACK_ROOK, BLACK_KNIGHT, BLACK_BISHOP, BLACK_QUEEN, BLACK_KING, BLACK_BISHOP, BLACK_KNIGHT, BLACK_ROOK},
     {BLACK_PAWN, BLACK_PAWN, BLACK_PAWN, BLACK_PAWN, BLACK_PAWN, BLACK_PAWN, BLACK_PAWN, BLACK_PAWN},
     {EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY},
@@ -53,11 +201,13 @@ int board[8][8] = {
     {WHITE_ROOK, WHITE_KNIGHT, WHITE_BISHOP, WHITE_QUEEN, WHITE_KING, WHITE_BISHOP, WHITE_KNIGHT, WHITE_ROOK}
 };
 
+#ifndef CHESS_HEADLESS
 static bool isPromoting = false; // Global variables for promotion UI
 static POINT promotionPos;
 static RECT promotionRects[4];  // Stores positions of 4 promotion pieces
 static HWND promotionHwnd;  
-int currentPlayer = 1; // Switch turns
+#endif
+thread_local int currentPlayer = 1; // Switch turns
 POINT possibleMoves[64]; // Show all possible moves for the board
 int possibleMoveCount = 0; // Calculate possible moves 
 bool showMoves = false; // Decide the higlight show or not 
@@ -67,33 +217,287 @@ int boardStartY = 55;
 bool gameOver = false; // Check if the game is end
 const float REGULAR_PIECE_SCALE = 0.85f;
 const float PAWN_SCALE = 0.65f;
-POINT whiteKingPos = {4, 7}; 
-POINT blackKingPos = {4, 0};
-bool whiteKingMoved = false;
-bool blackKingMoved = false;
-bool whiteRookKingMoved = false;
-bool whiteRookQueenMoved = false;
-bool blackRookKingMoved = false;
-bool blackRookQueenMoved = false;
-POINT enPassantTarget = {-1, -1};
+thread_local POINT whiteKingPos = {4, 7}; 
+thread_local POINT blackKingPos = {4, 0};
+thread_local bool whiteKingMoved = false;
+thread_local bool blackKingMoved = false;
+thread_local bool whiteRookKingMoved = false;
+thread_local bool whiteRookQueenMoved = false;
+thread_local bool blackRookKingMoved = false;
+thread_local bool blackRookQueenMoved = false;
+thread_local POINT enPassantTarget = {-1, -1};
+
+// Zobrist keys: a piece (index piece + 6) on a square (y * 8 + x), black to move, the
+// castling rights (bit 0 white O-O, 1 white O-O-O, 2 black O-O, 3 black O-O-O), the
+// en passant file
+struct ZobristKeys {
+    unsigned long long piece[13][64];
+    unsigned long long blackToMove;
+    unsigned long long castling[16];
+    unsigned long long enPassant[8];
+};
+
+constexpr ZobristKeys BuildZobristKeys() {
+    ZobristKeys keys = {};
+    unsigned long long state = 0x9E3779B97F4A7C15ULL;
+    unsigned long long* all[13 * 64 + 1 + 16 + 8] = {};
+    int count = 0;
+    for (int p = 0; p < 13; p++) for (int sq = 0; sq < 64; sq++) all[count++] = &keys.piece[p][sq];
+    all[count++] = &keys.blackToMove;
+    for (int i = 0; i < 16; i++) all[count++] = &keys.castling[i];
+    for (int i = 0; i < 8; i++) all[count++] = &keys.enPassant[i];
+    for (int i = 0; i < count; i++) {
+        // splitmix64
+        state += 0x9E3779B97F4A7C15ULL;
+        unsigned long long z = state;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        *all[i] = z ^ (z >> 31);
+    }
+    return keys;
+}
+constexpr ZobristKeys zobrist = BuildZobristKeys();
+
+// Game and search history for the draw rules. positionHash is kept up to date by
+// MakeMove()/UnmakeMove(); hashHistory holds the hash of every position since the game
+// started, the current one on top.
+const int HASH_HISTORY_SIZE = 1024;
+const int HASH_HISTORY_KEEP = 256;     // Entries kept when a long game fills the stack, > 100 plies
+thread_local unsigned long long positionHash = 0;
+thread_local int halfmoveClock = 0;    // Plies since the last capture or pawn move
+thread_local unsigned long long hashHistory[HASH_HISTORY_SIZE];
+thread_local int historyCount = 0;
+
+// Everything MakeMove() changes besides the board, so UnmakeMove() can put it back
+struct MoveUndo {
+    unsigned long long hash;
+    int halfmoveClock;
+    int movedPiece;
+    int captured;              // Piece taken, EMPTY if none (the pawn for en passant)
+    int capturedX, capturedY;  // Where the taken piece stood
+    POINT enPassantTarget;
+    POINT whiteKingPos, blackKingPos;
+    bool whiteKingMoved, blackKingMoved;
+    bool whiteRookKingMoved, whiteRookQueenMoved;
+    bool blackRookKingMoved, blackRookQueenMoved;
+    int nnueTop;               // NNUE accumulator of the position before the move
+};
+
+// NNUE evaluation: 768 piece-square features (own/their piece type on a square, seen from
+// each side) feed a HIDDEN-wide int16 accumulator per perspective plus a PSQT sum that
+// bypasses the network. The two accumulators, side to move first, clipped to 0..127 go
+// through int8 dense layers 2*HIDDEN -> L1 -> L2 -> 1.
+const int NNUE_FEATURES = 768;
+const int NNUE_HIDDEN = 128;
+const int NNUE_L1 = 32;
+const int NNUE_L2 = 32;
+const int NNUE_WEIGHT_SHIFT = 6;     // Dense layer weights are scaled by 64
+const int NNUE_OUTPUT_SCALE = 16;    // Network output units per centipawn
+const int NNUE_STACK_SIZE = 128;
+
+struct NnueNetwork {
+    alignas(32) int16_t ftBias[NNUE_HIDDEN];
+    alignas(32) int16_t ftWeights[NNUE_FEATURES * NNUE_HIDDEN];
+    int32_t ftPsqt[NNUE_FEATURES];
+    int32_t l1Bias[NNUE_L1];
+    alignas(32) int8_t l1Weights[NNUE_L1 * 2 * NNUE_HIDDEN];
+    int32_t l2Bias[NNUE_L2];
+    alignas(32) int8_t l2Weights[NNUE_L2 * NNUE_L1];
+    int32_t outBias;
+    alignas(32) int8_t outWeights[NNUE_L2];
+};
+
+// Accumulators of one position, [0] from white's side, [1] from black's. MakeMove() derives
+// a child from its parent on nnueStack; 'key' says which position an entry belongs to, so
+// anything else (GUI moves, FEN, a wrapped stack) just leads to a refresh.
+struct NnueAccumulator {
+    alignas(32) int16_t values[2][NNUE_HIDDEN];
+    int32_t psqt[2];
+    unsigned long long key;
+    bool valid;
+};
+
+// Kernel set, chosen once at startup from what the CPU supports
+struct NnueKernels {
+    const char* name;
+    // acc = parent + sum of the added feature rows - sum of the removed ones
+    void (*update)(int16_t* acc, const int16_t* parent, const int* added, int addCount,
+                   const int* removed, int removeCount);
+    // output[o] = bias[o] + dot(input, weights row o); inputs a multiple of 32
+    void (*affine)(const uint8_t* input, int inputs, const int8_t* weights, const int32_t* bias,
+                   int32_t* output, int outputs);
+};
+
+NnueNetwork nnueNet;                   // Read-only once loaded, shared by all threads
+unsigned long long nnueNetHash = 0;    // NnueNetworkHash() of nnueNet
+NnueKernels nnueKernels;
+thread_local NnueAccumulator nnueStack[NNUE_STACK_SIZE];
+thread_local int nnueTop = 0;
+
+// Copy of a thread's whole position, so another thread can take it over
+struct PositionSnapshot {
+    int board[8][8];
+    int currentPlayer;
+    POINT whiteKingPos, blackKingPos;
+    bool whiteKingMoved, blackKingMoved;
+    bool whiteRookKingMoved, whiteRookQueenMoved;
+    bool blackRookKingMoved, blackRookQueenMoved;
+    POINT enPassantTarget;
+    unsigned long long positionHash;
+    int halfmoveClock;
+    int historyCount;
+    unsigned long long hashHistory[HASH_HISTORY_SIZE];
+};
+
+// Pondering, owned by the GUI thread: while the human thinks, ponderThread searches the
+// position after predictedReply with the AI's settings
+std::thread ponderThread;
+std::atomic<bool> ponderStop(false);
+std::atomic<bool> ponderDone(false);
+unsigned long long ponderHash = 0;      // Position being pondered (after the predicted move)
+ChessMove ponderMove;                   // AI move found there, valid once ponderDone
+ChessMove ponderReply;                  // ... and the reply that search predicts in turn
+bool ponderHasReply = false;
+PositionSnapshot ponderPosition;
+unsigned long long ponderHits = 0, ponderMisses = 0;
+
+// Persistent analysis cache: results of fixed-depth root searches (SearchBestMove(); the
+// timed and MultiPV searches do not use it) in a file-backed hash table, mapped into
+// memory and shared by all threads (and processes) using the file. Buckets of four 16-byte
+// entries fill one cache line.
+const char ANALYSIS_CACHE_MAGIC[8] = {'C', 'H', 'E', 'S', 'S', 'A', 'C', '2'};
+const int ANALYSIS_CACHE_BUCKET_SIZE = 4;
+const int ANALYSIS_CACHE_DEFAULT_MB = 64;
+const int ANALYSIS_CACHE_MAX_MB = 1 << 16;
+
+struct AnalysisCacheHeader {
+    char magic[8];
+    unsigned long long bucketCount;   // Power of two
+    unsigned long long generation;    // Sessions that opened the file
+    char padding[40];                 // Buckets start on a cache line
+};
+
+struct AnalysisCacheEntry {
+    std::atomic<unsigned long long> check;  // key ^ data
+    std::atomic<unsigned long long> data;   // 0 when empty
+};
+
+struct AnalysisCacheBucket {
+    AnalysisCacheEntry entries[ANALYSIS_CACHE_BUCKET_SIZE];
+};
+
+struct AnalysisCache {
+    AnalysisCacheHeader* header;      // NULL while no cache is open
+    AnalysisCacheBucket* buckets;
+    unsigned long long bucketCount;
+    size_t bytes;                     // Mapped size, header included
+    int generation;                   // This session, low 6 bits
+#ifndef CHESS_HEADLESS
+    HANDLE file, mapping;
+#else
+    int file;
+#endif
+};
+AnalysisCache analysisCache = {};
+std::atomic<unsigned long long> analysisCacheHits(0), analysisCacheMisses(0), analysisCacheStores(0);
+
+// Large search tables, see AllocateLargeTable()
+enum LargePageKind { LARGE_PAGES_NONE, LARGE_PAGES_TRANSPARENT, LARGE_PAGES_EXPLICIT };
+const char* largePageNames[] = {"normal pages", "transparent huge pages", "explicit huge pages"};
+const size_t LARGE_PAGE_SIZE = (size_t)2 << 20;
+
+struct LargeTable {
+    void* memory;
+    size_t bytes;                     // A multiple of the page size
+    int pages;                        // LargePageKind
+};
+bool useLargePages = true;            // Search tables try huge pages first, "--large-pages 0" turns it off
+
+// MultiPV analysis, see SearchMultiPV()
+const int MULTIPV_MAX_LINES = 16;
+const int MULTIPV_MAX_PLY = 32;
+const int MULTIPV_TT_BITS = 18;       // 4 MB table of an analysing thread's own
+
+struct MultiPvLine {
+    ChessMove pv[MULTIPV_MAX_PLY];    // pv[0] is the root move
+    int length;
+    int score;                        // Exact, white-relative
+    int depth;
+};
+
+enum PvBound { PV_BOUND_NONE, PV_BOUND_EXACT, PV_BOUND_LOWER, PV_BOUND_UPPER };
+
+// Lockless like the analysis cache, so threads can share a table: check is the key ^ data
+// and a torn entry reads as empty. Data: score (32 bits, white-relative), PackMove() (16),
+// depth (8), PvBound (8).
+struct PvTTEntry {
+    std::atomic<unsigned long long> check;
+    std::atomic<unsigned long long> data;
+};
+
+thread_local PvTTEntry* pvTable = NULL;
+thread_local size_t pvTableMask = 0;
+thread_local bool pvTableShared = false;                           // A server partition, see UsePvTablePartition()
+thread_local unsigned long long pvTableEvaluator = 0;              // EvaluatorKey() an own table was filled with
+thread_local ChessMove pvLines[MULTIPV_MAX_PLY][MULTIPV_MAX_PLY];  // Triangular PV table, line of ply p in pvLines[p][p..]
+thread_local int pvLengths[MULTIPV_MAX_PLY];                        // End of pvLines[p]
+#ifndef CHESS_HEADLESS
+const int ANALYSIS_LINES = 3;         // Shown in the GUI's analysis panel
+const int analysisPanelWidth = 320;
+bool analysisMode = false;
+unsigned long long analysisRequestHash = 0; // Last position handed to the worker (GUI thread only)
+// Analysis worker, see RequestAnalysis(): a thread of its own, keeping its MultiPV table,
+// searches each new position and WM_PAINT only draws the lines it left behind
+std::thread analysisThread;
+std::mutex analysisMutex;             // Guards everything below
+std::condition_variable analysisWake;
+PositionSnapshot analysisPosition;    // Next position to search ...
+EngineConfig analysisConfig;          // ... with these settings
+bool analysisPending = false;
+bool analysisQuit = false;
+std::atomic<bool> analysisStop(false); // Raised to abandon the running search
+HWND analysisWindow = NULL;           // Repainted when new lines are in
+MultiPvLine analysisLines[ANALYSIS_LINES];
+int analysisLineCount = 0;
+unsigned long long analysisHash = 0;  // Position the lines belong to
+#endif
 
 // AI's functions
+void MakeMove(const ChessMove& move, MoveUndo& undo);
+void UnmakeMove(const ChessMove& move, const MoveUndo& undo);
 void SortMoves(ChessMove moves[], int moveCount); 
 ChessMove FindBestMove(int depth); 
+ChessMove SearchBestMove(int depth);
+ChessMove SearchTimed(const TimeControl& clock, int maxDepth, int& completedDepth);
+void AllocateTime(const TimeControl& clock, long long& softMs, long long& hardMs);
+long long SteadyMicros();
 int Minimax(int depth, int alpha, int beta, bool maximizingPlayer);
 GamePhase DetectGamePhase();
 void GenerateLegalMoves(int player, ChessMove moves[], int &moveCount);
 int EvaluatePosition(); 
+void EvaluationTerms(int terms[EVAL_PARAM_COUNT]);
+bool LoadEvalWeights(const char* path, int weights[EVAL_PARAM_COUNT]);
+bool SaveEvalWeights(const char* path, const int weights[EVAL_PARAM_COUNT]);
 int CountBishopMoves(int x, int y);
 bool IsFileOpen(int x);
-int EvaluateKingIndianDefense(int player);
+void AddKingIndianTerms(int player, int sign, int terms[EVAL_PARAM_COUNT]);
 int CalculateMobility(int player);
-int CalculateKingSafety(int player);
+void AddKingSafetyTerms(int player, int sign, int terms[EVAL_PARAM_COUNT]);
 int QuiescenceSearch(int alpha, int beta, int player);
 void SortCaptures(ChessMove moves[], int moveCount);
 int CountCenterControl(int player);
-int EvaluatePawnStructure(int player);
+void AddPawnStructureTerms(int player, int sign, int terms[EVAL_PARAM_COUNT]);
 void GenerateCaptureMoves(int player, ChessMove moves[], int &moveCount);
+// NNUE evaluation
+void NnueInit();
+bool NnueSelectKernels(const char* name);
+void NnueSetDefaultNetwork();
+bool NnueLoad(const char* path);
+bool NnueSave(const char* path);
+void NnueRefresh(NnueAccumulator& acc);
+void NnueMakeMove(const ChessMove& move, const MoveUndo& undo);
+int NnueEvaluate();
+#ifndef CHESS_HEADLESS
 // Function declarations
 const TCHAR* GetPieceSymbol(int piece);
 // Drawing and make a piece treat like a rectangle and move pieces and reset game
@@ -105,9 +509,17 @@ void DrawPromotionChoice(HDC hdc);
 void HandlePromotionClick(int x, int y);
 void CreateModeButtons(HWND hwnd);
 void PromotePawn(HWND hwnd, int col, int row); // Change the pawn to other pieces
+#endif
 void ResetGame();
+// Position setup and notation (used by the headless driver)
+bool LoadFen(const char* fen);
+void PositionToFen(char out[100]);
+void MoveToString(const ChessMove& move, char out[6]);
+bool ParseMove(const char* text, ChessMove& move);
+bool ParseSanMove(const char* text, int length, ChessMove& move);
+unsigned short PackMove(const ChessMove& move);
+ChessMove UnpackMove(unsigned short packed);
 // Chess rules and conditions
-bool IsValidMoveWithoutCheck(int fromCol, int fromRow, int toCol, int toRow);
 bool IsCaptureMove(int fromCol, int fromRow, int toCol, int toRow);
 bool IsSquareUnderAttack(int col, int row, int byPlayer);
 bool IsInCheck(int player);
@@ -115,11 +527,120 @@ bool IsCheckmate(int player);
 bool CanCastle(int player, bool kingside);
 bool IsStalemate(int player);
 bool IsValidMove(int fromCol, int fromRow, int toCol, int toRow);
+// Position hash and draw rules
+int CastlingRights();
+unsigned long long ComputePositionHash();
+void StartHashHistory();
+void RecordGameMove(bool irreversible);
+int CountRepetitions();
+bool IsDrawByRule();
+// Pondering
+void SavePosition(PositionSnapshot& snapshot);
+void RestorePosition(const PositionSnapshot& snapshot);
+void StartPondering();
+void StopPondering();
+bool TakePonderResult(ChessMove& move);
+// Persistent analysis cache
+unsigned long long NnueNetworkHash();
+unsigned long long EvaluatorKey();
+unsigned long long AnalysisKey();
+bool OpenAnalysisCache(const char* path, int sizeMb);
+void FlushAnalysisCache(bool wait);
+void CloseAnalysisCache();
+bool ProbeAnalysisCache(unsigned long long key, ChessMove& move, unsigned short& reply, int& score, int& depth);
+void StoreAnalysisCache(unsigned long long key, const ChessMove& move, const ChessMove* reply, int score, int depth);
+// Large search tables
+bool AllocateLargeTable(LargeTable& table, size_t bytes, bool largePages);
+void FreeLargeTable(LargeTable& table);
+void ClearLargeTableSlice(LargeTable& table, int index, int count);
+void ClearLargeTable(LargeTable& table, int threads);
+// MultiPV analysis
+bool ProbePvTable(int& score, unsigned short& move, int& depth, int& bound);
+void StorePvTable(int score, unsigned short move, int depth, int bound);
+void UsePvTablePartition(PvTTEntry* entries, size_t count);
+void ExtendPvFromTable(MultiPvLine& line, int depth);
+int SearchMultiPV(int depth, int lineCount, MultiPvLine lines[]);
+void FormatPvLine(const MultiPvLine& line, char* out, int size);
+#ifndef CHESS_HEADLESS
+void AnalysisWorker();
+void RequestAnalysis(HWND hwnd);
+void StopAnalysis(bool quit);
+void DrawAnalysisPanel(HDC hdc);
+#endif
 // Insted of algorithem fuction
 int abs(int value);
 int Min(int a, int b);
 int Max(int a, int b);
 
+// Search statistics (build with -DCHESS_SEARCH_STATS to enable)
+// Counters live in a thread_local block so the hot path never touches atomics;
+// with the flag off every STATS_* macro compiles to nothing.
+#ifdef CHESS_SEARCH_STATS
+#ifndef CHESS_STATS_FILE
+#define CHESS_STATS_FILE "search_stats.json"
+#endif
+
+const int STATS_HISTOGRAM_BUCKETS = 24; // log2(ns) buckets: 1ns .. ~8ms and above
+
+struct TimingHistogram {
+    unsigned long long calls;
+    unsigned long long totalNs;
+    unsigned long long buckets[STATS_HISTOGRAM_BUCKETS];
+
+    void Record(unsigned long long ns) {
+        calls++;
+        totalNs += ns;
+        int bucket = 0;
+        while (bucket < STATS_HISTOGRAM_BUCKETS - 1 && (ns >> (bucket + 1)) != 0) bucket++;
+        buckets[bucket]++;
+    }
+};
+
+struct SearchStats {
+    unsigned long long nodes;             // Minimax() entries
+    unsigned long long qnodes;            // QuiescenceSearch() entries
+    unsigned long long betaCutoffs;       // Minimax() alpha-beta cutoffs
+    unsigned long long firstMoveCutoffs;  // ... of which came from the first move searched
+    unsigned long long qBetaCutoffs;      // QuiescenceSearch() cutoffs after a capture
+    unsigned long long qStandPatCutoffs;  // QuiescenceSearch() stand-pat cutoffs
+    unsigned long long ttProbes;          // PvSearchT() lookups in the MultiPV table (the main search has none)
+    unsigned long long ttHits;            // ... that returned an entry deep enough to use
+    unsigned long long drawsByRule;       // Minimax() nodes cut as repetition / fifty-move draws
+    unsigned long long reverseFutilityCuts; // Minimax() nodes cut by each PruneTechnique
+    unsigned long long razorCuts;
+    unsigned long long futilityPruned;    // ... moves skipped
+    unsigned long long lateMovesPruned;
+    unsigned long long probCuts;
+    TimingHistogram evaluatePosition;
+    TimingHistogram generateLegalMoves;
+    TimingHistogram generateCaptureMoves;
+};
+
+thread_local SearchStats searchStats;
+
+// Times the enclosing scope into one of the histograms above
+struct StatsTimer {
+    TimingHistogram& histogram;
+    std::chrono::steady_clock::time_point start;
+
+    explicit StatsTimer(TimingHistogram& h) : histogram(h), start(std::chrono::steady_clock::now()) {}
+    ~StatsTimer() {
+        histogram.Record(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count());
+    }
+};
+
+void ResetSearchStats();
+void DumpSearchStats(FILE* out, int depth, double elapsedMs);
+
+#define STATS_INC(field) (++searchStats.field)
+#define STATS_TIMER(histogram) StatsTimer statsTimer_##histogram(searchStats.histogram)
+#else
+#define STATS_INC(field) ((void)0)
+#define STATS_TIMER(histogram) ((void)0)
+#endif
+
+#ifndef CHESS_HEADLESS
 LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
     static POINT selectedSquare = {-1, -1};
     
@@ -157,6 +678,13 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
                     aiThinking = true;
                 }
             }
+            else if (LOWORD(wParam) == 3) { // Analysis button
+                analysisMode = !analysisMode;
+                if (!analysisMode) StopAnalysis(false);
+                analysisRequestHash = 0;
+                SendMessage(GetDlgItem(hwnd, 3), BM_SETSTATE, analysisMode, 0);
+                InvalidateRect(hwnd, NULL, TRUE);
+            }
             break;
             
         case WM_TIMER:
@@ -164,34 +692,16 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
                 currentPlayer == -1 && !gameOver) {
                 KillTimer(hwnd, AI_TIMER_ID);
                 
-                // Get the best move
-                ChessMove bestMove = FindBestMove(3); // Depth 3 search
-                
-                // Make the move on the board
-                int piece = board[bestMove.fromY][bestMove.fromX];
-                board[bestMove.toY][bestMove.toX] = piece;
-                board[bestMove.fromY][bestMove.fromX] = EMPTY;
-                
-                // Update king position if moved
-                if (abs(piece) == WHITE_KING) {
-                    if (piece > 0) {
-                        whiteKingPos.x = bestMove.toX;
-                        whiteKingPos.y = bestMove.toY;
-                        whiteKingMoved = true;
-                    } else {
-                        blackKingPos.x = bestMove.toX;
-                        blackKingPos.y = bestMove.toY;
-                        blackKingMoved = true;
-                    }
-                }
-                
-                // Handle promotion
-                if (bestMove.promotion != 0) {
-                    board[bestMove.toY][bestMove.toX] = bestMove.promotion;
+                // Get the best move, already searched on a ponder hit
+                ChessMove bestMove;
+                if (!TakePonderResult(bestMove)) {
+                    bestMove = FindBestMove(engineConfig.depth); // Depth 3 search by default
                 }
                 
-                // Switch turns
-                currentPlayer = 1;
+                // Make the move on the board (castling, en passant and promotion included),
+                // this also hands the turn back to white
+                MoveUndo undo;
+                MakeMove(bestMove, undo);
                 
                 // Check game state
                 if (IsCheckmate(1)) {
@@ -202,18 +712,28 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
                     MessageBox(hwnd, _T("Stalemate! Game is a draw."), _T("Game Over"), MB_OK);
                     gameOver = true;
                 }
+                else if (halfmoveClock >= 100 || CountRepetitions() >= 2) {
+                    MessageBox(hwnd, _T("Draw by repetition or fifty-move rule."), _T("Game Over"), MB_OK);
+                    gameOver = true;
+                }
+                
+                // Think on the human's time
+                if (!gameOver) StartPondering();
                 
                 InvalidateRect(hwnd, NULL, TRUE);
             }
             break;
         case WM_DESTROY:
+            StopPondering();
+            StopAnalysis(true);
+            CloseAnalysisCache();
             PostQuitMessage(0);
             return 0;
             
         case WM_SIZE: {
             RECT clientRect;
             GetClientRect(hwnd, &clientRect);
-            boardStartX = (clientRect.right - 8 * squareSize) / 2;
+            boardStartX = (clientRect.right - analysisPanelWidth - 8 * squareSize) / 2;
             boardStartY = (clientRect.bottom - 8 * squareSize) / 2;
             InvalidateRect(hwnd, NULL, TRUE);
             return 0;
@@ -286,6 +806,8 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
                 DeleteObject(hWhiteBluePen);
             }
             DrawPromotionChoice(hdc);
+            if (analysisMode) RequestAnalysis(hwnd);
+            DrawAnalysisPanel(hdc);
             EndPaint(hwnd, &ps);
             return 0;
         }
@@ -336,6 +858,8 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
                 }
             } else {
                 if (IsValidMove(selectedSquare.x, selectedSquare.y, col, row)) {
+                    bool irreversible = board[row][col] != EMPTY ||
+                                        abs(board[selectedSquare.y][selectedSquare.x]) == WHITE_PAWN;
                     MovePiece(hwnd, selectedSquare.x, selectedSquare.y, col, row);
                     
                     // Check for pawn promotion
@@ -346,6 +870,7 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
                     
                     // Switch players
                     currentPlayer = -currentPlayer;
+                    RecordGameMove(irreversible);
                     
                     // Check for game over conditions
                     if (IsCheckmate(currentPlayer)) {
@@ -359,6 +884,10 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
                         MessageBox(hwnd, _T("Stalemate! Game is a draw."), _T("Game Over"), MB_OK);
                         gameOver = true;
                     }
+                    else if (halfmoveClock >= 100 || CountRepetitions() >= 2) {
+                        MessageBox(hwnd, _T("Draw by repetition or fifty-move rule."), _T("Game Over"), MB_OK);
+                        gameOver = true;
+                    }
                 }
                 selectedSquare.x = -1;
                 showMoves = false;
@@ -397,6 +926,7 @@ const TCHAR* GetPieceSymbol(int piece) {
         default: return _T("");
     }
 }
+#endif
 
 int abs(int value) {
     return (value < 0) ? -value : value;
@@ -411,6 +941,14 @@ int Max(int a, int b) {
 }
 
 void ResetGame() {
+#ifndef CHESS_HEADLESS
+    StopPondering();
+    // Window state; the headless build resets boards on many threads at once (gendata, pgn scan)
+    possibleMoveCount = 0;
+    showMoves = false;
+    gameOver = false;
+#endif
+    
     // Reset the board to starting position
     int newBoard[8][8] = {
         {BLACK_ROOK, BLACK_KNIGHT, BLACK_BISHOP, BLACK_QUEEN, BLACK_KING, BLACK_BISHOP, BLACK_KNIGHT, BLACK_ROOK},
@@ -427,9 +965,6 @@ void ResetGame() {
     
     // Reset game state variables
     currentPlayer = 1;
-    possibleMoveCount = 0;
-    showMoves = false;
-    gameOver = false;
     
     // Reset king positions
     whiteKingPos = {4, 7};
@@ -445,6 +980,267 @@ void ResetGame() {
     
     // Reset en passant target
     enPassantTarget = {-1, -1};
+    
+    halfmoveClock = 0;
+    StartHashHistory();
+}
+
+// Sets up the board from a FEN string. Castling rights map onto the moved flags, the
+// fullmove number is ignored. Returns false on a malformed placement field or one without
+// exactly one king per side, and resets the game if the side not to move is in check.
+bool LoadFen(const char* fen) {
+    int newBoard[8][8] = {};
+    int row = 0, col = 0, whiteKings = 0, blackKings = 0;
+    const char* p = fen;
+    for (; *p && *p != ' '; p++) {
+        if (*p == '/') {
+            row++;
+            col = 0;
+            continue;
+        }
+        if (*p >= '1' && *p <= '8') {
+            col += *p - '0';
+            continue;
+        }
+        int piece = EMPTY;
+        switch (*p | 0x20) { // lower-case
+            case 'r': piece = WHITE_ROOK; break;
+            case 'n': piece = WHITE_KNIGHT; break;
+            case 'b': piece = WHITE_BISHOP; break;
+            case 'q': piece = WHITE_QUEEN; break;
+            case 'k': piece = WHITE_KING; break;
+            case 'p': piece = WHITE_PAWN; break;
+            default: return false;
+        }
+        if (row > 7 || col > 7) return false;
+        if (piece == WHITE_KING) (*p >= 'a' ? blackKings : whiteKings)++;
+        newBoard[row][col++] = (*p >= 'a') ? -piece : piece;
+    }
+    if (row != 7 || whiteKings != 1 || blackKings != 1) return false;
+
+    ResetGame();
+    memcpy(board, newBoard, sizeof(board));
+    for (int y = 0; y < 8; y++) {
+        for (int x = 0; x < 8; x++) {
+            if (board[y][x] == WHITE_KING) whiteKingPos = {x, y};
+            if (board[y][x] == BLACK_KING) blackKingPos = {x, y};
+        }
+    }
+
+    while (*p == ' ') p++;
+    currentPlayer = (*p == 'b') ? -1 : 1;
+    if (*p) p++;
+    if (IsInCheck(-currentPlayer)) {
+        ResetGame();
+        return false;
+    }
+    while (*p == ' ') p++;
+
+    bool castle[4] = {false, false, false, false}; // K Q k q
+    for (; *p && *p != ' '; p++) {
+        if (*p == 'K') castle[0] = true;
+        if (*p == 'Q') castle[1] = true;
+        if (*p == 'k') castle[2] = true;
+        if (*p == 'q') castle[3] = true;
+    }
+    whiteRookKingMoved = !castle[0];
+    whiteRookQueenMoved = !castle[1];
+    blackRookKingMoved = !castle[2];
+    blackRookQueenMoved = !castle[3];
+    whiteKingMoved = !castle[0] && !castle[1];
+    blackKingMoved = !castle[2] && !castle[3];
+
+    while (*p == ' ') p++;
+    if (*p >= 'a' && *p <= 'h' && p[1] >= '1' && p[1] <= '8') {
+        enPassantTarget = {p[0] - 'a', '8' - p[1]};
+    }
+    while (*p && *p != ' ') p++;
+    halfmoveClock = atoi(p);
+    StartHashHistory();
+    return true;
+}
+
+// FEN of the current position, the inverse of LoadFen() (the fullmove number is always 1)
+void PositionToFen(char out[100]) {
+    const char* letters = "rnbqkp";
+    char* p = out;
+    for (int y = 0; y < 8; y++) {
+        int empty = 0;
+        for (int x = 0; x < 8; x++) {
+            int piece = board[y][x];
+            if (piece == EMPTY) {
+                empty++;
+                continue;
+            }
+            if (empty > 0) *p++ = (char)('0' + empty);
+            empty = 0;
+            char letter = letters[abs(piece) - 1];
+            *p++ = piece > 0 ? (char)(letter - 'a' + 'A') : letter;
+        }
+        if (empty > 0) *p++ = (char)('0' + empty);
+        if (y < 7) *p++ = '/';
+    }
+    *p++ = ' ';
+    *p++ = currentPlayer == 1 ? 'w' : 'b';
+    *p++ = ' ';
+    int rights = CastlingRights();
+    if (rights & 1) *p++ = 'K';
+    if (rights & 2) *p++ = 'Q';
+    if (rights & 4) *p++ = 'k';
+    if (rights & 8) *p++ = 'q';
+    if (rights == 0) *p++ = '-';
+    *p++ = ' ';
+    if (enPassantTarget.x >= 0) {
+        *p++ = (char)('a' + enPassantTarget.x);
+        *p++ = (char)('8' - enPassantTarget.y);
+    } else {
+        *p++ = '-';
+    }
+    snprintf(p, out + 100 - p, " %d 1", halfmoveClock);
+}
+
+// Coordinate notation, e.g. "e2e4" or "e7e8q"
+void MoveToString(const ChessMove& move, char out[6]) {
+    out[0] = 'a' + move.fromX;
+    out[1] = '8' - move.fromY;
+    out[2] = 'a' + move.toX;
+    out[3] = '8' - move.toY;
+    out[4] = '\0';
+    switch (abs(move.promotion)) {
+        case WHITE_QUEEN: out[4] = 'q'; break;
+        case WHITE_ROOK: out[4] = 'r'; break;
+        case WHITE_BISHOP: out[4] = 'b'; break;
+        case WHITE_KNIGHT: out[4] = 'n'; break;
+    }
+    out[5] = '\0';
+}
+
+// Finds the legal move for the side to move written as "e2e4" / "e7e8q"
+bool ParseMove(const char* text, ChessMove& move) {
+    if (strlen(text) < 4) return false;
+    ChessMove moves[256];
+    int moveCount = 0;
+    GenerateLegalMoves(currentPlayer, moves, moveCount);
+    for (int i = 0; i < moveCount; i++) {
+        char candidate[6];
+        MoveToString(moves[i], candidate);
+        if (strncmp(candidate, text, 4) == 0 &&
+            (candidate[4] == '\0' || (text[4] | 0x20) == candidate[4])) {
+            move = moves[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+// 16 bits: from and to squares 6 bits each, promotion + 8 in 4. Never 0.
+unsigned short PackMove(const ChessMove& move) {
+    return (unsigned short)((move.fromY * 8 + move.fromX) | (move.toY * 8 + move.toX) << 6 | (move.promotion + 8) << 12);
+}
+
+ChessMove UnpackMove(unsigned short packed) {
+    ChessMove move(packed & 7, packed >> 3 & 7, packed >> 6 & 7, packed >> 9 & 7);
+    move.promotion = (packed >> 12 & 15) - 8;
+    return move;
+}
+
+#ifndef CHESS_HEADLESS
+// Searches the newest requested position and publishes its lines, unless another request
+// came in meanwhile; runs until StopAnalysis(true)
+void AnalysisWorker() {
+    searchStop = &analysisStop;
+    std::unique_lock<std::mutex> lock(analysisMutex);
+    for (;;) {
+        analysisWake.wait(lock, [] { return analysisPending || analysisQuit; });
+        if (analysisQuit) return;
+        analysisPending = false;
+        analysisStop = false;
+        // The position state is thread_local: take over the GUI thread's copy
+        RestorePosition(analysisPosition);
+        engineConfig = analysisConfig;
+        lock.unlock();
+
+        MultiPvLine lines[ANALYSIS_LINES];
+        int lineCount = SearchMultiPV(engineConfig.depth + 1, ANALYSIS_LINES, lines);
+
+        lock.lock();
+        if (!analysisStop && !analysisPending) {
+            for (int i = 0; i < lineCount; i++) analysisLines[i] = lines[i];
+            analysisLineCount = lineCount;
+            analysisHash = positionHash;
+            InvalidateRect(analysisWindow, NULL, TRUE);
+        }
+    }
+}
+
+// Hands the position on the board to the analysis worker, once per position; a search
+// of an earlier position still running is abandoned
+void RequestAnalysis(HWND hwnd) {
+    if (analysisRequestHash == positionHash || isPromoting || gameOver) return;
+    if (!analysisThread.joinable()) analysisThread = std::thread(AnalysisWorker);
+    std::lock_guard<std::mutex> lock(analysisMutex);
+    SavePosition(analysisPosition);
+    analysisConfig = engineConfig;
+    analysisWindow = hwnd;
+    analysisPending = true;
+    analysisStop = true;
+    analysisRequestHash = positionHash;
+    analysisWake.notify_one();
+}
+
+// Abandons the running analysis; with 'quit' the worker also ends and is waited for
+void StopAnalysis(bool quit) {
+    if (!analysisThread.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(analysisMutex);
+        analysisPending = false;
+        analysisStop = true;
+        analysisQuit = quit;
+    }
+    analysisWake.notify_one();
+    if (quit) analysisThread.join();
+}
+
+// The best moves of the side to move next to the board, as far as the worker has found
+// them for this position
+void DrawAnalysisPanel(HDC hdc) {
+    if (!analysisMode) return;
+    MultiPvLine lines[ANALYSIS_LINES];
+    int lineCount = 0;
+    {
+        std::lock_guard<std::mutex> lock(analysisMutex);
+        if (analysisHash == positionHash) {
+            lineCount = analysisLineCount;
+            for (int i = 0; i < lineCount; i++) lines[i] = analysisLines[i];
+        }
+    }
+
+    int left = boardStartX + 8 * squareSize + 30;
+    HFONT hFont = CreateFont(16, 0, 0, 0, FW_NORMAL, FALSE, FALSE, FALSE,
+                            DEFAULT_CHARSET, OUT_DEFAULT_PRECIS, CLIP_DEFAULT_PRECIS,
+                            DEFAULT_QUALITY, FIXED_PITCH | FF_MODERN, _T("Consolas"));
+    HFONT hOldFont = (HFONT)SelectObject(hdc, hFont);
+    SetBkMode(hdc, TRANSPARENT);
+    SetTextColor(hdc, RGB(230, 230, 230));
+
+    TCHAR text[200];
+    wsprintf(text, (lineCount > 0 || gameOver) ? _T("Analysis, depth %d (scores for White)")
+                                               : _T("Analysis, depth %d: searching..."), engineConfig.depth + 1);
+    RECT titleRect = {left, boardStartY, left + analysisPanelWidth - 40, boardStartY + 24};
+    DrawText(hdc, text, -1, &titleRect, DT_LEFT | DT_SINGLELINE);
+
+    for (int i = 0; i < lineCount; i++) {
+        char line[200];
+        FormatPvLine(lines[i], line, sizeof(line));
+        int length = 0;
+        for (; line[length] != '\0'; length++) text[length] = (TCHAR)line[length];
+        text[length] = '\0';
+        RECT lineRect = {left, boardStartY + 34 + i * 60, left + analysisPanelWidth - 40, boardStartY + 90 + i * 60};
+        DrawText(hdc, text, length, &lineRect, DT_LEFT | DT_WORDBREAK);
+    }
+
+    SelectObject(hdc, hOldFont);
+    DeleteObject(hFont);
 }
 
 void DrawPromotionChoice(HDC hdc) {
@@ -526,6 +1322,8 @@ void HandlePromotionClick(int x, int y) {
             
             board[promotionPos.y][promotionPos.x] = newPiece;
             isPromoting = false;
+            positionHash = ComputePositionHash(); // The move is already on the history
+            hashHistory[historyCount - 1] = positionHash;
             InvalidateRect(promotionHwnd, NULL, TRUE);
             break;
         }
@@ -574,6 +1372,15 @@ void CreateModeButtons(HWND hwnd) {
         hwnd, (HMENU)2, NULL, NULL
     );
     SendMessage(hPvAIButton, WM_SETFONT, (WPARAM)hFont, TRUE);
+
+    // Analysis panel toggle, works in both modes
+    HWND hAnalysisButton = CreateWindow(
+        _T("BUTTON"), _T("Analysis"),
+        WS_VISIBLE | WS_CHILD | BS_PUSHBUTTON | BS_FLAT,
+        420, 20, 180, 40,
+        hwnd, (HMENU)3, NULL, NULL
+    );
+    SendMessage(hAnalysisButton, WM_SETFONT, (WPARAM)hFont, TRUE);
     
     // Highlight the current mode
     if (currentGameMode == MODE_PVP) {
@@ -805,194 +1612,504 @@ void MovePiece(HWND hwnd, int fromCol, int fromRow, int toCol, int toRow) {
     
     InvalidateRect(hwnd, NULL, TRUE);
 }
+#endif
 
-bool IsSquareUnderAttack(int col, int row, int byPlayer) {
-    // Temporarily remove the piece at target square to check attacks
-    int savedPiece = board[row][col];
-    board[row][col] = EMPTY;
-
-    for (int r = 0; r < 8; r++) {
-        for (int c = 0; c < 8; c++) {
-            int piece = board[r][c];
-            if (piece != EMPTY && piece * byPlayer < 0) { // Opponent's piece
-                // Special handling for pawn attacks
-                if (abs(piece) == WHITE_PAWN) {
-                    int direction = (piece > 0) ? -1 : 1; // White pawns move up, black pawns move down
-                    if (abs(c - col) == 1 && r + direction == row) {
-                        board[row][col] = savedPiece;
-                        return true;
-                    }
-                }
-                // For other pieces, use the normal move validation
-                else if (IsValidMoveWithoutCheck(c, r, col, row)) {
-                    board[row][col] = savedPiece;
-                    return true;
-                }
+// Move generation
+// GenerateMoves<Side, Type> is instantiated once per side (1 white, -1 black) and kind of
+// move list, so the colour tests, pawn direction and promotion rank fold into constants
+// and the quiet-move code disappears entirely from the capture generator.
+// There is no GEN_QUIETS: the main search sorts the full GEN_ALL list with SortMoves and
+// has no staged move picker that would ask for the quiet moves after the captures.
+enum GenType {
+    GEN_ALL,       // Every legal move, position not in check
+    GEN_CAPTURES,  // Legal captures (promotions to a queen only), for the quiescence search
+    GEN_EVASIONS   // Every legal move while in check: king moves, block or take the checker
+};
+
+static const int knightSteps[8][2] = {{1, 2}, {2, 1}, {2, -1}, {1, -2}, {-1, -2}, {-2, -1}, {-2, 1}, {-1, 2}};
+static const int kingSteps[8][2] = {{1, 0}, {1, 1}, {0, 1}, {-1, 1}, {-1, 0}, {-1, -1}, {0, -1}, {1, -1}};
+static const int rookSteps[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+static const int bishopSteps[4][2] = {{1, 1}, {1, -1}, {-1, 1}, {-1, -1}};
+
+static inline bool OnBoard(int x, int y) {
+    return (unsigned)x < 8 && (unsigned)y < 8;
+}
+
+static inline unsigned long long SquareBit(int x, int y) {
+    return 1ULL << (y * 8 + x);
+}
+
+// Is the square attacked by a piece of BySide? The piece standing on it is ignored
+template <int BySide>
+bool IsAttackedBy(int x, int y) {
+    // Pawns attack towards the other side, so the attacker stands one row behind
+    int pawnY = y + BySide;
+    if ((unsigned)pawnY < 8) {
+        if (x > 0 && board[pawnY][x - 1] == BySide * WHITE_PAWN) return true;
+        if (x < 7 && board[pawnY][x + 1] == BySide * WHITE_PAWN) return true;
+    }
+    for (int i = 0; i < 8; i++) {
+        int nx = x + knightSteps[i][0], ny = y + knightSteps[i][1];
+        if (OnBoard(nx, ny) && board[ny][nx] == BySide * WHITE_KNIGHT) return true;
+        nx = x + kingSteps[i][0];
+        ny = y + kingSteps[i][1];
+        if (OnBoard(nx, ny) && board[ny][nx] == BySide * WHITE_KING) return true;
+    }
+    for (int d = 0; d < 4; d++) {
+        int nx = x + rookSteps[d][0], ny = y + rookSteps[d][1];
+        while (OnBoard(nx, ny)) {
+            int piece = board[ny][nx];
+            if (piece != EMPTY) {
+                if (piece == BySide * WHITE_ROOK || piece == BySide * WHITE_QUEEN) return true;
+                break;
+            }
+            nx += rookSteps[d][0];
+            ny += rookSteps[d][1];
+        }
+        nx = x + bishopSteps[d][0];
+        ny = y + bishopSteps[d][1];
+        while (OnBoard(nx, ny)) {
+            int piece = board[ny][nx];
+            if (piece != EMPTY) {
+                if (piece == BySide * WHITE_BISHOP || piece == BySide * WHITE_QUEEN) return true;
+                break;
             }
+            nx += bishopSteps[d][0];
+            ny += bishopSteps[d][1];
         }
     }
-    
-    board[row][col] = savedPiece;
     return false;
 }
 
-bool IsValidMoveWithoutCheck(int fromCol, int fromRow, int toCol, int toRow) {
-    int piece = board[fromRow][fromCol];
-    int target = board[toRow][toCol];
-
-    if (piece == EMPTY) return false;
-    if (fromCol == toCol && fromRow == toRow) return false;
-    if (target != EMPTY && piece * target > 0) return false;
+// Squares a non-king move has to land on to answer a check on (kx, ky): the checker and
+// the squares between it and the king. Double check leaves only king moves (empty mask).
+template <int Side>
+unsigned long long CheckEvasionMask(int kx, int ky) {
+    const int enemy = -Side;
+    unsigned long long mask = 0;
+    int checkers = 0;
     
-    int colDiff = toCol - fromCol;
-    int rowDiff = toRow - fromRow;
-    int absColDiff = abs(colDiff);
-    int absRowDiff = abs(rowDiff);
-    
-    switch (abs(piece)) {
-        case WHITE_PAWN: {
-            int direction = (piece > 0) ? -1 : 1;
-            
-            // Forward move
-            if (fromCol == toCol && target == EMPTY) {
-                if (fromRow + direction == toRow) return true;
-                // Double move from starting position
-                if ((piece > 0 && fromRow == 6) || (piece < 0 && fromRow == 1)) {
-                    if (fromRow + 2*direction == toRow && 
-                        board[fromRow + direction][fromCol] == EMPTY) {
-                        return true;
-                    }
-                }
+    int pawnY = ky - Side; // Enemy pawns attack the king from the row in front of it
+    if ((unsigned)pawnY < 8) {
+        for (int dx = -1; dx <= 1; dx += 2) {
+            if ((unsigned)(kx + dx) < 8 && board[pawnY][kx + dx] == enemy * WHITE_PAWN) {
+                mask |= SquareBit(kx + dx, pawnY);
+                checkers++;
             }
-            // Capture
-            else if (absColDiff == 1 && fromRow + direction == toRow) {
-                // Normal capture
-                if (target != EMPTY) return true;
-                // En passant
-                if (toCol == enPassantTarget.x && toRow == enPassantTarget.y) {
-                    return true;
-                }
-            }
-            break;
-        }
-        case WHITE_KNIGHT: {
-            return (absColDiff == 2 && absRowDiff == 1) || 
-                   (absColDiff == 1 && absRowDiff == 2);
-        }
-        case WHITE_BISHOP: {
-            if (absColDiff != absRowDiff) return false;
-            int colStep = (colDiff > 0) ? 1 : -1;
-            int rowStep = (rowDiff > 0) ? 1 : -1;
-            for (int i = 1; i < absColDiff; i++) {
-                if (board[fromRow + i * rowStep][fromCol + i * colStep] != EMPTY)
-                    return false;
-            }
-            return true;
         }
-        case WHITE_ROOK: {
-            if (fromCol != toCol && fromRow != toRow) return false;
-            if (fromCol == toCol) {
-                int step = (rowDiff > 0) ? 1 : -1;
-                for (int r = fromRow + step; r != toRow; r += step) {
-                    if (board[r][fromCol] != EMPTY) return false;
-                }
-            } else {
-                int step = (colDiff > 0) ? 1 : -1;
-                for (int c = fromCol + step; c != toCol; c += step) {
-                    if (board[fromRow][c] != EMPTY) return false;
-                }
-            }
-            return true;
+    }
+    for (int i = 0; i < 8; i++) {
+        int nx = kx + knightSteps[i][0], ny = ky + knightSteps[i][1];
+        if (OnBoard(nx, ny) && board[ny][nx] == enemy * WHITE_KNIGHT) {
+            mask |= SquareBit(nx, ny);
+            checkers++;
         }
-        case WHITE_QUEEN: {
-            if (fromCol == toCol || fromRow == toRow) {
-                if (fromCol == toCol) {
-                    int step = (rowDiff > 0) ? 1 : -1;
-                    for (int r = fromRow + step; r != toRow; r += step) {
-                        if (board[r][fromCol] != EMPTY) return false;
-                    }
-                } else {
-                    int step = (colDiff > 0) ? 1 : -1;
-                    for (int c = fromCol + step; c != toCol; c += step) {
-                        if (board[fromRow][c] != EMPTY) return false;
-                    }
-                }
-                return true;
-            }
-            else if (absColDiff == absRowDiff) {
-                int colStep = (colDiff > 0) ? 1 : -1;
-                int rowStep = (rowDiff > 0) ? 1 : -1;
-                for (int i = 1; i < absColDiff; i++) {
-                    if (board[fromRow + i * rowStep][fromCol + i * colStep] != EMPTY)
-                        return false;
+    }
+    for (int d = 0; d < 8; d++) {
+        int dx = kingSteps[d][0], dy = kingSteps[d][1];
+        bool diagonal = dx != 0 && dy != 0;
+        unsigned long long ray = 0;
+        int nx = kx + dx, ny = ky + dy;
+        while (OnBoard(nx, ny)) {
+            ray |= SquareBit(nx, ny);
+            int piece = board[ny][nx];
+            if (piece != EMPTY) {
+                if (piece == enemy * WHITE_QUEEN ||
+                    piece == enemy * (diagonal ? WHITE_BISHOP : WHITE_ROOK)) {
+                    mask |= ray;
+                    checkers++;
                 }
-                return true;
-            }
-            break;
-        }
-        case WHITE_KING: {
-            // Normal king move
-            if (absColDiff <= 1 && absRowDiff <= 1) {
-                return true;
-            }
-            // Castling
-            if (absColDiff == 2 && rowDiff == 0 && fromRow == (piece > 0 ? 7 : 0)) {
-                return CanCastle(piece > 0 ? 1 : -1, colDiff > 0);
+                break;
             }
-            break;
+            nx += dx;
+            ny += dy;
         }
     }
+    return checkers > 1 ? 0 : mask;
+}
+
+// Would the side's king be safe after moving (fx, fy) -> (tx, ty)? Plays the move on the
+// board just far enough to ask, en passant included.
+template <int Side>
+bool LeavesKingSafe(int fx, int fy, int tx, int ty) {
+    int piece = board[fy][fx];
+    int target = board[ty][tx];
+    bool enPassant = piece == Side * WHITE_PAWN && tx != fx && target == EMPTY;
     
-    return false;
+    board[ty][tx] = piece;
+    board[fy][fx] = EMPTY;
+    if (enPassant) board[fy][tx] = EMPTY;
+    
+    bool safe;
+    if (piece == Side * WHITE_KING) {
+        safe = !IsAttackedBy<-Side>(tx, ty);
+    } else {
+        const POINT& king = (Side == 1) ? whiteKingPos : blackKingPos;
+        safe = !IsAttackedBy<-Side>(king.x, king.y);
+    }
+    
+    board[fy][fx] = piece;
+    board[ty][tx] = target;
+    if (enPassant) board[fy][tx] = -Side * WHITE_PAWN;
+    return safe;
 }
 
-bool IsInCheck(int player) {
-    POINT kingPos = (player == 1) ? whiteKingPos : blackKingPos;
-    return IsSquareUnderAttack(kingPos.x, kingPos.y, player);
+// State shared by the per-piece generators below for one GenerateMoves() call
+struct MoveGenContext {
+    ChessMove* moves;
+    int count;
+    int kingX, kingY;
+    unsigned long long evasionMask;  // Allowed non-king destinations (all squares if not in check)
+};
+
+template <int Side, GenType Type>
+inline void AddMove(MoveGenContext& ctx, int fx, int fy, int tx, int ty, int promotion, bool verify) {
+    if (Type == GEN_EVASIONS || verify) {
+        if (!LeavesKingSafe<Side>(fx, fy, tx, ty)) return;
+    }
+    ChessMove& move = ctx.moves[ctx.count++];
+    move.fromX = fx;
+    move.fromY = fy;
+    move.toX = tx;
+    move.toY = ty;
+    move.promotion = promotion;
+    move.score = 0;
 }
 
-bool IsCheckmate(int player) {
-    if (!IsInCheck(player)) return false;
-    
-    // Check all possible moves to see if any get out of check
-    for (int fromRow = 0; fromRow < 8; fromRow++) {
-        for (int fromCol = 0; fromCol < 8; fromCol++) {
-            int piece = board[fromRow][fromCol];
-            if (piece != EMPTY && piece * player > 0) { // Player's piece
-                for (int toRow = 0; toRow < 8; toRow++) {
-                    for (int toCol = 0; toCol < 8; toCol++) {
-                        if (IsValidMove(fromCol, fromRow, toCol, toRow)) {
-                            return false; // Found a legal move
-                        }
-                    }
-                }
-            }
+// Pieces off every line through their own king can never be pinned, so only moves of
+// pieces on such a line (and king moves, en passant, evasions) pay for a legality check.
+static inline bool SharesLineWithKing(const MoveGenContext& ctx, int x, int y) {
+    return x == ctx.kingX || y == ctx.kingY || abs(x - ctx.kingX) == abs(y - ctx.kingY);
+}
+
+template <int Side, GenType Type>
+void AddPawnMove(MoveGenContext& ctx, int fx, int fy, int tx, int ty, bool verify) {
+    const int promotionRow = (Side == 1) ? 0 : 7;
+    if (ty != promotionRow) {
+        AddMove<Side, Type>(ctx, fx, fy, tx, ty, 0, verify);
+    } else {
+        AddMove<Side, Type>(ctx, fx, fy, tx, ty, Side * WHITE_QUEEN, verify);
+        if (Type != GEN_CAPTURES) {
+            AddMove<Side, Type>(ctx, fx, fy, tx, ty, Side * WHITE_KNIGHT, verify);
+            AddMove<Side, Type>(ctx, fx, fy, tx, ty, Side * WHITE_ROOK, verify);
+            AddMove<Side, Type>(ctx, fx, fy, tx, ty, Side * WHITE_BISHOP, verify);
         }
     }
-    return true; // No legal moves found
 }
 
-bool IsStalemate(int player) {
-    // Player must not be in check
-    if (IsInCheck(player)) return false;
+template <int Side, GenType Type>
+void GeneratePawnMoves(MoveGenContext& ctx, int x, int y, bool pinnable) {
+    const int forward = -Side; // White pawns move towards row 0
+    const int startRow = (Side == 1) ? 6 : 1;
+    int ty = y + forward;
     
-    // Check if player has any legal moves
-    for (int fromRow = 0; fromRow < 8; fromRow++) {
-        for (int fromCol = 0; fromCol < 8; fromCol++) {
-            int piece = board[fromRow][fromCol];
-            if (piece != EMPTY && piece * player > 0) { // Player's piece
-                for (int toRow = 0; toRow < 8; toRow++) {
-                    for (int toCol = 0; toCol < 8; toCol++) {
-                        if (IsValidMove(fromCol, fromRow, toCol, toRow)) {
-                            return false; // Found a legal move
-                        }
-                    }
-                }
-            }
+    for (int dx = -1; dx <= 1; dx += 2) {
+        int tx = x + dx;
+        if ((unsigned)tx >= 8) continue;
+        if (board[ty][tx] * Side < 0) {
+            if (Type != GEN_EVASIONS || (ctx.evasionMask & SquareBit(tx, ty)))
+                AddPawnMove<Side, Type>(ctx, x, y, tx, ty, pinnable);
+        } else if (tx == enPassantTarget.x && ty == enPassantTarget.y &&
+                   board[y][tx] == -Side * WHITE_PAWN) {
+            // Taking en passant empties two squares on the king's row, always verify
+            AddMove<Side, Type>(ctx, x, y, tx, ty, 0, true);
         }
     }
-    return true; // No legal moves found
-}
+    
+    if (Type == GEN_CAPTURES) return;
+    if (board[ty][x] != EMPTY) return;
+    if (Type != GEN_EVASIONS || (ctx.evasionMask & SquareBit(x, ty)))
+        AddPawnMove<Side, Type>(ctx, x, y, x, ty, pinnable);
+    if (y == startRow && board[ty + forward][x] == EMPTY) {
+        if (Type != GEN_EVASIONS || (ctx.evasionMask & SquareBit(x, ty + forward)))
+            AddMove<Side, Type>(ctx, x, y, x, ty + forward, 0, pinnable);
+    }
+}
+
+template <int Side, GenType Type>
+void GenerateStepMoves(MoveGenContext& ctx, int x, int y, const int (*steps)[2], bool king, bool pinnable) {
+    for (int i = 0; i < 8; i++) {
+        int tx = x + steps[i][0], ty = y + steps[i][1];
+        if (!OnBoard(tx, ty)) continue;
+        int target = board[ty][tx] * Side;
+        if (target > 0) continue;
+        if (Type == GEN_CAPTURES && target == 0) continue;
+        if (Type == GEN_EVASIONS && !king && !(ctx.evasionMask & SquareBit(tx, ty))) continue;
+        AddMove<Side, Type>(ctx, x, y, tx, ty, 0, king || pinnable);
+    }
+}
+
+template <int Side, GenType Type>
+void GenerateSliderMoves(MoveGenContext& ctx, int x, int y, const int (*steps)[2], int directions, bool pinnable) {
+    for (int d = 0; d < directions; d++) {
+        int tx = x + steps[d][0], ty = y + steps[d][1];
+        while (OnBoard(tx, ty)) {
+            int target = board[ty][tx] * Side;
+            if (target > 0) break;
+            if ((Type != GEN_CAPTURES || target < 0) &&
+                (Type != GEN_EVASIONS || (ctx.evasionMask & SquareBit(tx, ty)))) {
+                AddMove<Side, Type>(ctx, x, y, tx, ty, 0, pinnable);
+            }
+            if (target < 0) break;
+            tx += steps[d][0];
+            ty += steps[d][1];
+        }
+    }
+}
+
+// Moves of the side's piece on (x, y), castling aside
+template <int Side, GenType Type>
+inline void GeneratePieceMoves(MoveGenContext& ctx, int x, int y) {
+    bool pinnable = Type == GEN_EVASIONS || SharesLineWithKing(ctx, x, y);
+    switch (board[y][x] * Side) { // Own pieces come out positive
+        case WHITE_PAWN:
+            GeneratePawnMoves<Side, Type>(ctx, x, y, pinnable);
+            break;
+        case WHITE_KNIGHT:
+            GenerateStepMoves<Side, Type>(ctx, x, y, knightSteps, false, pinnable);
+            break;
+        case WHITE_BISHOP:
+            GenerateSliderMoves<Side, Type>(ctx, x, y, bishopSteps, 4, pinnable);
+            break;
+        case WHITE_ROOK:
+            GenerateSliderMoves<Side, Type>(ctx, x, y, rookSteps, 4, pinnable);
+            break;
+        case WHITE_QUEEN:
+            GenerateSliderMoves<Side, Type>(ctx, x, y, kingSteps, 8, pinnable);
+            break;
+        case WHITE_KING:
+            GenerateStepMoves<Side, Type>(ctx, x, y, kingSteps, true, true);
+            break;
+    }
+}
+
+// Castling is never a capture or an answer to check, so only GEN_ALL asks for it
+template <int Side>
+void GenerateCastling(MoveGenContext& ctx) {
+    const int row = (Side == 1) ? 7 : 0;
+    if (ctx.kingX == 4 && ctx.kingY == row) {
+        if (board[row][7] == Side * WHITE_ROOK && CanCastle(Side, true))
+            AddMove<Side, GEN_ALL>(ctx, 4, row, 6, row, 0, false);
+        if (board[row][0] == Side * WHITE_ROOK && CanCastle(Side, false))
+            AddMove<Side, GEN_ALL>(ctx, 4, row, 2, row, 0, false);
+    }
+}
+
+template <int Side, GenType Type>
+void GenerateMoves(ChessMove moves[], int &moveCount) {
+    MoveGenContext ctx;
+    ctx.moves = moves;
+    ctx.count = 0;
+    const POINT& king = (Side == 1) ? whiteKingPos : blackKingPos;
+    ctx.kingX = king.x;
+    ctx.kingY = king.y;
+    ctx.evasionMask = (Type == GEN_EVASIONS) ? CheckEvasionMask<Side>(king.x, king.y) : ~0ULL;
+    
+    for (int y = 0; y < 8; y++) {
+        for (int x = 0; x < 8; x++) {
+            if (board[y][x] * Side > 0) GeneratePieceMoves<Side, Type>(ctx, x, y);
+        }
+    }
+    if (Type == GEN_ALL) GenerateCastling<Side>(ctx);
+    moveCount = ctx.count;
+}
+
+// Legal moves of the side's piece on (x, y) only, castling included for the king. Checking
+// one move this way skips generating the moves of every other piece.
+template <int Side>
+int GenerateMovesFrom(int x, int y, ChessMove moves[]) {
+    MoveGenContext ctx;
+    ctx.moves = moves;
+    ctx.count = 0;
+    const POINT& king = (Side == 1) ? whiteKingPos : blackKingPos;
+    ctx.kingX = king.x;
+    ctx.kingY = king.y;
+    if (IsAttackedBy<-Side>(king.x, king.y)) {
+        ctx.evasionMask = CheckEvasionMask<Side>(king.x, king.y);
+        GeneratePieceMoves<Side, GEN_EVASIONS>(ctx, x, y);
+    } else {
+        ctx.evasionMask = ~0ULL;
+        GeneratePieceMoves<Side, GEN_ALL>(ctx, x, y);
+        if (x == king.x && y == king.y) GenerateCastling<Side>(ctx);
+    }
+    return ctx.count;
+}
+
+// Pseudo-legal destinations of all the side's pieces, for the mobility term
+template <int Side>
+int CountMobility() {
+    int mobility = 0;
+    for (int y = 0; y < 8; y++) {
+        for (int x = 0; x < 8; x++) {
+            int piece = board[y][x] * Side;
+            if (piece <= 0) continue;
+            if (piece == WHITE_PAWN) {
+                int ty = y - Side;
+                if (board[ty][x] == EMPTY) {
+                    mobility++;
+                    if (y == ((Side == 1) ? 6 : 1) && board[ty - Side][x] == EMPTY) mobility++;
+                }
+                if (x > 0 && board[ty][x - 1] * Side < 0) mobility++;
+                if (x < 7 && board[ty][x + 1] * Side < 0) mobility++;
+            } else if (piece == WHITE_KNIGHT || piece == WHITE_KING) {
+                const int (*steps)[2] = (piece == WHITE_KNIGHT) ? knightSteps : kingSteps;
+                for (int i = 0; i < 8; i++) {
+                    int tx = x + steps[i][0], ty = y + steps[i][1];
+                    if (OnBoard(tx, ty) && board[ty][tx] * Side <= 0) mobility++;
+                }
+            } else {
+                const int (*steps)[2] = (piece == WHITE_ROOK) ? rookSteps : (piece == WHITE_BISHOP) ? bishopSteps : kingSteps;
+                int directions = (piece == WHITE_QUEEN) ? 8 : 4;
+                for (int d = 0; d < directions; d++) {
+                    int tx = x + steps[d][0], ty = y + steps[d][1];
+                    while (OnBoard(tx, ty)) {
+                        int target = board[ty][tx] * Side;
+                        if (target > 0) break;
+                        mobility++;
+                        if (target < 0) break;
+                        tx += steps[d][0];
+                        ty += steps[d][1];
+                    }
+                }
+            }
+        }
+    }
+    const int row = (Side == 1) ? 7 : 0;
+    if (board[row][4] == Side * WHITE_KING) {
+        if (CanCastle(Side, true)) mobility++;
+        if (CanCastle(Side, false)) mobility++;
+    }
+    return mobility;
+}
+
+bool IsSquareUnderAttack(int col, int row, int byPlayer) {
+    // byPlayer is the side owning the square, the attackers are its opponent
+    return byPlayer == 1 ? IsAttackedBy<-1>(col, row) : IsAttackedBy<1>(col, row);
+}
+
+bool IsInCheck(int player) {
+    POINT kingPos = (player == 1) ? whiteKingPos : blackKingPos;
+    return IsSquareUnderAttack(kingPos.x, kingPos.y, player);
+}
+
+// Finds the legal move for the side to move written in SAN ("Nbd7", "exd5", "e8=Q+", "O-O").
+// Check marks and annotations ("+", "#", "!?") may follow, "e8Q" and "0-0" are accepted too.
+// False unless exactly one legal move fits. Only the pieces of the named kind that reach
+// the target square are tried, which is much cheaper than generating every legal move.
+bool ParseSanMove(const char* text, int length, ChessMove& move) {
+    while (length > 0 && (text[length - 1] == '+' || text[length - 1] == '#' || text[length - 1] == '!' ||
+                          text[length - 1] == '?')) length--;
+    if (length < 2) return false;
+    int side = currentPlayer;
+
+    if (text[0] == 'O' || text[0] == '0') {
+        int homeY = (side == 1) ? 7 : 0, toX;
+        if (length == 3 && (memcmp(text, "O-O", 3) == 0 || memcmp(text, "0-0", 3) == 0)) toX = 6;
+        else if (length == 5 && (memcmp(text, "O-O-O", 5) == 0 || memcmp(text, "0-0-0", 5) == 0)) toX = 2;
+        else return false;
+        if (board[homeY][4] != side * WHITE_KING) return false;
+        ChessMove moves[256];
+        int moveCount = 0;
+        GenerateLegalMoves(side, moves, moveCount);
+        for (int i = 0; i < moveCount; i++) {
+            if (moves[i].fromX == 4 && moves[i].fromY == homeY && moves[i].toX == toX && moves[i].toY == homeY) {
+                move = moves[i];
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Piece letters in Piece order: R = WHITE_ROOK ... K = WHITE_KING
+    const char* letters = "RNBQK";
+    int piece = WHITE_PAWN, start = 0, promotion = 0;
+    if (memchr(letters, text[0], 5)) {
+        piece = (int)((const char*)memchr(letters, text[0], 5) - letters) + 1;
+        start = 1;
+    }
+    if (piece == WHITE_PAWN && length >= 3 && memchr(letters, text[length - 1], 4) &&
+        (text[length - 2] == '=' || (text[length - 2] >= '1' && text[length - 2] <= '8'))) {
+        promotion = (int)((const char*)memchr(letters, text[length - 1], 4) - letters) + 1;
+        length -= (text[length - 2] == '=') ? 2 : 1;
+    }
+    if (length - start < 2) return false;
+    int toX = text[length - 2] - 'a', toY = '8' - text[length - 1];
+    if (!OnBoard(toX, toY) || board[toY][toX] * side > 0) return false;
+    int fromX = -1, fromY = -1;
+    for (int i = start; i < length - 2; i++) {
+        if (text[i] >= 'a' && text[i] <= 'h') fromX = text[i] - 'a';
+        else if (text[i] >= '1' && text[i] <= '8') fromY = '8' - text[i];
+        else if (text[i] != 'x' && text[i] != ':' && text[i] != '-') return false;
+    }
+
+    // Squares a piece of the kind could come from, the hints applied
+    ChessMove candidates[16];
+    int count = 0;
+    auto consider = [&](int x, int y) {
+        if (OnBoard(x, y) && board[y][x] == side * piece && (fromX < 0 || x == fromX) && (fromY < 0 || y == fromY) &&
+            count < 16) candidates[count++] = ChessMove(x, y, toX, toY);
+    };
+    if (piece == WHITE_PAWN) {
+        if ((toY == (side == 1 ? 0 : 7)) != (promotion != 0)) return false;
+        int behind = toY + side; // White pawns move towards row 0
+        if (!OnBoard(toX, behind)) return false;
+        if (fromX < 0 || fromX == toX) {
+            if (board[toY][toX] == EMPTY) {
+                if (board[behind][toX] == side * WHITE_PAWN) consider(toX, behind);
+                else if (board[behind][toX] == EMPTY && toY == (side == 1 ? 4 : 3)) consider(toX, behind + side);
+            }
+        } else if (board[toY][toX] * side < 0 || (toX == enPassantTarget.x && toY == enPassantTarget.y)) {
+            if (abs(fromX - toX) == 1) consider(fromX, behind);
+        }
+    } else if (piece == WHITE_KNIGHT || piece == WHITE_KING) {
+        const int (*steps)[2] = (piece == WHITE_KNIGHT) ? knightSteps : kingSteps;
+        for (int i = 0; i < 8; i++) consider(toX + steps[i][0], toY + steps[i][1]);
+    } else {
+        for (int d = 0; d < 8; d++) {
+            const int* step = (d < 4) ? rookSteps[d] : bishopSteps[d - 4];
+            if ((d < 4 && piece == WHITE_BISHOP) || (d >= 4 && piece == WHITE_ROOK)) continue;
+            int x = toX + step[0], y = toY + step[1];
+            while (OnBoard(x, y) && board[y][x] == EMPTY) {
+                x += step[0];
+                y += step[1];
+            }
+            consider(x, y);
+        }
+    }
+
+    int matches = 0;
+    for (int i = 0; i < count; i++) {
+        candidates[i].promotion = side * promotion;
+        MoveUndo undo;
+        MakeMove(candidates[i], undo);
+        bool legal = !IsInCheck(side);
+        UnmakeMove(candidates[i], undo);
+        if (legal) {
+            move = candidates[i];
+            matches++;
+        }
+    }
+    return matches == 1;
+}
+
+bool IsCheckmate(int player) {
+    if (!IsInCheck(player)) return false;
+    
+    ChessMove moves[256];
+    int moveCount = 0;
+    GenerateLegalMoves(player, moves, moveCount);
+    return moveCount == 0; // No legal moves found
+}
+
+bool IsStalemate(int player) {
+    // Player must not be in check
+    if (IsInCheck(player)) return false;
+    
+    ChessMove moves[256];
+    int moveCount = 0;
+    GenerateLegalMoves(player, moves, moveCount);
+    return moveCount == 0; // No legal moves found
+}
 
 bool CanCastle(int player, bool kingside) {
     int row = (player == 1) ? 7 : 0;  // White: bottom row (7), Black: top row (0)
@@ -1034,75 +2151,213 @@ bool CanCastle(int player, bool kingside) {
 
 bool IsValidMove(int fromCol, int fromRow, int toCol, int toRow) {
     int piece = board[fromRow][fromCol];
-    int target = board[toRow][toCol];
+    if (piece == EMPTY || piece * currentPlayer < 0) return false;
+    
+    // A move is valid when the generator produces it for the piece on the from-square
+    ChessMove moves[32];
+    int moveCount = (currentPlayer == 1) ? GenerateMovesFrom<1>(fromCol, fromRow, moves)
+                                         : GenerateMovesFrom<-1>(fromCol, fromRow, moves);
+    for (int i = 0; i < moveCount; i++) {
+        if (moves[i].fromX == fromCol && moves[i].fromY == fromRow &&
+            moves[i].toX == toCol && moves[i].toY == toRow) {
+            return true;
+        }
+    }
+    return false;
+}
 
-    // Basic checks
-    if (piece == EMPTY) return false;
-    if (fromCol == toCol && fromRow == toRow) return false;
-    if (target != EMPTY && piece * target > 0) return false;
-    if ((currentPlayer == 1 && piece < 0) || (currentPlayer == -1 && piece > 0)) {
-        return false;
+bool IsCaptureMove(int fromCol, int fromRow, int toCol, int toRow) {
+    int piece = board[fromRow][fromCol];
+    int target = board[toRow][toCol];
+    
+    // Normal capture
+    if (target != EMPTY && piece * target < 0) return true;
+    
+    // En passant
+    if (abs(piece) == WHITE_PAWN && toCol == enPassantTarget.x && toRow == enPassantTarget.y) {
+        return true;
     }
     
-    if (!IsValidMoveWithoutCheck(fromCol, fromRow, toCol, toRow)) {
-        return false;
+    return false;
+}
+
+void MakeMove(const ChessMove& move, MoveUndo& undo) {
+    int piece = board[move.fromY][move.fromX];
+    
+    // Save the state we are about to change
+    undo.hash = positionHash;
+    undo.halfmoveClock = halfmoveClock;
+    undo.movedPiece = piece;
+    undo.enPassantTarget = enPassantTarget;
+    undo.whiteKingPos = whiteKingPos;
+    undo.blackKingPos = blackKingPos;
+    undo.whiteKingMoved = whiteKingMoved;
+    undo.blackKingMoved = blackKingMoved;
+    undo.whiteRookKingMoved = whiteRookKingMoved;
+    undo.whiteRookQueenMoved = whiteRookQueenMoved;
+    undo.blackRookKingMoved = blackRookKingMoved;
+    undo.blackRookQueenMoved = blackRookQueenMoved;
+    
+    // Capture (en passant takes the pawn beside the target square)
+    undo.capturedX = move.toX;
+    undo.capturedY = move.toY;
+    if (abs(piece) == WHITE_PAWN && move.toX == enPassantTarget.x && move.toY == enPassantTarget.y &&
+        board[move.toY][move.toX] == EMPTY) {
+        undo.capturedY = move.fromY;
     }
+    undo.captured = board[undo.capturedY][undo.capturedX];
+    board[undo.capturedY][undo.capturedX] = EMPTY;
+    int oldRights = CastlingRights();
+    unsigned long long hash = positionHash;
+    if (undo.captured != EMPTY) hash ^= zobrist.piece[undo.captured + 6][undo.capturedY * 8 + undo.capturedX];
     
-    // Special case: castling
-    if (abs(piece) == WHITE_KING && abs(fromCol - toCol) == 2) {
-        return CanCastle(piece > 0 ? 1 : -1, toCol > fromCol);
+    // Move the piece
+    int placed = move.promotion != 0 ? move.promotion : piece;
+    board[move.toY][move.toX] = placed;
+    board[move.fromY][move.fromX] = EMPTY;
+    hash ^= zobrist.piece[piece + 6][move.fromY * 8 + move.fromX] ^ zobrist.piece[placed + 6][move.toY * 8 + move.toX];
+    
+    // Castling also moves the rook
+    if (abs(piece) == WHITE_KING && abs(move.toX - move.fromX) == 2) {
+        int rookFrom = move.toX > move.fromX ? 7 : 0;
+        int rookTo = move.toX > move.fromX ? 5 : 3;
+        int rook = board[move.fromY][rookFrom];
+        board[move.fromY][rookTo] = rook;
+        board[move.fromY][rookFrom] = EMPTY;
+        hash ^= zobrist.piece[rook + 6][move.fromY * 8 + rookFrom] ^ zobrist.piece[rook + 6][move.fromY * 8 + rookTo];
     }
     
-    // Store original positions for validation
-    int savedTarget = target;
- 
-    // Temporarily make the move
-    board[fromRow][fromCol] = EMPTY;
-    board[toRow][toCol] = piece;
+    // En passant target
+    if (enPassantTarget.x >= 0) hash ^= zobrist.enPassant[enPassantTarget.x];
+    enPassantTarget.x = -1;
+    enPassantTarget.y = -1;
+    if (abs(piece) == WHITE_PAWN && abs(move.fromY - move.toY) == 2) {
+        enPassantTarget.x = move.fromX;
+        enPassantTarget.y = (move.fromY + move.toY) / 2;
+    }
     
-    // Update king position if needed
-    POINT savedKingPos;
-    if (abs(piece) == WHITE_KING) {
-        if (piece > 0) {
-            savedKingPos = whiteKingPos;
-            whiteKingPos.x = toCol;
-            whiteKingPos.y = toRow;
-        } else {
-            savedKingPos = blackKingPos;
-            blackKingPos.x = toCol;
-            blackKingPos.y = toRow;
-        }
+    // King position and castling flags
+    if (piece == WHITE_KING) {
+        whiteKingPos.x = move.toX;
+        whiteKingPos.y = move.toY;
+        whiteKingMoved = true;
+    } else if (piece == BLACK_KING) {
+        blackKingPos.x = move.toX;
+        blackKingPos.y = move.toY;
+        blackKingMoved = true;
     }
+    // A rook leaving or being captured on its corner loses that castling side
+    if ((move.fromX == 0 && move.fromY == 7) || (move.toX == 0 && move.toY == 7)) whiteRookQueenMoved = true;
+    if ((move.fromX == 7 && move.fromY == 7) || (move.toX == 7 && move.toY == 7)) whiteRookKingMoved = true;
+    if ((move.fromX == 0 && move.fromY == 0) || (move.toX == 0 && move.toY == 0)) blackRookQueenMoved = true;
+    if ((move.fromX == 7 && move.fromY == 0) || (move.toX == 7 && move.toY == 0)) blackRookKingMoved = true;
     
-    bool inCheckAfterMove = IsInCheck(currentPlayer);
+    if (enPassantTarget.x >= 0) hash ^= zobrist.enPassant[enPassantTarget.x];
+    hash ^= zobrist.castling[oldRights] ^ zobrist.castling[CastlingRights()] ^ zobrist.blackToMove;
+    positionHash = hash;
+    halfmoveClock = (undo.captured != EMPTY || abs(piece) == WHITE_PAWN) ? 0 : halfmoveClock + 1;
     
-    // Undo the move
-    board[fromRow][fromCol] = piece;
-    board[toRow][toCol] = savedTarget;
+    // A long game drops its oldest entries; pops stay in step as they only take the top
+    if (historyCount == HASH_HISTORY_SIZE) {
+        memmove(hashHistory, hashHistory + HASH_HISTORY_SIZE - HASH_HISTORY_KEEP, HASH_HISTORY_KEEP * sizeof(hashHistory[0]));
+        historyCount = HASH_HISTORY_KEEP;
+    }
+    hashHistory[historyCount++] = hash;
     
-    // Restore king position if needed
-    if (abs(piece) == WHITE_KING) {
-        if (piece > 0) {
-            whiteKingPos = savedKingPos;
+    currentPlayer = -currentPlayer;
+    undo.nnueTop = nnueTop;
+    if (engineConfig.nnue) NnueMakeMove(move, undo);
+}
+
+void UnmakeMove(const ChessMove& move, const MoveUndo& undo) {
+    currentPlayer = -currentPlayer;
+    positionHash = undo.hash;
+    halfmoveClock = undo.halfmoveClock;
+    historyCount--;
+    nnueTop = undo.nnueTop;
+    
+    // Castling: put the rook back
+    if (abs(undo.movedPiece) == WHITE_KING && abs(move.toX - move.fromX) == 2) {
+        if (move.toX > move.fromX) {
+            board[move.fromY][7] = board[move.fromY][5];
+            board[move.fromY][5] = EMPTY;
         } else {
-            blackKingPos = savedKingPos;
+            board[move.fromY][0] = board[move.fromY][3];
+            board[move.fromY][3] = EMPTY;
         }
     }
     
-    return !inCheckAfterMove;
-}
-bool IsCaptureMove(int fromCol, int fromRow, int toCol, int toRow) {
-    int piece = board[fromRow][fromCol];
-    int target = board[toRow][toCol];
+    board[move.fromY][move.fromX] = undo.movedPiece;
+    board[move.toY][move.toX] = EMPTY;
+    board[undo.capturedY][undo.capturedX] = undo.captured;
     
-    // Normal capture
-    if (target != EMPTY && piece * target < 0) return true;
-    
-    // En passant
-    if (abs(piece) == WHITE_PAWN && toCol == enPassantTarget.x && toRow == enPassantTarget.y) {
-        return true;
+    enPassantTarget = undo.enPassantTarget;
+    whiteKingPos = undo.whiteKingPos;
+    blackKingPos = undo.blackKingPos;
+    whiteKingMoved = undo.whiteKingMoved;
+    blackKingMoved = undo.blackKingMoved;
+    whiteRookKingMoved = undo.whiteRookKingMoved;
+    whiteRookQueenMoved = undo.whiteRookQueenMoved;
+    blackRookKingMoved = undo.blackRookKingMoved;
+    blackRookQueenMoved = undo.blackRookQueenMoved;
+}
+
+int CastlingRights() {
+    return (!whiteKingMoved && !whiteRookKingMoved) | (!whiteKingMoved && !whiteRookQueenMoved) << 1 |
+           (!blackKingMoved && !blackRookKingMoved) << 2 | (!blackKingMoved && !blackRookQueenMoved) << 3;
+}
+
+// Hash of the position from scratch, the value MakeMove() maintains incrementally
+unsigned long long ComputePositionHash() {
+    unsigned long long hash = 0;
+    for (int y = 0; y < 8; y++) {
+        for (int x = 0; x < 8; x++) {
+            if (board[y][x] != EMPTY) hash ^= zobrist.piece[board[y][x] + 6][y * 8 + x];
+        }
+    }
+    if (currentPlayer == -1) hash ^= zobrist.blackToMove;
+    if (enPassantTarget.x >= 0) hash ^= zobrist.enPassant[enPassantTarget.x];
+    return hash ^ zobrist.castling[CastlingRights()];
+}
+
+// Starts the history at the current position (new game, FEN)
+void StartHashHistory() {
+    positionHash = ComputePositionHash();
+    hashHistory[0] = positionHash;
+    historyCount = 1;
+}
+
+// For moves made outside MakeMove() (the GUI's MovePiece() and promotion choice):
+// rehashes the position and pushes it
+void RecordGameMove(bool irreversible) {
+    halfmoveClock = irreversible ? 0 : halfmoveClock + 1;
+    positionHash = ComputePositionHash();
+    if (historyCount == HASH_HISTORY_SIZE) {
+        memmove(hashHistory, hashHistory + HASH_HISTORY_SIZE - HASH_HISTORY_KEEP, HASH_HISTORY_KEEP * sizeof(hashHistory[0]));
+        historyCount = HASH_HISTORY_KEEP;
+    }
+    hashHistory[historyCount++] = positionHash;
+}
+
+// Earlier occurrences of the current position. Only positions since the last capture or
+// pawn move can match, and only every second one has the same side to move.
+int CountRepetitions() {
+    int count = 0;
+    int stop = Max(historyCount - 1 - halfmoveClock, 0);
+    for (int i = historyCount - 3; i >= stop; i -= 2) {
+        if (hashHistory[i] == positionHash) count++;
+    }
+    return count;
+}
+
+// Draw for the search: fifty-move rule, or any repetition. Inside the search one earlier
+// occurrence is enough, a side that can repeat once can repeat again.
+bool IsDrawByRule() {
+    if (halfmoveClock >= 100) return true;
+    int stop = Max(historyCount - 1 - halfmoveClock, 0);
+    for (int i = historyCount - 3; i >= stop; i -= 2) {
+        if (hashHistory[i] == positionHash) return true;
     }
-    
     return false;
 }
 
@@ -1128,6 +2383,27 @@ void SortMoves(ChessMove moves[], int moveCount) {
     }
 }
 
+// Quiet moves, after the captures SortMoves() put first, by their cutoff history: with
+// late-move pruning the generation order would decide which moves are skipped
+void SortQuietMoves(ChessMove moves[], int moveCount, int player) {
+    int (*history)[64] = quietHistory[player == 1 ? 0 : 1];
+    int first = 0;
+    while (first < moveCount && moves[first].score > 0) first++;
+    for (int i = first; i < moveCount; i++) {
+        moves[i].score = history[moves[i].fromY * 8 + moves[i].fromX][moves[i].toY * 8 + moves[i].toX];
+    }
+    // Insertion sort, stable for equal history
+    for (int i = first + 1; i < moveCount; i++) {
+        ChessMove move = moves[i];
+        int j = i;
+        while (j > first && moves[j - 1].score < move.score) {
+            moves[j] = moves[j - 1];
+            j--;
+        }
+        moves[j] = move;
+    }
+}
+
 GamePhase DetectGamePhase() {
     int pieceCount = 0;
     int queenCount = 0;
@@ -1150,70 +2426,91 @@ GamePhase DetectGamePhase() {
 }
 
 int EvaluatePosition() {
+    STATS_TIMER(evaluatePosition);
+    int terms[EVAL_PARAM_COUNT];
+    EvaluationTerms(terms);
+    const int* weights = engineConfig.evalWeights;
     int score = 0;
+    for (int i = 0; i < EVAL_PARAM_COUNT; i++) score += weights[i] * terms[i];
+    return score;
+}
+
+// How often each weight counts in the current position, white-relative
+void EvaluationTerms(int terms[EVAL_PARAM_COUNT]) {
+    for (int i = 0; i < EVAL_PARAM_COUNT; i++) terms[i] = 0;
     
-    // Material evaluation
-    const int pieceValues[] = {0, 500, 300, 300, 900, 20000, 100};
+    // Material evaluation (the king only counts once the quiescence search has taken one)
     for (int y = 0; y < 8; y++) {
         for (int x = 0; x < 8; x++) {
             int piece = board[y][x];
             if (piece != EMPTY) {
-                score += pieceValues[abs(piece)] * (piece > 0 ? 1 : -1);
+                terms[EVAL_ROOK + abs(piece) - 1] += (piece > 0 ? 1 : -1);
             }
         }
     }
     
-    // Strategic components
-    score += CalculateMobility(currentPlayer) * 2;
-    score += CalculateKingSafety(currentPlayer);
-    score += EvaluatePawnStructure(currentPlayer);
+    // Strategic components for the side to move, signed so the score stays white-relative
+    terms[EVAL_MOBILITY] += currentPlayer * CalculateMobility(currentPlayer);
+    AddKingSafetyTerms(currentPlayer, currentPlayer, terms);
+    AddPawnStructureTerms(currentPlayer, currentPlayer, terms);
     
     // King's Indian Defense evaluation
-    score += EvaluateKingIndianDefense(currentPlayer);
+    AddKingIndianTerms(currentPlayer, currentPlayer, terms);
     
     // Positional bonuses
     GamePhase phase = DetectGamePhase();
     if (phase == OPENING) {
         // Encourage development and center control
-        score += (CountCenterControl(1) - CountCenterControl(-1)) * 10;
+        terms[EVAL_CENTER_CONTROL] += CountCenterControl(1) - CountCenterControl(-1);
     }
     else if (phase == MIDGAME) {
         // Encourage king safety and piece activity
-        score += (CalculateKingSafety(1) - CalculateKingSafety(-1));
+        AddKingSafetyTerms(1, 1, terms);
+        AddKingSafetyTerms(-1, -1, terms);
     }
     else { // ENDGAME
-        // Encourage king centralization and pawn promotion
-        score += (7 - abs(whiteKingPos.x - 3.5) - abs(whiteKingPos.y - 3.5)) * 5;
-        score -= (7 - abs(blackKingPos.x - 3.5) - abs(blackKingPos.y - 3.5)) * 5;
+        // Encourage king centralization: 7 minus the distance to the centre, 0..6
+        terms[EVAL_KING_CENTER] += 7 - (abs(2 * whiteKingPos.x - 7) + abs(2 * whiteKingPos.y - 7)) / 2;
+        terms[EVAL_KING_CENTER] -= 7 - (abs(2 * blackKingPos.x - 7) + abs(2 * blackKingPos.y - 7)) / 2;
     }
-    
-    return score;
 }
 
-int CalculateMobility(int player) {
-    int mobility = 0;
-    
-    for (int y = 0; y < 8; y++) {
-        for (int x = 0; x < 8; x++) {
-            if (board[y][x] != EMPTY && 
-                ((player == 1 && board[y][x] > 0) || 
-                 (player == -1 && board[y][x] < 0))) {
-                
-                for (int ty = 0; ty < 8; ty++) {
-                    for (int tx = 0; tx < 8; tx++) {
-                        if (IsValidMoveWithoutCheck(x, y, tx, ty)) {
-                            mobility++;
-                        }
-                    }
-                }
-            }
+// Weights file: one "name value" line per weight, '#' starts a comment. Weights the file
+// leaves out keep their default. False if the file is missing or names an unknown weight.
+bool LoadEvalWeights(const char* path, int weights[EVAL_PARAM_COUNT]) {
+    FILE* file = fopen(path, "r");
+    if (!file) return false;
+    for (int i = 0; i < EVAL_PARAM_COUNT; i++) weights[i] = defaultEvalWeights[i];
+    char line[256];
+    bool ok = true;
+    while (ok && fgets(line, sizeof(line), file)) {
+        char name[64];
+        int value;
+        if (line[0] == '#' || sscanf(line, "%63s", name) != 1) continue;
+        ok = sscanf(line, "%63s %d", name, &value) == 2;
+        int index = -1;
+        for (int i = 0; i < EVAL_PARAM_COUNT && ok; i++) {
+            if (strcmp(name, evalParamNames[i]) == 0) index = i;
         }
+        if (index < 0) ok = false;
+        else weights[index] = value;
     }
-    return mobility;
+    fclose(file);
+    return ok;
+}
+
+bool SaveEvalWeights(const char* path, const int weights[EVAL_PARAM_COUNT]) {
+    FILE* file = fopen(path, "w");
+    if (!file) return false;
+    for (int i = 0; i < EVAL_PARAM_COUNT; i++) fprintf(file, "%s %d\n", evalParamNames[i], weights[i]);
+    return fclose(file) == 0;
 }
 
-int CalculateKingSafety(int player) {
-    int safety = 0;
+int CalculateMobility(int player) {
+    return player == 1 ? CountMobility<1>() : CountMobility<-1>();
+}
+
+void AddKingSafetyTerms(int player, int sign, int terms[EVAL_PARAM_COUNT]) {
     POINT kingPos = (player == 1) ? whiteKingPos : blackKingPos;
     
     // Count pawns near king
@@ -1230,14 +2527,12 @@ int CalculateKingSafety(int player) {
             }
         }
     }
-    safety += pawnShield * 20;
+    terms[EVAL_PAWN_SHIELD] += sign * pawnShield;
     
     // Penalize exposed king
     if (pawnShield < 3) {
-        safety -= (3 - pawnShield) * 30;
+        terms[EVAL_KING_EXPOSED] -= sign * (3 - pawnShield);
     }
-    
-    return safety;
 }
 
 int CountBishopMoves(int x, int y) {
@@ -1284,203 +2579,609 @@ int CountCenterControl(int player) {
     return centerControl;
 }
 
-// Add this function to generate capture moves
-void GenerateCaptureMoves(int player, ChessMove moves[], int &moveCount) {
-    moveCount = 0;
-    
-    for (int fromY = 0; fromY < 8; fromY++) {
-        for (int fromX = 0; fromX < 8; fromX++) {
-            if (board[fromY][fromX] != EMPTY && 
-                ((player == 1 && board[fromY][fromX] > 0) || 
-                 (player == -1 && board[fromY][fromX] < 0))) {
-                
-                for (int toY = 0; toY < 8; toY++) {
-                    for (int toX = 0; toX < 8; toX++) {
-                        if (IsValidMove(fromX, fromY, toX, toY) && 
-                            IsCaptureMove(fromX, fromY, toX, toY)) {
-                            moves[moveCount].fromX = fromX;
-                            moves[moveCount].fromY = fromY;
-                            moves[moveCount].toX = toX;
-                            moves[moveCount].toY = toY;
-                            moves[moveCount].promotion = 0;
-                            
-                            // Handle pawn promotion
-                            if (abs(board[fromY][fromX]) == WHITE_PAWN && 
-                                (toY == 0 || toY == 7)) {
-                                moves[moveCount].promotion = (player == 1) ? WHITE_QUEEN : BLACK_QUEEN;
-                            }
-                            
-                            moveCount++;
-                        }
-                    }
-                }
-            }
+// ---------------------------------------------------------------------------
+// NNUE evaluation
+// ---------------------------------------------------------------------------
+
+#if defined(__GNUC__) || defined(__clang__)
+#define NNUE_TARGET(isa) __attribute__((target(isa)))
+#else
+#define NNUE_TARGET(isa)
+#endif
+
+// Feature of 'piece' on square y * 8 + x seen from 'perspective' (0 white, 1 black): black
+// sees the board flipped, so both sides find their own pieces on the bottom ranks
+static inline int NnueFeature(int perspective, int piece, int square) {
+    int own = (piece > 0) == (perspective == 0) ? 0 : 1;
+    if (perspective == 1) square ^= 56;
+    return (own * 6 + abs(piece) - 1) * 64 + square;
+}
+
+static void NnueUpdateScalar(int16_t* acc, const int16_t* parent, const int* added, int addCount,
+                             const int* removed, int removeCount) {
+    for (int i = 0; i < NNUE_HIDDEN; i++) acc[i] = parent[i];
+    for (int f = 0; f < addCount; f++) {
+        const int16_t* row = nnueNet.ftWeights + added[f] * NNUE_HIDDEN;
+        for (int i = 0; i < NNUE_HIDDEN; i++) acc[i] += row[i];
+    }
+    for (int f = 0; f < removeCount; f++) {
+        const int16_t* row = nnueNet.ftWeights + removed[f] * NNUE_HIDDEN;
+        for (int i = 0; i < NNUE_HIDDEN; i++) acc[i] -= row[i];
+    }
+}
+
+static void NnueAffineScalar(const uint8_t* input, int inputs, const int8_t* weights, const int32_t* bias,
+                             int32_t* output, int outputs) {
+    for (int o = 0; o < outputs; o++) {
+        const int8_t* row = weights + o * inputs;
+        int32_t sum = bias[o];
+        for (int i = 0; i < inputs; i++) sum += input[i] * row[i];
+        output[o] = sum;
+    }
+}
+
+#ifdef NNUE_X86
+NNUE_TARGET("sse4.1")
+static void NnueUpdateSse41(int16_t* acc, const int16_t* parent, const int* added, int addCount,
+                            const int* removed, int removeCount) {
+    for (int i = 0; i < NNUE_HIDDEN; i += 8) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(parent + i));
+        for (int f = 0; f < addCount; f++) {
+            v = _mm_add_epi16(v, _mm_loadu_si128((const __m128i*)(nnueNet.ftWeights + added[f] * NNUE_HIDDEN + i)));
+        }
+        for (int f = 0; f < removeCount; f++) {
+            v = _mm_sub_epi16(v, _mm_loadu_si128((const __m128i*)(nnueNet.ftWeights + removed[f] * NNUE_HIDDEN + i)));
         }
+        _mm_storeu_si128((__m128i*)(acc + i), v);
     }
 }
 
-// Add this function to sort capture moves
-void SortCaptures(ChessMove moves[], int moveCount) {
-    // Simple ordering - prioritize captures of valuable pieces
-    for (int i = 0; i < moveCount; i++) {
-        int targetPiece = abs(board[moves[i].toY][moves[i].toX]);
-        int attackerPiece = abs(board[moves[i].fromY][moves[i].fromX]);
-        
-        // Use MVV-LVA (Most Valuable Victim - Least Valuable Attacker)
-        moves[i].score = (targetPiece * 10) - attackerPiece;
+// u8 x i8 pairs summed to i16 (cannot saturate, inputs are at most 127), then to i32
+NNUE_TARGET("sse4.1")
+static void NnueAffineSse41(const uint8_t* input, int inputs, const int8_t* weights, const int32_t* bias,
+                            int32_t* output, int outputs) {
+    const __m128i ones = _mm_set1_epi16(1);
+    for (int o = 0; o < outputs; o++) {
+        const int8_t* row = weights + o * inputs;
+        __m128i sum = _mm_setzero_si128();
+        for (int i = 0; i < inputs; i += 16) {
+            __m128i in = _mm_loadu_si128((const __m128i*)(input + i));
+            __m128i w = _mm_loadu_si128((const __m128i*)(row + i));
+            sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_maddubs_epi16(in, w), ones));
+        }
+        sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+        sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+        output[o] = bias[o] + _mm_cvtsi128_si32(sum);
     }
-    
-    // Bubble sort by score (high to low)
-    for (int i = 0; i < moveCount-1; i++) {
-        for (int j = i+1; j < moveCount; j++) {
-            if (moves[i].score < moves[j].score) {
-                ChessMove temp = moves[i];
-                moves[i] = moves[j];
-                moves[j] = temp;
-            }
+}
+
+NNUE_TARGET("avx2")
+static void NnueUpdateAvx2(int16_t* acc, const int16_t* parent, const int* added, int addCount,
+                           const int* removed, int removeCount) {
+    for (int i = 0; i < NNUE_HIDDEN; i += 16) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(parent + i));
+        for (int f = 0; f < addCount; f++) {
+            v = _mm256_add_epi16(v, _mm256_loadu_si256((const __m256i*)(nnueNet.ftWeights + added[f] * NNUE_HIDDEN + i)));
         }
+        for (int f = 0; f < removeCount; f++) {
+            v = _mm256_sub_epi16(v, _mm256_loadu_si256((const __m256i*)(nnueNet.ftWeights + removed[f] * NNUE_HIDDEN + i)));
+        }
+        _mm256_storeu_si256((__m256i*)(acc + i), v);
     }
 }
 
-int QuiescenceSearch(int alpha, int beta, int player) {
-    int standPat = EvaluatePosition();
-    
-    if (player == 1) {
-        if (standPat >= beta) return beta;
-        alpha = Max(alpha, standPat);
-    } else {
-        if (standPat <= alpha) return alpha;
-        beta = Min(beta, standPat);
+NNUE_TARGET("avx2")
+static void NnueAffineAvx2(const uint8_t* input, int inputs, const int8_t* weights, const int32_t* bias,
+                           int32_t* output, int outputs) {
+    const __m256i ones = _mm256_set1_epi16(1);
+    for (int o = 0; o < outputs; o++) {
+        const int8_t* row = weights + o * inputs;
+        __m256i sum = _mm256_setzero_si256();
+        for (int i = 0; i < inputs; i += 32) {
+            __m256i in = _mm256_loadu_si256((const __m256i*)(input + i));
+            __m256i w = _mm256_loadu_si256((const __m256i*)(row + i));
+            sum = _mm256_add_epi32(sum, _mm256_madd_epi16(_mm256_maddubs_epi16(in, w), ones));
+        }
+        __m128i half = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+        half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0x4E));
+        half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0xB1));
+        output[o] = bias[o] + _mm_cvtsi128_si32(half);
     }
-    
-    // Generate capture moves
-    ChessMove captureMoves[64];
+}
+
+static bool CpuHasSse41() {
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 19)) != 0;
+#else
+    return __builtin_cpu_supports("sse4.1");
+#endif
+}
+
+static bool CpuHasAvx2() {
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 1);
+    bool osSavesYmm = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 6) == 6; // OSXSAVE, XMM+YMM state
+    __cpuidex(info, 7, 0);
+    return osSavesYmm && (info[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+#endif
+
+const NnueKernels nnueKernelSets[] = {
+#ifdef NNUE_X86
+    {"avx2", NnueUpdateAvx2, NnueAffineAvx2},
+    {"sse4.1", NnueUpdateSse41, NnueAffineSse41},
+#endif
+    {"scalar", NnueUpdateScalar, NnueAffineScalar},
+};
+const int nnueKernelSetCount = sizeof(nnueKernelSets) / sizeof(nnueKernelSets[0]);
+
+static bool NnueKernelsSupported(const NnueKernels& kernels) {
+#ifdef NNUE_X86
+    if (kernels.update == NnueUpdateAvx2) return CpuHasAvx2();
+    if (kernels.update == NnueUpdateSse41) return CpuHasSse41();
+#endif
+    return kernels.update == NnueUpdateScalar;
+}
+
+// Picks a kernel set by name ("avx2", "sse4.1", "scalar"), false if the CPU lacks it
+bool NnueSelectKernels(const char* name) {
+    for (int i = 0; i < nnueKernelSetCount; i++) {
+        if (strcmp(nnueKernelSets[i].name, name) == 0 && NnueKernelsSupported(nnueKernelSets[i])) {
+            nnueKernels = nnueKernelSets[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+// Best kernels for this CPU and the built-in network; call once before any thread starts
+void NnueInit() {
+    for (int i = 0; i < nnueKernelSetCount; i++) {
+        if (NnueKernelsSupported(nnueKernelSets[i])) {
+            nnueKernels = nnueKernelSets[i];
+            break;
+        }
+    }
+    NnueSetDefaultNetwork();
+}
+
+// Value of one of the own pieces (type 0-5 as in Piece, minus one) on a square of the
+// perspective's board, moving up: material plus a little advancement and centralization
+static int NnueDefaultPieceValue(int type, int square) {
+    const int values[6] = {500, 300, 300, 900, 0, 100};
+    int x = square % 8, y = square / 8;
+    int center = 6 - (abs(2 * x - 7) + abs(2 * y - 7)) / 2; // 0 in a corner, 6 in the middle
+    switch (type + 1) {
+        case WHITE_KNIGHT: return values[type] + center * 5;
+        case WHITE_BISHOP: return values[type] + center * 3;
+        case WHITE_QUEEN: return values[type] + center;
+        case WHITE_KING: return y == 7 ? 10 : 0;
+        case WHITE_PAWN: return values[type] + (6 - y) * 5;
+        default: return values[type];
+    }
+}
+
+// Built-in network, used until a trained one is loaded: the PSQT bypass holds material
+// and piece-square values, the hidden layers are zero and add nothing
+void NnueSetDefaultNetwork() {
+    memset(&nnueNet, 0, sizeof(nnueNet));
+    for (int type = 0; type < 6; type++) {
+        for (int square = 0; square < 64; square++) {
+            nnueNet.ftPsqt[type * 64 + square] = NnueDefaultPieceValue(type, square);
+            nnueNet.ftPsqt[(6 + type) * 64 + square] = -NnueDefaultPieceValue(type, square ^ 56);
+        }
+    }
+    nnueNetHash = NnueNetworkHash();
+}
+
+// Weights file: "CNUE", version and layer sizes as int32, then the NnueNetwork arrays in
+// declaration order, little-endian
+const char NNUE_MAGIC[4] = {'C', 'N', 'U', 'E'};
+const int32_t NNUE_VERSION = 1;
+
+static bool NnueReadArray(FILE* file, void* data, size_t size, size_t count) {
+    return fread(data, size, count, file) == count;
+}
+
+bool NnueLoad(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (!file) return false;
+    char magic[4];
+    int32_t header[4];
+    static NnueNetwork loaded; // Large; filled completely before it replaces nnueNet
+    bool ok = fread(magic, 1, 4, file) == 4 && memcmp(magic, NNUE_MAGIC, 4) == 0 &&
+              NnueReadArray(file, header, sizeof(int32_t), 4) && header[0] == NNUE_VERSION &&
+              header[1] == NNUE_HIDDEN && header[2] == NNUE_L1 && header[3] == NNUE_L2 &&
+              NnueReadArray(file, loaded.ftBias, sizeof(int16_t), NNUE_HIDDEN) &&
+              NnueReadArray(file, loaded.ftWeights, sizeof(int16_t), NNUE_FEATURES * NNUE_HIDDEN) &&
+              NnueReadArray(file, loaded.ftPsqt, sizeof(int32_t), NNUE_FEATURES) &&
+              NnueReadArray(file, loaded.l1Bias, sizeof(int32_t), NNUE_L1) &&
+              NnueReadArray(file, loaded.l1Weights, 1, NNUE_L1 * 2 * NNUE_HIDDEN) &&
+              NnueReadArray(file, loaded.l2Bias, sizeof(int32_t), NNUE_L2) &&
+              NnueReadArray(file, loaded.l2Weights, 1, NNUE_L2 * NNUE_L1) &&
+              NnueReadArray(file, &loaded.outBias, sizeof(int32_t), 1) &&
+              NnueReadArray(file, loaded.outWeights, 1, NNUE_L2) &&
+              fgetc(file) == EOF;
+    fclose(file);
+    if (ok) {
+        memcpy(&nnueNet, &loaded, sizeof(nnueNet));
+        nnueNetHash = NnueNetworkHash();
+    }
+    return ok;
+}
+
+bool NnueSave(const char* path) {
+    FILE* file = fopen(path, "wb");
+    if (!file) return false;
+    int32_t header[4] = {NNUE_VERSION, NNUE_HIDDEN, NNUE_L1, NNUE_L2};
+    bool ok = fwrite(NNUE_MAGIC, 1, 4, file) == 4 &&
+              fwrite(header, sizeof(int32_t), 4, file) == 4 &&
+              fwrite(nnueNet.ftBias, sizeof(int16_t), NNUE_HIDDEN, file) == (size_t)NNUE_HIDDEN &&
+              fwrite(nnueNet.ftWeights, sizeof(int16_t), NNUE_FEATURES * NNUE_HIDDEN, file) == (size_t)(NNUE_FEATURES * NNUE_HIDDEN) &&
+              fwrite(nnueNet.ftPsqt, sizeof(int32_t), NNUE_FEATURES, file) == (size_t)NNUE_FEATURES &&
+              fwrite(nnueNet.l1Bias, sizeof(int32_t), NNUE_L1, file) == (size_t)NNUE_L1 &&
+              fwrite(nnueNet.l1Weights, 1, NNUE_L1 * 2 * NNUE_HIDDEN, file) == (size_t)(NNUE_L1 * 2 * NNUE_HIDDEN) &&
+              fwrite(nnueNet.l2Bias, sizeof(int32_t), NNUE_L2, file) == (size_t)NNUE_L2 &&
+              fwrite(nnueNet.l2Weights, 1, NNUE_L2 * NNUE_L1, file) == (size_t)(NNUE_L2 * NNUE_L1) &&
+              fwrite(&nnueNet.outBias, sizeof(int32_t), 1, file) == 1 &&
+              fwrite(nnueNet.outWeights, 1, NNUE_L2, file) == (size_t)NNUE_L2;
+    return fclose(file) == 0 && ok;
+}
+
+// Accumulators of the current position from scratch
+void NnueRefresh(NnueAccumulator& acc) {
+    for (int perspective = 0; perspective < 2; perspective++) {
+        int features[32];
+        int count = 0;
+        acc.psqt[perspective] = 0;
+        for (int y = 0; y < 8; y++) {
+            for (int x = 0; x < 8; x++) {
+                if (board[y][x] == EMPTY || count == 32) continue;
+                features[count] = NnueFeature(perspective, board[y][x], y * 8 + x);
+                acc.psqt[perspective] += nnueNet.ftPsqt[features[count++]];
+            }
+        }
+        nnueKernels.update(acc.values[perspective], nnueNet.ftBias, features, count, NULL, 0);
+    }
+    acc.key = positionHash;
+    acc.valid = true;
+}
+
+// Called at the end of MakeMove(): the child accumulator is the parent's with the moved,
+// captured and castling rook features swapped. Without a usable parent the child is left
+// invalid and NnueEvaluate() refreshes it if it is ever needed.
+void NnueMakeMove(const ChessMove& move, const MoveUndo& undo) {
+    if (nnueTop + 1 >= NNUE_STACK_SIZE) {
+        nnueTop = 0;
+        nnueStack[0].valid = false;
+        return;
+    }
+    const NnueAccumulator& parent = nnueStack[nnueTop];
+    NnueAccumulator& acc = nnueStack[++nnueTop];
+    if (!parent.valid || parent.key != undo.hash) {
+        acc.valid = false;
+        return;
+    }
+    
+    int addedPieces[2], addedSquares[2], removedPieces[3], removedSquares[3];
+    int addCount = 0, removeCount = 0;
+    removedPieces[removeCount] = undo.movedPiece;
+    removedSquares[removeCount++] = move.fromY * 8 + move.fromX;
+    addedPieces[addCount] = board[move.toY][move.toX];
+    addedSquares[addCount++] = move.toY * 8 + move.toX;
+    if (undo.captured != EMPTY) {
+        removedPieces[removeCount] = undo.captured;
+        removedSquares[removeCount++] = undo.capturedY * 8 + undo.capturedX;
+    }
+    if (abs(undo.movedPiece) == WHITE_KING && abs(move.toX - move.fromX) == 2) {
+        int rookFrom = move.toX > move.fromX ? 7 : 0;
+        int rookTo = move.toX > move.fromX ? 5 : 3;
+        removedPieces[removeCount] = board[move.fromY][rookTo];
+        removedSquares[removeCount++] = move.fromY * 8 + rookFrom;
+        addedPieces[addCount] = board[move.fromY][rookTo];
+        addedSquares[addCount++] = move.fromY * 8 + rookTo;
+    }
+    
+    for (int perspective = 0; perspective < 2; perspective++) {
+        int added[2], removed[3];
+        acc.psqt[perspective] = parent.psqt[perspective];
+        for (int i = 0; i < addCount; i++) {
+            added[i] = NnueFeature(perspective, addedPieces[i], addedSquares[i]);
+            acc.psqt[perspective] += nnueNet.ftPsqt[added[i]];
+        }
+        for (int i = 0; i < removeCount; i++) {
+            removed[i] = NnueFeature(perspective, removedPieces[i], removedSquares[i]);
+            acc.psqt[perspective] -= nnueNet.ftPsqt[removed[i]];
+        }
+        nnueKernels.update(acc.values[perspective], parent.values[perspective], added, addCount, removed, removeCount);
+    }
+    acc.key = positionHash;
+    acc.valid = true;
+}
+
+static inline uint8_t NnueClip(int32_t value) {
+    return (uint8_t)(value < 0 ? 0 : value > 127 ? 127 : value);
+}
+
+// Network score of the current position, white-relative like EvaluatePosition()
+int NnueEvaluate() {
+    STATS_TIMER(evaluatePosition);
+    NnueAccumulator& acc = nnueStack[nnueTop];
+    if (!acc.valid || acc.key != positionHash) NnueRefresh(acc);
+    int us = currentPlayer == 1 ? 0 : 1;
+    
+    alignas(32) uint8_t input[2 * NNUE_HIDDEN];
+    for (int i = 0; i < NNUE_HIDDEN; i++) {
+        input[i] = NnueClip(acc.values[us][i]);
+        input[NNUE_HIDDEN + i] = NnueClip(acc.values[1 - us][i]);
+    }
+    alignas(32) int32_t l1[NNUE_L1], l2[NNUE_L2];
+    alignas(32) uint8_t hidden1[NNUE_L1], hidden2[NNUE_L2];
+    nnueKernels.affine(input, 2 * NNUE_HIDDEN, nnueNet.l1Weights, nnueNet.l1Bias, l1, NNUE_L1);
+    for (int i = 0; i < NNUE_L1; i++) hidden1[i] = NnueClip(l1[i] >> NNUE_WEIGHT_SHIFT);
+    nnueKernels.affine(hidden1, NNUE_L1, nnueNet.l2Weights, nnueNet.l2Bias, l2, NNUE_L2);
+    for (int i = 0; i < NNUE_L2; i++) hidden2[i] = NnueClip(l2[i] >> NNUE_WEIGHT_SHIFT);
+    int32_t output;
+    nnueKernels.affine(hidden2, NNUE_L2, nnueNet.outWeights, &nnueNet.outBias, &output, 1);
+    
+    int score = (acc.psqt[us] - acc.psqt[1 - us]) / 2 + output / NNUE_OUTPUT_SCALE;
+    return currentPlayer * score;
+}
+
+// Add this function to generate capture moves
+void GenerateCaptureMoves(int player, ChessMove moves[], int &moveCount) {
+    STATS_TIMER(generateCaptureMoves);
+    if (player == 1) GenerateMoves<1, GEN_CAPTURES>(moves, moveCount);
+    else GenerateMoves<-1, GEN_CAPTURES>(moves, moveCount);
+}
+
+// Add this function to sort capture moves
+void SortCaptures(ChessMove moves[], int moveCount) {
+    // Simple ordering - prioritize captures of valuable pieces
+    // Values in pawns by abs(piece); the Piece numbering (pawn last) is no value order
+    static const int captureValues[7] = {0, 5, 3, 3, 9, 100, 1};
+    for (int i = 0; i < moveCount; i++) {
+        int targetPiece = abs(board[moves[i].toY][moves[i].toX]);
+        int attackerPiece = abs(board[moves[i].fromY][moves[i].fromX]);
+        
+        // Use MVV-LVA (Most Valuable Victim - Least Valuable Attacker)
+        moves[i].score = captureValues[targetPiece] * 100 - captureValues[attackerPiece];
+    }
+    
+    // Bubble sort by score (high to low)
+    for (int i = 0; i < moveCount-1; i++) {
+        for (int j = i+1; j < moveCount; j++) {
+            if (moves[i].score < moves[j].score) {
+                ChessMove temp = moves[i];
+                moves[i] = moves[j];
+                moves[j] = temp;
+            }
+        }
+    }
+}
+
+// Search bodies are templated on the side to move (1 white maximizes, -1 black minimizes)
+// so each instantiation calls its own specialized generator directly
+template <int Side>
+int QuiescenceSearchT(int alpha, int beta) {
+    STATS_INC(qnodes);
+    searchNodes++;
+    int standPat = engineConfig.nnue ? NnueEvaluate() : EvaluatePosition();
+    
+    if (Side == 1) {
+        if (standPat >= beta) {
+            STATS_INC(qStandPatCutoffs);
+            return beta;
+        }
+        alpha = Max(alpha, standPat);
+    } else {
+        if (standPat <= alpha) {
+            STATS_INC(qStandPatCutoffs);
+            return alpha;
+        }
+        beta = Min(beta, standPat);
+    }
+    
+    // Generate capture moves
+    ChessMove captureMoves[256];
     int captureCount = 0;
-    GenerateCaptureMoves(player, captureMoves, captureCount);
+    {
+        STATS_TIMER(generateCaptureMoves);
+        GenerateMoves<Side, GEN_CAPTURES>(captureMoves, captureCount);
+    }
     
     // Sort captures by most valuable victim first
     SortCaptures(captureMoves, captureCount);
     
     for (int i = 0; i < captureCount; i++) {
         // Make the capture move
-        int captured = board[captureMoves[i].toY][captureMoves[i].toX];
-        int movedPiece = board[captureMoves[i].fromY][captureMoves[i].fromX];
-        board[captureMoves[i].toY][captureMoves[i].toX] = movedPiece;
-        board[captureMoves[i].fromY][captureMoves[i].fromX] = EMPTY;
+        MoveUndo undo;
+        MakeMove(captureMoves[i], undo);
         
-        // Recursive call
-        int score = -QuiescenceSearch(-beta, -alpha, -player);
+        // Recursive call (scores are from white's point of view, like Minimax)
+        int score = QuiescenceSearchT<-Side>(alpha, beta);
         
         // Undo move
-        board[captureMoves[i].fromY][captureMoves[i].fromX] = movedPiece;
-        board[captureMoves[i].toY][captureMoves[i].toX] = captured;
+        UnmakeMove(captureMoves[i], undo);
         
-        if (player == 1) {
-            if (score >= beta) return beta;
+        if (Side == 1) {
+            if (score >= beta) {
+                STATS_INC(qBetaCutoffs);
+                return beta;
+            }
             if (score > alpha) alpha = score;
         } else {
-            if (score <= alpha) return alpha;
+            if (score <= alpha) {
+                STATS_INC(qBetaCutoffs);
+                return alpha;
+            }
             if (score < beta) beta = score;
         }
     }
     
-    return (player == 1) ? alpha : beta;
+    return (Side == 1) ? alpha : beta;
 }
 
-int Minimax(int depth, int alpha, int beta, bool maximizingPlayer) {
+int QuiescenceSearch(int alpha, int beta, int player) {
+    return player == 1 ? QuiescenceSearchT<1>(alpha, beta) : QuiescenceSearchT<-1>(alpha, beta);
+}
+
+// Static evaluation for the pruning decisions, from Side's point of view, as the leaves of
+// a 'depth'-ply search score the position. The strategic terms only count for the side to
+// move, which at odd depths is the opponent: this node's own evaluation would sit both
+// sides' terms (about 160 cp) above what its search returns.
+template <int Side>
+int PruningEval(int depth) {
+    if (depth % 2 != 0) currentPlayer = -currentPlayer;
+    int eval = engineConfig.nnue ? NnueEvaluate() : EvaluatePosition();
+    currentPlayer = Side;
+    return Side * eval;
+}
+
+template <int Side>
+int MinimaxT(int depth, int alpha, int beta) {
+    STATS_INC(nodes);
+    searchNodes++;
+    if (searchStop != NULL && searchStop->load(std::memory_order_relaxed)) return 0; // Result is thrown away
+    if (searchDeadlineUs != 0 && --timeCheckCountdown <= 0) {
+        timeCheckCountdown = 1024;
+        if (SteadyMicros() >= searchDeadlineUs) searchTimedOut = true;
+    }
+    if (searchTimedOut) return 0;
+    // Cycles and fifty-move lines score as draws right away instead of being searched
+    if (IsDrawByRule()) {
+        STATS_INC(drawsByRule);
+        return 0;
+    }
     if (depth == 0) {
-        return QuiescenceSearch(alpha, beta, maximizingPlayer ? 1 : -1);
+        return QuiescenceSearchT<Side>(alpha, beta);
     }
-
     
+    // In check only evasions are generated, which also settles mate and stalemate below
+    const POINT& king = (Side == 1) ? whiteKingPos : blackKingPos;
+    bool inCheck = IsAttackedBy<-Side>(king.x, king.y);
+
+    // Forward pruning, in the side to move's terms: 'low'/'high' are the window and
+    // 'staticEval' the evaluation from its point of view, see PruningEval(). Off in check
+    // and with mate scores in the window.
+    int pruning = engineConfig.pruning;
+    int low = Side * ((Side == 1) ? alpha : beta), high = Side * ((Side == 1) ? beta : alpha);
+    bool canPrune = pruning != 0 && !inCheck && low > -PRUNE_MATE_BOUND && high < PRUNE_MATE_BOUND;
+    int staticEval = 0;
+    if (canPrune && depth <= PRUNE_MAX_DEPTH) {
+        staticEval = PruningEval<Side>(depth);
+        if ((pruning & PRUNE_REVERSE_FUTILITY) && staticEval - REVERSE_FUTILITY_MARGIN * depth >= high) {
+            STATS_INC(reverseFutilityCuts);
+            return (Side == 1) ? beta : alpha;
+        }
+        if ((pruning & PRUNE_RAZORING) && depth <= 2 && staticEval + razorMargins[depth] <= low) {
+            int eval = QuiescenceSearchT<Side>(alpha, beta);
+            if (Side * eval <= low) {
+                STATS_INC(razorCuts);
+                return eval;
+            }
+        }
+    }
+
     ChessMove moves[256];
     int moveCount = 0;
-    GenerateLegalMoves(maximizingPlayer ? 1 : -1, moves, moveCount);
+    {
+        STATS_TIMER(generateLegalMoves);
+        if (inCheck) GenerateMoves<Side, GEN_EVASIONS>(moves, moveCount);
+        else GenerateMoves<Side, GEN_ALL>(moves, moveCount);
+    }
+    SortMoves(moves, moveCount);
     
     if (moveCount == 0) {
-        if (IsInCheck(maximizingPlayer ? 1 : -1)) {
-            return maximizingPlayer ? -100000 : 100000; // Checkmate
+        return inCheck ? -Side * 100000 : 0; // Checkmate or stalemate
+    }
+
+    // ProbCut: a capture that holds beta + margin in a shallower null-window search would
+    // almost surely beat beta at full depth
+    if (canPrune && (pruning & PRUNE_PROBCUT) && depth >= PROBCUT_MIN_DEPTH) {
+        int probBeta = high + PROBCUT_MARGIN;
+        for (int i = 0; i < moveCount; i++) {
+            // Every capture, en passant too, wherever SortMoves() put it
+            if (!IsCaptureMove(moves[i].fromX, moves[i].fromY, moves[i].toX, moves[i].toY)) continue;
+            MoveUndo undo;
+            MakeMove(moves[i], undo);
+            int eval = (Side == 1) ? MinimaxT<-1>(Max(depth - 1 - PROBCUT_REDUCTION, 0), probBeta - 1, probBeta)
+                                   : MinimaxT<1>(Max(depth - 1 - PROBCUT_REDUCTION, 0), -probBeta, -probBeta + 1);
+            UnmakeMove(moves[i], undo);
+            if (Side * eval >= probBeta) {
+                STATS_INC(probCuts);
+                return eval;
+            }
         }
-        return 0; // Stalemate
     }
+
+    // Quiet moves that do not give check are skipped: all of them when even a big gain
+    // would not reach alpha (futility), the late ones in the history order at low depth
+    bool futile = canPrune && (pruning & PRUNE_FUTILITY) && depth <= 2 && staticEval + futilityMargins[depth] <= low;
+    int lateMoveLimit = (canPrune && (pruning & PRUNE_LATE_MOVES) && depth <= PRUNE_MAX_DEPTH) ? lateMoveCounts[depth] : 256;
+    if (lateMoveLimit < 256) SortQuietMoves(moves, moveCount, Side);
     
-    if (maximizingPlayer) {
-        int maxEval = -1000000;
-        for (int i = 0; i < moveCount; i++) {
-            // Make move
-            int captured = board[moves[i].toY][moves[i].toX];
-            int movedPiece = board[moves[i].fromY][moves[i].fromX];
-            board[moves[i].toY][moves[i].toX] = movedPiece;
-            board[moves[i].fromY][moves[i].fromX] = EMPTY;
-            
-            // Update king position if needed
-            if (abs(movedPiece) == WHITE_KING) {
-                if (movedPiece > 0) {
-                    whiteKingPos.x = moves[i].toX;
-                    whiteKingPos.y = moves[i].toY;
-                } else {
-                    blackKingPos.x = moves[i].toX;
-                    blackKingPos.y = moves[i].toY;
-                }
+    int bestEval = (Side == 1) ? -1000000 : 1000000;
+    int bestIndex = 0;
+    int searched = 0;
+    for (int i = 0; i < moveCount; i++) {
+        bool quiet = board[moves[i].toY][moves[i].toX] == EMPTY && moves[i].promotion == 0 &&
+                     !(abs(board[moves[i].fromY][moves[i].fromX]) == WHITE_PAWN && moves[i].fromX != moves[i].toX);
+        MoveUndo undo;
+        MakeMove(moves[i], undo);
+        if (quiet && searched > 0 && (futile || searched >= lateMoveLimit)) {
+            const POINT& theirKing = (Side == 1) ? blackKingPos : whiteKingPos;
+            if (!IsAttackedBy<Side>(theirKing.x, theirKing.y)) {
+                UnmakeMove(moves[i], undo);
+                if (futile) STATS_INC(futilityPruned);
+                else STATS_INC(lateMovesPruned);
+                continue;
             }
-            
-            int eval = Minimax(depth - 1, alpha, beta, false);
-            
-            // Undo move
-            board[moves[i].fromY][moves[i].fromX] = movedPiece;
-            board[moves[i].toY][moves[i].toX] = captured;
-            
-            if (abs(movedPiece) == WHITE_KING) {
-                if (movedPiece > 0) {
-                    whiteKingPos.x = moves[i].fromX;
-                    whiteKingPos.y = moves[i].fromY;
-                } else {
-                    blackKingPos.x = moves[i].fromX;
-                    blackKingPos.y = moves[i].fromY;
-                }
+        }
+        int eval = MinimaxT<-Side>(depth - 1, alpha, beta);
+        UnmakeMove(moves[i], undo);
+        searched++;
+        
+        if (Side == 1) {
+            if (eval > bestEval) {
+                bestEval = eval;
+                bestIndex = i;
             }
-            
-            maxEval = Max(maxEval, eval);
             alpha = Max(alpha, eval);
-            if (beta <= alpha) break;
-        }
-        return maxEval;
-    } else {
-        int minEval = 1000000;
-        for (int i = 0; i < moveCount; i++) {
-            // Make move (same as above)
-            int captured = board[moves[i].toY][moves[i].toX];
-            int movedPiece = board[moves[i].fromY][moves[i].fromX];
-            board[moves[i].toY][moves[i].toX] = movedPiece;
-            board[moves[i].fromY][moves[i].fromX] = EMPTY;
-            
-            int eval = Minimax(depth - 1, alpha, beta, true);
-            
-            // Undo move (same as above)
-            board[moves[i].fromY][moves[i].fromX] = movedPiece;
-            board[moves[i].toY][moves[i].toX] = captured;
-            
-            if (abs(movedPiece) == WHITE_KING) {
-                if (movedPiece > 0) {
-                    whiteKingPos.x = moves[i].fromX;
-                    whiteKingPos.y = moves[i].fromY;
-                } else {
-                    blackKingPos.x = moves[i].fromX;
-                    blackKingPos.y = moves[i].fromY;
-                }
+        } else {
+            if (eval < bestEval) {
+                bestEval = eval;
+                bestIndex = i;
             }
-            
-            minEval = Min(minEval, eval);
             beta = Min(beta, eval);
-            if (beta <= alpha) break;
         }
-        return minEval;
+        if (beta <= alpha) {
+            STATS_INC(betaCutoffs);
+            if (i == 0) STATS_INC(firstMoveCutoffs);
+            if (quiet) {
+                quietHistory[Side == 1 ? 0 : 1][moves[i].fromY * 8 + moves[i].fromX][moves[i].toY * 8 + moves[i].toX] += depth * depth;
+            }
+            break;
+        }
     }
+    if (depth == replyDepth) {
+        childBestMove = moves[bestIndex];
+        childHasMove = true;
+    }
+    return bestEval;
 }
 
-int EvaluatePawnStructure(int player) {
-    int score = 0;
-    
+int Minimax(int depth, int alpha, int beta, bool maximizingPlayer) {
+    return maximizingPlayer ? MinimaxT<1>(depth, alpha, beta) : MinimaxT<-1>(depth, alpha, beta);
+}
+
+void AddPawnStructureTerms(int player, int sign, int terms[EVAL_PARAM_COUNT]) {
     // Detect isolated pawns
     for (int x = 0; x < 8; x++) {
         for (int y = 0; y < 8; y++) {
@@ -1500,7 +3201,7 @@ int EvaluatePawnStructure(int player) {
                     }
                 }
                 
-                if (isolated) score -= 20;
+                if (isolated) terms[EVAL_ISOLATED_PAWN] -= sign;
             }
         }
     }
@@ -1528,53 +3229,27 @@ int EvaluatePawnStructure(int player) {
                 
                 if (passed) {
                     int advancement = (player == 1) ? (7 - y) : y;
-                    score += advancement * 15;
+                    terms[EVAL_PASSED_PAWN] += sign * advancement;
                 }
             }
         }
     }
-    
-    return score;
 }
 
 void GenerateLegalMoves(int player, ChessMove moves[], int &moveCount) {
-    moveCount = 0;
-    
-    for (int fromY = 0; fromY < 8; fromY++) {
-        for (int fromX = 0; fromX < 8; fromX++) {
-            if (board[fromY][fromX] != EMPTY && 
-                ((player == 1 && board[fromY][fromX] > 0) || 
-                 (player == -1 && board[fromY][fromX] < 0))) {
-                
-                for (int toY = 0; toY < 8; toY++) {
-                    for (int toX = 0; toX < 8; toX++) {
-                        if (IsValidMove(fromX, fromY, toX, toY)) {
-                            moves[moveCount].fromX = fromX;
-                            moves[moveCount].fromY = fromY;
-                            moves[moveCount].toX = toX;
-                            moves[moveCount].toY = toY;
-                            moves[moveCount].promotion = 0;
-                            
-                            // Handle pawn promotion
-                            if (abs(board[fromY][fromX]) == WHITE_PAWN && 
-                                (toY == 0 || toY == 7)) {
-                                moves[moveCount].promotion = (player == 1) ? WHITE_QUEEN : BLACK_QUEEN;
-                            }
-                            
-                            moveCount++;
-                            if (moveCount >= 256) return; // Prevent buffer overflow
-                        }
-                    }
-                }
-            }
-        }
+    STATS_TIMER(generateLegalMoves);
+    if (player == 1) {
+        if (IsAttackedBy<-1>(whiteKingPos.x, whiteKingPos.y)) GenerateMoves<1, GEN_EVASIONS>(moves, moveCount);
+        else GenerateMoves<1, GEN_ALL>(moves, moveCount);
+    } else {
+        if (IsAttackedBy<1>(blackKingPos.x, blackKingPos.y)) GenerateMoves<-1, GEN_EVASIONS>(moves, moveCount);
+        else GenerateMoves<-1, GEN_ALL>(moves, moveCount);
     }
 }
 
-int EvaluateKingIndianDefense(int player) {
-    if (player != -1) return 0; // Only for black (KID is a black defense)
+void AddKingIndianTerms(int player, int sign, int terms[EVAL_PARAM_COUNT]) {
+    if (player != -1) return; // Only for black (KID is a black defense)
     
-    int score = 0;
     bool kingsideFianchetto = false;
     bool centerControl = false;
     
@@ -1584,7 +3259,7 @@ int EvaluateKingIndianDefense(int player) {
         board[1][5] == BLACK_PAWN &&   // g-pawn
         board[1][6] == BLACK_PAWN) {   // h-pawn
         kingsideFianchetto = true;
-        score += 50;
+        terms[EVAL_KID_FIANCHETTO] += sign;
     }
     
     // Check center control
@@ -1597,31 +3272,29 @@ int EvaluateKingIndianDefense(int player) {
     }
     if (centerControlCount >= 2) {
         centerControl = true;
-        score += 30;
+        terms[EVAL_KID_CENTER] += sign;
     }
     
     // Check for KID pawn storm
     if (kingsideFianchetto && centerControl) {
         // Evaluate pawn storm potential
-        int pawnStormScore = 0;
         for (int x = 5; x < 7; x++) {
             for (int y = 4; y < 6; y++) {
                 if (board[y][x] == BLACK_PAWN) {
-                    pawnStormScore += (y - 1) * 10; // Reward advanced pawns
+                    terms[EVAL_KID_STORM] += sign * (y - 1); // Reward advanced pawns
                 }
             }
         }
-        score += pawnStormScore;
     }
-    
-    return score;
 }
 
 
 ChessMove FindBestMove(int depth) {
-    ChessMove moves[256];
-    int moveCount = 0;
-    GenerateLegalMoves(currentPlayer, moves, moveCount);
+    hasPredictedReply = false; // Book moves below predict nothing
+    int timedDepth;
+    if (!engineConfig.openingHeuristics) {
+        return searchClock ? SearchTimed(*searchClock, depth, timedDepth) : SearchBestMove(depth);
+    }
 
     // King's Indian Defense specific moves
     if (currentPlayer == -1 && DetectGamePhase() == OPENING) {
@@ -1696,15 +3369,15 @@ ChessMove FindBestMove(int depth) {
             }
         }
         
-        // Collect all knight development moves
-        for (int y = 0; y < 8; y++) {
-            for (int x = 0; x < 8; x++) {
-                if (board[y][x] == (currentPlayer == 1 ? WHITE_KNIGHT : BLACK_KNIGHT)) {
-                    for (int ty = 0; ty < 8; ty++) {
-                        for (int tx = 0; tx < 8; tx++) {
-                            if (IsValidMove(x, y, tx, ty)) {
-                                knightMoves[knightMoveCount++] = {x, y, tx, ty};
-                            }
+        // Collect the development moves of knights still on their home rank; knights
+        // that are out already are left to the search, so they don't shuffle back and forth
+        int y = (currentPlayer == 1) ? 7 : 0;
+        for (int x = 0; x < 8; x++) {
+            if (board[y][x] == (currentPlayer == 1 ? WHITE_KNIGHT : BLACK_KNIGHT)) {
+                for (int ty = 0; ty < 8; ty++) {
+                    for (int tx = 0; tx < 8; tx++) {
+                        if (IsValidMove(x, y, tx, ty)) {
+                            knightMoves[knightMoveCount++] = {x, y, tx, ty};
                         }
                     }
                 }
@@ -1731,96 +3404,3634 @@ ChessMove FindBestMove(int depth) {
         }
     }
     
-    ChessMove bestMove;
+    return searchClock ? SearchTimed(*searchClock, depth, timedDepth) : SearchBestMove(depth);
+}
+
+// One pass over the root moves at 'depth', each move's score left in moves[i].score.
+// Returns the index of the best; nodesSpent[i], if given, gets the nodes searched below
+// move i. Also sets the predicted reply.
+int SearchRootMoves(ChessMove moves[], int moveCount, int depth, unsigned long long nodesSpent[]) {
     int bestValue = currentPlayer == 1 ? -1000000 : 1000000;
+    int bestIndex = 0;
+    hasPredictedReply = false;
+    replyDepth = depth - 1;
+    // Older searches' cutoffs count half
+    for (int side = 0; side < 2; side++) {
+        for (int from = 0; from < 64; from++) {
+            for (int to = 0; to < 64; to++) quietHistory[side][from][to] /= 2;
+        }
+    }
     
     for (int i = 0; i < moveCount; i++) {
-        // Make move
-        int captured = board[moves[i].toY][moves[i].toX];
-        int movedPiece = board[moves[i].fromY][moves[i].fromX];
-        board[moves[i].toY][moves[i].toX] = movedPiece;
-        board[moves[i].fromY][moves[i].fromX] = EMPTY;
-        
-        // Update king position if needed
-        if (abs(movedPiece) == WHITE_KING) {
-            if (movedPiece > 0) {
-                whiteKingPos.x = moves[i].toX;
-                whiteKingPos.y = moves[i].toY;
-            } else {
-                blackKingPos.x = moves[i].toX;
-                blackKingPos.y = moves[i].toY;
-            }
-        }
-        
-        int moveValue = Minimax(depth - 1, -1000000, 1000000, currentPlayer == -1);
-        
-        // Undo move
-        board[moves[i].fromY][moves[i].fromX] = movedPiece;
-        board[moves[i].toY][moves[i].toX] = captured;
-        
-        if (abs(movedPiece) == WHITE_KING) {
-            if (movedPiece > 0) {
-                whiteKingPos.x = moves[i].fromX;
-                whiteKingPos.y = moves[i].fromY;
-            } else {
-                blackKingPos.x = moves[i].fromX;
-                blackKingPos.y = moves[i].fromY;
-            }
-        }
+        unsigned long long nodesBefore = searchNodes;
+        MoveUndo undo;
+        MakeMove(moves[i], undo);
+        childHasMove = false;
+        // The best score so far bounds the window for the remaining root moves
+        int moveValue = (currentPlayer == 1)
+            ? Minimax(depth - 1, -1000000, bestValue, true)     // black just moved, white replies
+            : Minimax(depth - 1, bestValue, 1000000, false);
+
+        UnmakeMove(moves[i], undo);
         
         moves[i].score = moveValue;
+        if (nodesSpent) nodesSpent[i] = searchNodes - nodesBefore;
         
         if ((currentPlayer == 1 && moveValue > bestValue) || 
             (currentPlayer == -1 && moveValue < bestValue)) {
             bestValue = moveValue;
-            bestMove = moves[i];
+            bestIndex = i;
+            predictedReply = childBestMove;
+            hasPredictedReply = childHasMove;
+        }
+    }
+    replyDepth = -1;
+    return bestIndex;
+}
+
+// Full-width root search for the side to move (no opening heuristics)
+ChessMove SearchBestMove(int depth) {
+#ifdef CHESS_SEARCH_STATS
+    ResetSearchStats();
+    std::chrono::steady_clock::time_point searchStart = std::chrono::steady_clock::now();
+#endif
+
+    ChessMove moves[256];
+    int moveCount = 0;
+    GenerateLegalMoves(currentPlayer, moves, moveCount);
+    SortMoves(moves, moveCount);
+
+    ChessMove bestMove;
+    hasPredictedReply = false;
+
+    // A result at least this deep from the analysis cache (this or an earlier session)
+    unsigned long long cacheKey = 0;
+    bool cacheHit = false;
+    if (analysisCache.header) {
+        cacheKey = AnalysisKey();
+        ChessMove cached;
+        unsigned short cachedReply;
+        int cachedScore, cachedDepth;
+        if (ProbeAnalysisCache(cacheKey, cached, cachedReply, cachedScore, cachedDepth) && cachedDepth >= depth) {
+            for (int i = 0; i < moveCount && !cacheHit; i++) {
+                if (moves[i].fromX == cached.fromX && moves[i].fromY == cached.fromY && moves[i].toX == cached.toX &&
+                    moves[i].toY == cached.toY && moves[i].promotion == cached.promotion) {
+                    moves[i].score = cachedScore;
+                    bestMove = moves[i];
+                    cacheHit = true;
+                }
+            }
+        }
+        // The predicted reply comes back too, so pondering works after a hit; checked for
+        // legality like the move, a key collision must not make the ponder search play it
+        if (cacheHit && cachedReply != 0) {
+            MoveUndo undo;
+            MakeMove(bestMove, undo);
+            ChessMove replies[256];
+            int replyCount = 0;
+            GenerateLegalMoves(currentPlayer, replies, replyCount);
+            for (int i = 0; i < replyCount && !hasPredictedReply; i++) {
+                if (PackMove(replies[i]) == cachedReply) {
+                    predictedReply = replies[i];
+                    hasPredictedReply = true;
+                }
+            }
+            UnmakeMove(bestMove, undo);
+        }
+        if (cacheHit) analysisCacheHits++;
+        else analysisCacheMisses++;
+    }
+    if (!cacheHit && moveCount > 0) {
+        bestMove = moves[SearchRootMoves(moves, moveCount, depth, NULL)];
+        // Not a stopped ponder search, its result is thrown away
+        if (analysisCache.header && (searchStop == NULL || !searchStop->load())) {
+            StoreAnalysisCache(cacheKey, bestMove, hasPredictedReply ? &predictedReply : NULL, bestMove.score, depth);
         }
     }
+
+#ifdef CHESS_SEARCH_STATS
+    double elapsedMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - searchStart).count();
+    if (FILE* statsFile = fopen(CHESS_STATS_FILE, "a")) {
+        DumpSearchStats(statsFile, depth, elapsedMs);
+        fclose(statsFile);
+    }
+#endif
     
     return bestMove;
 }
 
-int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int nCmdShow) {    
+// ---------------------------------------------------------------------------
+// Time manager: iterative deepening against a game clock
+// ---------------------------------------------------------------------------
 
-    // Define the window class (like a template for the chess window)
-    WNDCLASS wc = {};
-    wc.lpfnWndProc = WndProc;       // Handles mouse clicks, keyboard, etc.
-    wc.hInstance = hInstance;       // The program instance
-    wc.lpszClassName = _T("chessclass"); // Class name
-    wc.hbrBackground = (HBRUSH)(COLOR_WINDOW + 1); // Background color
+long long SteadyMicros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
 
-    // Register the window class (so Windows knows about it)
-    if (!RegisterClass(&wc)) {
-        MessageBox(NULL, _T("Window Registration Failed!"), _T("Error!"), MB_ICONERROR | MB_OK);
-        return 0;
-    }
+// The soft limit is what this move should take: its share of the remaining time plus most
+// of the increment. The hard limit is where a running iteration is abandoned: a few soft
+// limits, but at most half of what is left (nearly all of it on the last move before the
+// clock is topped up), so the clock never runs out.
+void AllocateTime(const TimeControl& clock, long long& softMs, long long& hardMs) {
+    long long left = clock.remainingMs - TIME_MOVE_OVERHEAD_MS;
+    if (left < 1) left = 1;
+    int movesToGo = clock.movesToGo > 0 ? clock.movesToGo : TIME_DEFAULT_MOVES_TO_GO;
+    softMs = left / movesToGo + clock.incrementMs * 3 / 4;
+    long long cap = (movesToGo == 1) ? left * 9 / 10 : left / 2;
+    hardMs = softMs * TIME_HARD_FACTOR;
+    if (hardMs > cap) hardMs = cap;
+    if (hardMs < 1) hardMs = 1;
+    if (softMs > hardMs) softMs = hardMs;
+}
 
-    // Calculate window size (8x8 squares + margins + space for buttons)
-    RECT windowRect = {0, 0, 8*squareSize + boardStartX, 8*squareSize + boardStartY + 100};
-    AdjustWindowRect(&windowRect, WS_OVERLAPPEDWINDOW & ~WS_THICKFRAME & ~WS_MAXIMIZEBOX, FALSE);
+// Iterative deepening up to maxDepth on the clock. No iteration is started past half the
+// soft limit (the next one usually takes longer than all before it together), scaled by
+// how settled the search looks: up when the best move just changed or the score dropped,
+// down when the best move took nearly all the nodes. An iteration cut off at the hard limit
+// is thrown away, so none is started that the growth of the last ones says cannot finish
+// with room to spare: the growth is the larger of the last two ratios, which swing between
+// odd and even depths, and one depth can still take several times more. Returns the best
+// move of the last full iteration, with its score.
+ChessMove SearchTimed(const TimeControl& clock, int maxDepth, int& completedDepth) {
+    long long startUs = SteadyMicros();
+    long long softMs, hardMs;
+    AllocateTime(clock, softMs, hardMs);
 
-    HWND hwnd = CreateWindow(
-        wc.lpszClassName,
-        _T("Chess Game"),
-        WS_OVERLAPPEDWINDOW & ~WS_THICKFRAME & ~WS_MAXIMIZEBOX,
-        CW_USEDEFAULT, CW_USEDEFAULT,
-        windowRect.right - windowRect.left + 30,
-        windowRect.bottom - windowRect.top + 60,
-        NULL, NULL, hInstance, NULL
-    );
+    ChessMove moves[256];
+    int moveCount = 0;
+    GenerateLegalMoves(currentPlayer, moves, moveCount);
+    SortMoves(moves, moveCount);
+    completedDepth = 0;
+    hasPredictedReply = false;
+    if (moveCount == 0) return ChessMove();
+    if (moveCount == 1) return moves[0]; // Nothing to decide
 
-    // Create mode selection buttons
-    CreateModeButtons(hwnd);
+    unsigned long long nodesSpent[256];
+    ChessMove result = moves[0]; // An aborted iteration overwrites the scores in 'moves'
+    ChessMove reply;
+    bool hasReply = false;
+    int instability = 0; // Percent added to the soft limit by best move changes, halved each iteration
+    int lastScore = 0;
+    long long lastIterationUs = 0;
+    long long lastGrowth = 0;
+    searchDeadlineUs = startUs + hardMs * 1000;
+    searchTimedOut = false;
+    timeCheckCountdown = 0;
+    for (int depth = 1; depth <= maxDepth; depth++) {
+        long long iterationStartUs = SteadyMicros();
+        int bestIndex = SearchRootMoves(moves, moveCount, depth, nodesSpent);
+        if (searchTimedOut) break;
 
-    // Show the window
-    ShowWindow(hwnd, nCmdShow);
-    UpdateWindow(hwnd);
+        // The best move goes first in the next iteration, the others keep their order
+        ChessMove best = moves[bestIndex];
+        unsigned long long bestNodes = nodesSpent[bestIndex];
+        for (int i = bestIndex; i > 0; i--) {
+            moves[i] = moves[i - 1];
+            nodesSpent[i] = nodesSpent[i - 1];
+        }
+        moves[0] = best;
+        nodesSpent[0] = bestNodes;
+        result = best;
+        reply = predictedReply;
+        hasReply = hasPredictedReply;
+        completedDepth = depth;
+        if (abs(best.score) >= 100000) break; // Mate scores do not change with depth
 
-    // Message loop (keeps the window running)
-    MSG msg;
-    while (GetMessage(&msg, NULL, 0, 0)) {
-        TranslateMessage(&msg); // Handles keyboard input
-        DispatchMessage(&msg);  // Sends messages to WndProc
+        bool changed = depth > 1 && bestIndex != 0;
+        int score = currentPlayer * best.score;
+        instability = instability / 2 + (changed ? 100 : 0);
+        int percent = 100 + instability / 2;
+        if (depth > 1 && score < lastScore) percent += Min(lastScore - score, 100); // A centipawn drop adds a percent
+        lastScore = score;
+        unsigned long long totalNodes = 0;
+        for (int i = 0; i < moveCount; i++) totalNodes += nodesSpent[i];
+        if (depth >= 4 && !changed && nodesSpent[0] * 100 >= totalNodes * TIME_DOMINANT_PERCENT) percent /= 2;
+
+        long long nowUs = SteadyMicros();
+        if ((nowUs - startUs) / 1000 * 2 >= softMs * percent / 100) break;
+        long long iterationUs = nowUs - iterationStartUs;
+        long long growth = lastIterationUs > 0
+            ? (iterationUs + lastIterationUs - 1) / lastIterationUs : TIME_HARD_FACTOR;
+        if (growth < lastGrowth) growth = lastGrowth;
+        lastGrowth = growth = growth < 2 ? 2 : growth > 10 ? 10 : growth;
+        if (nowUs + iterationUs * growth * TIME_GROWTH_MARGIN > searchDeadlineUs) break;
+        lastIterationUs = iterationUs > 0 ? iterationUs : 1;
+    }
+    searchDeadlineUs = 0;
+    searchTimedOut = false;
+    predictedReply = reply;
+    hasPredictedReply = hasReply;
+    return result;
+}
+
+// ---------------------------------------------------------------------------
+// Large search tables: huge pages, first-touch clearing, NUMA pinning
+// ---------------------------------------------------------------------------
+
+#ifndef CHESS_HEADLESS
+// Large pages need the "Lock pages in memory" right, which a process has to switch on
+bool EnableLockMemoryPrivilege() {
+    HANDLE token;
+    if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token)) return false;
+    TOKEN_PRIVILEGES privileges = {};
+    privileges.PrivilegeCount = 1;
+    privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+    bool enabled = LookupPrivilegeValue(NULL, SE_LOCK_MEMORY_NAME, &privileges.Privileges[0].Luid) &&
+                   AdjustTokenPrivileges(token, FALSE, &privileges, 0, NULL, NULL) &&
+                   GetLastError() == ERROR_SUCCESS;
+    CloseHandle(token);
+    return enabled;
+}
+#endif
+
+// Memory for a table of 'bytes', on huge pages when 'largePages' asks for them and the
+// system has them: explicit ones first (MAP_HUGETLB, or MEM_LARGE_PAGES on Windows), then
+// transparent ones (2 MB aligned and madvise()d), else normal pages. The memory is zero
+// and untouched, see ClearLargeTable().
+bool AllocateLargeTable(LargeTable& table, size_t bytes, bool largePages) {
+    table.memory = NULL;
+    table.pages = LARGE_PAGES_NONE;
+    size_t rounded = (bytes + LARGE_PAGE_SIZE - 1) / LARGE_PAGE_SIZE * LARGE_PAGE_SIZE;
+#ifndef CHESS_HEADLESS
+    size_t largePage = largePages && EnableLockMemoryPrivilege() ? GetLargePageMinimum() : 0;
+    if (largePage != 0) {
+        table.bytes = (bytes + largePage - 1) / largePage * largePage;
+        table.memory = VirtualAlloc(NULL, table.bytes, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+        if (table.memory) table.pages = LARGE_PAGES_EXPLICIT;
+    }
+    if (!table.memory) {
+        table.bytes = rounded;
+        table.memory = VirtualAlloc(NULL, table.bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    }
+    return table.memory != NULL;
+#else
+#ifdef MAP_HUGETLB
+    if (largePages) {
+        void* memory = mmap(NULL, rounded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (memory != MAP_FAILED) {
+            table.memory = memory;
+            table.bytes = rounded;
+            table.pages = LARGE_PAGES_EXPLICIT;
+            return true;
+        }
+    }
+#endif
+    size_t mapped = rounded + (largePages ? LARGE_PAGE_SIZE : 0);
+    char* memory = (char*)mmap(NULL, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED) return false;
+    if (largePages) {
+        // Trimmed to 2 MB boundaries, so huge pages can back all of it
+        size_t head = (LARGE_PAGE_SIZE - (uintptr_t)memory % LARGE_PAGE_SIZE) % LARGE_PAGE_SIZE;
+        if (head != 0) munmap(memory, head);
+        munmap(memory + head + rounded, LARGE_PAGE_SIZE - head);
+        memory += head;
+#ifdef MADV_HUGEPAGE
+        if (madvise(memory, rounded, MADV_HUGEPAGE) == 0) table.pages = LARGE_PAGES_TRANSPARENT;
+#endif
+    }
+    table.memory = memory;
+    table.bytes = rounded;
+    return true;
+#endif
+}
+
+void FreeLargeTable(LargeTable& table) {
+    if (!table.memory) return;
+#ifndef CHESS_HEADLESS
+    VirtualFree(table.memory, 0, MEM_RELEASE);
+#else
+    munmap(table.memory, table.bytes);
+#endif
+    table.memory = NULL;
+}
+
+// Zeroes part 'index' of 'count' of the bytes [begin, end), whole huge pages each. A page
+// lands on the NUMA node of the thread that touches it first, so the threads of one node
+// clearing a range together place it on that node.
+void ClearLargeTableRange(LargeTable& table, size_t begin, size_t end, int index, int count) {
+    size_t slice = ((end - begin) / count + LARGE_PAGE_SIZE - 1) / LARGE_PAGE_SIZE * LARGE_PAGE_SIZE;
+    size_t first = begin + slice * index < end ? begin + slice * index : end;
+    size_t last = first + slice < end ? first + slice : end;
+    memset((char*)table.memory + first, 0, last - first);
+}
+
+// ... of the whole table; threads pinned to different nodes spread its pages over them
+void ClearLargeTableSlice(LargeTable& table, int index, int count) {
+    ClearLargeTableRange(table, 0, table.bytes, index, count);
+}
+
+void ClearLargeTable(LargeTable& table, int threads) {
+    threads = Max(1, Min(threads, 64));
+    std::thread pool[64];
+    for (int i = 1; i < threads; i++) pool[i] = std::thread([&table, i, threads] { ClearLargeTableSlice(table, i, threads); });
+    ClearLargeTableSlice(table, 0, threads);
+    for (int i = 1; i < threads; i++) pool[i].join();
+}
+
+#ifdef CHESS_HEADLESS
+// CPUs of each NUMA node, from /sys; one node with every CPU where that is missing
+std::vector<std::vector<int>> NumaNodeCpus() {
+    std::vector<std::vector<int>> nodes;
+    for (int node = 0; node < 1024; node++) {
+        char path[64];
+        snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+        FILE* file = fopen(path, "r");
+        if (!file) {
+            if (node > 0 && !nodes.empty()) break;
+            continue;
+        }
+        std::vector<int> cpus;
+        int first, last;
+        char separator;
+        while (fscanf(file, "%d", &first) == 1) {
+            last = first;
+            if (fscanf(file, "%c", &separator) == 1 && separator == '-') {
+                if (fscanf(file, "%d", &last) != 1) last = first;
+                if (fscanf(file, "%c", &separator) != 1) separator = '\n';
+            }
+            for (int cpu = first; cpu <= last; cpu++) cpus.push_back(cpu);
+            if (separator != ',') break;
+        }
+        fclose(file);
+        if (!cpus.empty()) nodes.push_back(cpus);
+    }
+    if (nodes.empty()) {
+        nodes.push_back(std::vector<int>());
+        for (int cpu = 0; cpu < Max(1, (int)std::thread::hardware_concurrency()); cpu++) nodes[0].push_back(cpu);
+    }
+    return nodes;
+}
+
+// Pins the calling thread: thread i runs on node i % nodes, on that node's (i / nodes)-th
+// CPU, so search threads spread over the nodes and the memory they first touch with them
+bool PinThreadToNumaNode(int index, int& node, int& cpu) {
+    static std::vector<std::vector<int>> nodes = NumaNodeCpus();
+    node = index % (int)nodes.size();
+    cpu = nodes[node][(index / nodes.size()) % nodes[node].size()];
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+// Process-wide memory on transparent or explicit huge pages, in KB (-1 when unknown)
+long long HugePageKb() {
+    FILE* file = fopen("/proc/self/smaps_rollup", "r");
+    if (!file) return -1;
+    long long total = 0, kb;
+    char line[256];
+    while (fgets(line, sizeof(line), file)) {
+        if (sscanf(line, "AnonHugePages: %lld", &kb) == 1) total += kb;
+        else if (sscanf(line, "Private_Hugetlb: %lld", &kb) == 1) total += kb;
+    }
+    fclose(file);
+    return total;
+}
+#endif
+
+// ---------------------------------------------------------------------------
+// MultiPV analysis
+// ---------------------------------------------------------------------------
+
+bool ProbePvTable(int& score, unsigned short& move, int& depth, int& bound) {
+    const PvTTEntry& entry = pvTable[positionHash & pvTableMask];
+    unsigned long long data = entry.data.load(std::memory_order_relaxed);
+    if (data == 0 || (entry.check.load(std::memory_order_relaxed) ^ data) != positionHash) return false;
+    score = (int)(unsigned)data;
+    move = (unsigned short)(data >> 32);
+    depth = (int)(signed char)(data >> 48 & 255);
+    bound = (int)(data >> 56);
+    return true;
+}
+
+void StorePvTable(int score, unsigned short move, int depth, int bound) {
+    PvTTEntry& entry = pvTable[positionHash & pvTableMask];
+    unsigned long long data = (unsigned long long)(unsigned)score | (unsigned long long)move << 32 |
+                              (unsigned long long)(depth & 255) << 48 | (unsigned long long)bound << 56;
+    entry.data.store(data, std::memory_order_relaxed);
+    entry.check.store(positionHash ^ data, std::memory_order_relaxed);
+}
+
+// Points this thread's searches at a slice of a table shared with other threads
+void UsePvTablePartition(PvTTEntry* entries, size_t count) {
+    pvTable = entries;
+    pvTableMask = count - 1;
+    pvTableShared = true;
+}
+
+// The root searches each move with the window starting at the Nth best score found so
+// far: a move that beats it gets an exact score, the rest only an upper bound (a lower
+// one for black), which is all it takes to show they are not among the N best. Below
+// the root a transposition table, kept between root moves, iterations and calls, orders
+// the moves and cuts searches already done for an earlier line.
+template <int Side>
+int PvSearchT(int depth, int alpha, int beta, int ply) {
+    searchNodes++;
+    STATS_INC(nodes);
+    pvLengths[ply] = ply;
+    if (searchStop != NULL && searchStop->load(std::memory_order_relaxed)) return 0; // Result is thrown away
+    if (IsDrawByRule()) return 0;
+    if (depth == 0 || ply >= MULTIPV_MAX_PLY - 1) {
+        return QuiescenceSearchT<Side>(alpha, beta);
+    }
+
+    unsigned short ttMove = 0;
+    int ttScore, ttDepth, ttBound;
+    STATS_INC(ttProbes);
+    if (ProbePvTable(ttScore, ttMove, ttDepth, ttBound) && ttDepth >= depth) {
+        STATS_INC(ttHits);
+        // An exact hit ends the PV here, ExtendPvFromTable() continues it
+        if (ttBound == PV_BOUND_EXACT) return ttScore;
+        if (ttBound == PV_BOUND_LOWER && ttScore >= beta) return ttScore;
+        if (ttBound == PV_BOUND_UPPER && ttScore <= alpha) return ttScore;
+    }
+
+    const POINT& king = (Side == 1) ? whiteKingPos : blackKingPos;
+    bool inCheck = IsAttackedBy<-Side>(king.x, king.y);
+    ChessMove moves[256];
+    int moveCount = 0;
+    if (inCheck) GenerateMoves<Side, GEN_EVASIONS>(moves, moveCount);
+    else GenerateMoves<Side, GEN_ALL>(moves, moveCount);
+    if (moveCount == 0) {
+        return inCheck ? -Side * 100000 : 0; // Checkmate or stalemate
+    }
+    SortMoves(moves, moveCount);
+    for (int i = 1; i < moveCount && ttMove != 0; i++) {
+        if (PackMove(moves[i]) == ttMove) {
+            ChessMove first = moves[i];
+            memmove(moves + 1, moves, i * sizeof(ChessMove));
+            moves[0] = first;
+            break;
+        }
+    }
+
+    int originalAlpha = alpha, originalBeta = beta;
+    int bestEval = (Side == 1) ? -1000000 : 1000000;
+    int bestIndex = 0;
+    for (int i = 0; i < moveCount; i++) {
+        MoveUndo undo;
+        MakeMove(moves[i], undo);
+        int eval = PvSearchT<-Side>(depth - 1, alpha, beta, ply + 1);
+        UnmakeMove(moves[i], undo);
+
+        if ((Side == 1) ? eval > bestEval : eval < bestEval) {
+            bestEval = eval;
+            bestIndex = i;
+        }
+        // Inside the window: the move and the child's line become this node's PV
+        if ((Side == 1) ? eval > alpha : eval < beta) {
+            pvLines[ply][ply] = moves[i];
+            for (int j = ply + 1; j < pvLengths[ply + 1]; j++) pvLines[ply][j] = pvLines[ply + 1][j];
+            pvLengths[ply] = Max(pvLengths[ply + 1], ply + 1);
+            if (Side == 1) alpha = eval;
+            else beta = eval;
+        }
+        if (beta <= alpha) {
+            STATS_INC(betaCutoffs);
+            if (i == 0) STATS_INC(firstMoveCutoffs);
+            break;
+        }
+    }
+    if (searchStop != NULL && searchStop->load(std::memory_order_relaxed)) return 0;
+
+    StorePvTable(bestEval, PackMove(moves[bestIndex]), depth,
+                 bestEval <= originalAlpha ? PV_BOUND_UPPER : bestEval >= originalBeta ? PV_BOUND_LOWER : PV_BOUND_EXACT);
+    return bestEval;
+}
+
+// Lines cut short by a table hit are continued with the table's best moves, as long as
+// they stay legal and do not repeat
+void ExtendPvFromTable(MultiPvLine& line, int depth) {
+    MoveUndo undos[MULTIPV_MAX_PLY];
+    for (int i = 0; i < line.length; i++) MakeMove(line.pv[i], undos[i]);
+    while (line.length < depth && !IsDrawByRule()) {
+        unsigned short ttMove;
+        int ttScore, ttDepth, ttBound;
+        if (!ProbePvTable(ttScore, ttMove, ttDepth, ttBound) || ttBound != PV_BOUND_EXACT) break;
+        ChessMove moves[256];
+        int moveCount = 0;
+        GenerateLegalMoves(currentPlayer, moves, moveCount);
+        int found = -1;
+        for (int i = 0; i < moveCount && found < 0; i++) {
+            if (PackMove(moves[i]) == ttMove) found = i;
+        }
+        if (found < 0) break;
+        line.pv[line.length] = moves[found];
+        MakeMove(line.pv[line.length], undos[line.length]);
+        line.length++;
+    }
+    for (int i = line.length - 1; i >= 0; i--) UnmakeMove(line.pv[i], undos[i]);
+}
+
+// The 'lineCount' best moves of the side to move, best first, each with its exact score
+// (white-relative, like Minimax()) and principal variation, by iterative deepening to
+// 'depth'. Returns the number of lines, fewer when there are fewer legal moves. A stopped
+// search returns the lines of the last iteration it completed.
+static int SearchMultiPVLines(int depth, int lineCount, MultiPvLine lines[]) {
+    lineCount = Max(1, Min(lineCount, MULTIPV_MAX_LINES));
+    depth = Max(1, Min(depth, MULTIPV_MAX_PLY - 1));
+    // Without a server partition each analysing thread has a table of its own, emptied
+    // when the evaluator changes
+    if (pvTable == NULL) {
+        LargeTable table;
+        if (!AllocateLargeTable(table, sizeof(PvTTEntry) << MULTIPV_TT_BITS, useLargePages)) return 0;
+        pvTable = (PvTTEntry*)table.memory;
+        pvTableMask = ((size_t)1 << MULTIPV_TT_BITS) - 1;
+    }
+    unsigned long long evaluator = EvaluatorKey();
+    if (!pvTableShared && evaluator != pvTableEvaluator) {
+        for (size_t i = 0; i <= pvTableMask; i++) {
+            pvTable[i].check.store(0, std::memory_order_relaxed);
+            pvTable[i].data.store(0, std::memory_order_relaxed);
+        }
+        pvTableEvaluator = evaluator;
+    }
+
+    int side = currentPlayer;
+    ChessMove moves[256];
+    int moveCount = 0;
+    GenerateLegalMoves(side, moves, moveCount);
+    SortMoves(moves, moveCount);
+
+    int completed = 0;
+    MultiPvLine found[MULTIPV_MAX_LINES];
+    for (int d = 1; d <= depth; d++) {
+        int foundCount = 0;
+        for (int i = 0; i < moveCount; i++) {
+            int bound = (foundCount < lineCount) ? -side * 1000000 : found[foundCount - 1].score;
+            MoveUndo undo;
+            MakeMove(moves[i], undo);
+            int value = (side == 1) ? PvSearchT<-1>(d - 1, bound, 1000000, 1)
+                                    : PvSearchT<1>(d - 1, -1000000, bound, 1);
+            UnmakeMove(moves[i], undo);
+            if (searchStop != NULL && searchStop->load(std::memory_order_relaxed)) return completed;
+
+            moves[i].score = value;
+            if (foundCount == lineCount && ((side == 1) ? value <= bound : value >= bound)) continue;
+
+            // Insert by score, the worst line drops out when all are taken
+            int at = Min(foundCount, lineCount - 1);
+            while (at > 0 && ((side == 1) ? value > found[at - 1].score : value < found[at - 1].score)) {
+                found[at] = found[at - 1];
+                at--;
+            }
+            MultiPvLine& line = found[at];
+            line.pv[0] = moves[i];
+            line.length = Max(pvLengths[1], 1);
+            for (int j = 1; j < line.length; j++) line.pv[j] = pvLines[1][j];
+            line.score = value;
+            line.depth = d;
+            foundCount = Min(foundCount + 1, lineCount);
+        }
+
+        for (int i = 0; i < foundCount; i++) {
+            ExtendPvFromTable(found[i], d);
+            lines[i] = found[i];
+        }
+        completed = foundCount;
+
+        // The next iteration starts with this one's best moves
+        for (int i = 1; i < moveCount; i++) {
+            ChessMove move = moves[i];
+            int j = i;
+            while (j > 0 && ((side == 1) ? move.score > moves[j - 1].score : move.score < moves[j - 1].score)) {
+                moves[j] = moves[j - 1];
+                j--;
+            }
+            moves[j] = move;
+        }
+    }
+    return completed;
+}
+
+// SearchMultiPVLines() with the statistics dump of SearchBestMove()
+int SearchMultiPV(int depth, int lineCount, MultiPvLine lines[]) {
+#ifdef CHESS_SEARCH_STATS
+    ResetSearchStats();
+    std::chrono::steady_clock::time_point searchStart = std::chrono::steady_clock::now();
+#endif
+    int count = SearchMultiPVLines(depth, lineCount, lines);
+#ifdef CHESS_SEARCH_STATS
+    double elapsedMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - searchStart).count();
+    if (FILE* statsFile = fopen(CHESS_STATS_FILE, "a")) {
+        DumpSearchStats(statsFile, depth, elapsedMs);
+        fclose(statsFile);
+    }
+#endif
+    return count;
+}
+
+// "+0.35 e2e4 e7e5 ...", pawns for white; a forced mate shows as "#+" or "#-"
+void FormatPvLine(const MultiPvLine& line, char* out, int size) {
+    int used;
+    if (abs(line.score) >= 100000) used = snprintf(out, size, "#%c", line.score > 0 ? '+' : '-');
+    else used = snprintf(out, size, "%+.2f", line.score / 100.0);
+    for (int i = 0; i < line.length && used + 7 < size; i++) {
+        char text[6];
+        MoveToString(line.pv[i], text);
+        used += snprintf(out + used, size - used, " %s", text);
+    }
+}
+
+void SavePosition(PositionSnapshot& snapshot) {
+    memcpy(snapshot.board, board, sizeof(board));
+    snapshot.currentPlayer = currentPlayer;
+    snapshot.whiteKingPos = whiteKingPos;
+    snapshot.blackKingPos = blackKingPos;
+    snapshot.whiteKingMoved = whiteKingMoved;
+    snapshot.blackKingMoved = blackKingMoved;
+    snapshot.whiteRookKingMoved = whiteRookKingMoved;
+    snapshot.whiteRookQueenMoved = whiteRookQueenMoved;
+    snapshot.blackRookKingMoved = blackRookKingMoved;
+    snapshot.blackRookQueenMoved = blackRookQueenMoved;
+    snapshot.enPassantTarget = enPassantTarget;
+    snapshot.positionHash = positionHash;
+    snapshot.halfmoveClock = halfmoveClock;
+    snapshot.historyCount = historyCount;
+    memcpy(snapshot.hashHistory, hashHistory, historyCount * sizeof(hashHistory[0]));
+}
+
+void RestorePosition(const PositionSnapshot& snapshot) {
+    memcpy(board, snapshot.board, sizeof(board));
+    currentPlayer = snapshot.currentPlayer;
+    whiteKingPos = snapshot.whiteKingPos;
+    blackKingPos = snapshot.blackKingPos;
+    whiteKingMoved = snapshot.whiteKingMoved;
+    blackKingMoved = snapshot.blackKingMoved;
+    whiteRookKingMoved = snapshot.whiteRookKingMoved;
+    whiteRookQueenMoved = snapshot.whiteRookQueenMoved;
+    blackRookKingMoved = snapshot.blackRookKingMoved;
+    blackRookQueenMoved = snapshot.blackRookQueenMoved;
+    enPassantTarget = snapshot.enPassantTarget;
+    positionHash = snapshot.positionHash;
+    halfmoveClock = snapshot.halfmoveClock;
+    historyCount = snapshot.historyCount;
+    memcpy(hashHistory, snapshot.hashHistory, historyCount * sizeof(hashHistory[0]));
+}
+
+// Starts searching, on a background thread, the position after the reply the last
+// search predicted. Called right after the AI has moved; does nothing without a
+// prediction (book move) or if it is not legal here.
+void StartPondering() {
+    StopPondering();
+    if (!hasPredictedReply) return;
+    ChessMove moves[256];
+    int moveCount = 0;
+    GenerateLegalMoves(currentPlayer, moves, moveCount);
+    bool legal = false;
+    for (int i = 0; i < moveCount && !legal; i++) {
+        legal = moves[i].fromX == predictedReply.fromX && moves[i].fromY == predictedReply.fromY &&
+                moves[i].toX == predictedReply.toX && moves[i].toY == predictedReply.toY &&
+                moves[i].promotion == predictedReply.promotion;
+    }
+    if (!legal) return;
+    
+    SavePosition(ponderPosition);
+    MoveUndo undo;
+    MakeMove(predictedReply, undo);
+    ponderHash = positionHash;
+    UnmakeMove(predictedReply, undo);
+    
+    ChessMove predicted = predictedReply;
+    EngineConfig config = engineConfig;
+    ponderStop = false;
+    ponderDone = false;
+    ponderThread = std::thread([predicted, config]() {
+        // The position state is thread_local: take over the GUI thread's copy
+        RestorePosition(ponderPosition);
+        MoveUndo ponderUndo;
+        MakeMove(predicted, ponderUndo);
+        engineConfig = config;
+        searchStop = &ponderStop;
+        ponderMove = FindBestMove(engineConfig.depth);
+        ponderReply = predictedReply;
+        ponderHasReply = hasPredictedReply;
+        ponderDone = true;
+    });
+}
+
+// Aborts a running ponder search and waits for its thread
+void StopPondering() {
+    if (!ponderThread.joinable()) return;
+    ponderStop = true;
+    ponderThread.join();
+}
+
+// Called when the AI is to move. On a ponder hit (the human played the predicted move)
+// the background search is the AI's search: it is waited for if not finished yet and
+// its move returned. On a miss it is stopped and false returned.
+bool TakePonderResult(ChessMove& move) {
+    if (!ponderThread.joinable()) return false;
+    if (positionHash != ponderHash) {
+        StopPondering();
+        ponderMisses++;
+        return false;
+    }
+    ponderThread.join();
+    if (!ponderDone) return false;
+    ponderHits++;
+    move = ponderMove;
+    predictedReply = ponderReply;
+    hasPredictedReply = ponderHasReply;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Persistent analysis cache
+// ---------------------------------------------------------------------------
+
+// Content hash of the loaded network, so cached results of another network never match
+unsigned long long NnueNetworkHash() {
+    const unsigned char* bytes = (const unsigned char*)&nnueNet;
+    unsigned long long hash = 0xCBF29CE484222325ULL; // FNV-1a
+    for (size_t i = 0; i < sizeof(nnueNet); i++) hash = (hash ^ bytes[i]) * 0x100000001B3ULL;
+    return hash;
+}
+
+// Mixed into cache keys: a result only holds for the evaluator that produced it
+unsigned long long EvaluatorKey() {
+    unsigned long long key = engineConfig.nnue ? nnueNetHash : 0x6A09E667F3BCC909ULL;
+    if (!engineConfig.nnue) {
+        for (int i = 0; i < EVAL_PARAM_COUNT; i++) {
+            key = (key ^ (unsigned)engineConfig.evalWeights[i]) * 0x9E3779B97F4A7C15ULL;
+            key ^= key >> 29;
+        }
+    }
+    return key;
+}
+
+unsigned long long AnalysisKey() {
+    // Forward pruning changes what a search of a given depth returns
+    return positionHash ^ EvaluatorKey() ^ (unsigned long long)engineConfig.pruning * 0xBB67AE8584CAA73BULL;
+}
+
+// Entry data: score (20 bits, mate scores fit), depth (6), session generation (6),
+// PackMove() of the move (16) and of the predicted reply (16, 0 for none)
+const int ANALYSIS_CACHE_SCORE_LIMIT = (1 << 19) - 1;
+
+static inline unsigned long long PackCacheData(const ChessMove& move, unsigned short reply, int score, int depth,
+                                               int generation) {
+    score = Max(-ANALYSIS_CACHE_SCORE_LIMIT, Min(score, ANALYSIS_CACHE_SCORE_LIMIT));
+    return (unsigned long long)((unsigned)score & 0xFFFFF) | (unsigned long long)(Min(depth, 63)) << 20 |
+           (unsigned long long)(generation & 63) << 26 | (unsigned long long)PackMove(move) << 32 |
+           (unsigned long long)reply << 48;
+}
+
+static inline int CacheDataDepth(unsigned long long data) {
+    return (int)(data >> 20 & 63);
+}
+
+static inline int CacheDataAge(unsigned long long data) {
+    return (analysisCache.generation - (int)(data >> 26 & 63)) & 63;
+}
+
+static inline void UnpackCacheData(unsigned long long data, ChessMove& move, unsigned short& reply, int& score,
+                                   int& depth) {
+    score = (int)(data & 0xFFFFF);
+    if (score > ANALYSIS_CACHE_SCORE_LIMIT) score -= 1 << 20;
+    depth = CacheDataDepth(data);
+    move = UnpackMove((unsigned short)(data >> 32));
+    reply = (unsigned short)(data >> 48);
+}
+
+// Opens (or creates) the cache file. An existing valid file keeps its size unless sizeMb
+// asks for another one; a new, damaged or resized file starts empty. Each open is a new
+// session generation, which ages the entries of earlier sessions.
+bool OpenAnalysisCache(const char* path, int sizeMb) {
+    CloseAnalysisCache();
+    AnalysisCacheHeader header = {};
+    unsigned long long fileBytes = 0;
+#ifndef CHESS_HEADLESS
+    HANDLE file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
+                              OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER size;
+    DWORD read = 0;
+    if (GetFileSizeEx(file, &size)) fileBytes = (unsigned long long)size.QuadPart;
+    if (!ReadFile(file, &header, sizeof(header), &read, NULL) || read != sizeof(header)) memset(&header, 0, sizeof(header));
+#else
+    int file = open(path, O_RDWR | O_CREAT, 0644);
+    if (file < 0) return false;
+    struct stat info;
+    if (fstat(file, &info) == 0) fileBytes = (unsigned long long)info.st_size;
+    if (pread(file, &header, sizeof(header), 0) != (ssize_t)sizeof(header)) memset(&header, 0, sizeof(header));
+#endif
+    bool valid = memcmp(header.magic, ANALYSIS_CACHE_MAGIC, sizeof(header.magic)) == 0 &&
+                 header.bucketCount != 0 && (header.bucketCount & (header.bucketCount - 1)) == 0 &&
+                 fileBytes == sizeof(AnalysisCacheHeader) + header.bucketCount * sizeof(AnalysisCacheBucket);
+    unsigned long long bucketCount = valid ? header.bucketCount : 0;
+    if (sizeMb > 0 || !valid) {
+        unsigned long long budget = (unsigned long long)(sizeMb > 0 ? Min(sizeMb, ANALYSIS_CACHE_MAX_MB) : ANALYSIS_CACHE_DEFAULT_MB) << 20;
+        unsigned long long wanted = 1;
+        while (wanted * 2 * sizeof(AnalysisCacheBucket) <= budget) wanted *= 2;
+        if (wanted != bucketCount) {
+            valid = false;
+            bucketCount = wanted;
+        }
+    }
+    size_t bytes = (size_t)(sizeof(AnalysisCacheHeader) + bucketCount * sizeof(AnalysisCacheBucket));
+
+    // A fresh table is zero-filled (all entries empty); the magic goes in last, so a crash
+    // while creating it leaves a file that is rebuilt next time
+    void* view = NULL;
+#ifndef CHESS_HEADLESS
+    if (!valid) {
+        LARGE_INTEGER zero = {};
+        SetFilePointerEx(file, zero, NULL, FILE_BEGIN);
+        SetEndOfFile(file);
+    }
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READWRITE, (DWORD)((unsigned long long)bytes >> 32),
+                                        (DWORD)bytes, NULL);
+    if (mapping) view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, bytes);
+    if (!view) {
+        if (mapping) CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    analysisCache.file = file;
+    analysisCache.mapping = mapping;
+#else
+    if (!valid && (ftruncate(file, 0) != 0 || ftruncate(file, (off_t)bytes) != 0)) {
+        close(file);
+        return false;
+    }
+    view = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+    if (view == MAP_FAILED) {
+        close(file);
+        return false;
+    }
+    analysisCache.file = file;
+#endif
+    analysisCache.header = (AnalysisCacheHeader*)view;
+    analysisCache.buckets = (AnalysisCacheBucket*)((char*)view + sizeof(AnalysisCacheHeader));
+    analysisCache.bucketCount = bucketCount;
+    analysisCache.bytes = bytes;
+    if (!valid) {
+        analysisCache.header->bucketCount = bucketCount;
+        analysisCache.header->generation = 0;
+        FlushAnalysisCache(true);
+        memcpy(analysisCache.header->magic, ANALYSIS_CACHE_MAGIC, sizeof(header.magic));
+    }
+    analysisCache.generation = (int)(++analysisCache.header->generation & 63);
+    FlushAnalysisCache(true);
+    return true;
+}
+
+// Writes dirty pages back; 'wait' blocks until they are on disk
+void FlushAnalysisCache(bool wait) {
+    if (!analysisCache.header) return;
+#ifndef CHESS_HEADLESS
+    FlushViewOfFile(analysisCache.header, analysisCache.bytes);
+    if (wait) FlushFileBuffers(analysisCache.file);
+#else
+    msync(analysisCache.header, analysisCache.bytes, wait ? MS_SYNC : MS_ASYNC);
+#endif
+}
+
+void CloseAnalysisCache() {
+    if (!analysisCache.header) return;
+    FlushAnalysisCache(true);
+#ifndef CHESS_HEADLESS
+    UnmapViewOfFile(analysisCache.header);
+    CloseHandle(analysisCache.mapping);
+    CloseHandle(analysisCache.file);
+#else
+    munmap(analysisCache.header, analysisCache.bytes);
+    close(analysisCache.file);
+#endif
+    analysisCache.header = NULL;
+}
+
+// Entries store key ^ data next to data. A torn entry (a crash in the middle of a write,
+// or two threads or processes writing at once) fails the check and reads as empty.
+bool ProbeAnalysisCache(unsigned long long key, ChessMove& move, unsigned short& reply, int& score, int& depth) {
+    if (!analysisCache.header) return false;
+    AnalysisCacheBucket& bucket = analysisCache.buckets[key & (analysisCache.bucketCount - 1)];
+    for (int i = 0; i < ANALYSIS_CACHE_BUCKET_SIZE; i++) {
+        unsigned long long data = bucket.entries[i].data.load(std::memory_order_relaxed);
+        unsigned long long check = bucket.entries[i].check.load(std::memory_order_relaxed);
+        if (data != 0 && (check ^ data) == key) {
+            UnpackCacheData(data, move, reply, score, depth);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Same key: kept if the new result is at least as deep. Otherwise the bucket gives up
+// an empty entry, or else the one worth least: the shallowest, four plies per session of age.
+void StoreAnalysisCache(unsigned long long key, const ChessMove& move, const ChessMove* reply, int score, int depth) {
+    if (!analysisCache.header) return;
+    AnalysisCacheBucket& bucket = analysisCache.buckets[key & (analysisCache.bucketCount - 1)];
+    int victim = 0, victimWorth = 1 << 30;
+    for (int i = 0; i < ANALYSIS_CACHE_BUCKET_SIZE; i++) {
+        unsigned long long data = bucket.entries[i].data.load(std::memory_order_relaxed);
+        unsigned long long check = bucket.entries[i].check.load(std::memory_order_relaxed);
+        if (data != 0 && (check ^ data) == key) {
+            if (CacheDataDepth(data) > depth) return;
+            victim = i;
+            break;
+        }
+        int worth = (data == 0 || (check ^ data) == 0) ? -1000 : CacheDataDepth(data) - 4 * CacheDataAge(data);
+        if (worth < victimWorth) {
+            victim = i;
+            victimWorth = worth;
+        }
+    }
+    unsigned long long data = PackCacheData(move, reply ? PackMove(*reply) : 0, score, depth, analysisCache.generation);
+    bucket.entries[victim].data.store(data, std::memory_order_relaxed);
+    bucket.entries[victim].check.store(key ^ data, std::memory_order_relaxed);
+    analysisCacheStores++;
+}
+
+#ifdef CHESS_SEARCH_STATS
+void ResetSearchStats() {
+    memset(&searchStats, 0, sizeof(searchStats));
+}
+
+static void DumpTimingHistogram(FILE* out, const char* name, const TimingHistogram& h) {
+    fprintf(out, "\"%s\":{\"calls\":%llu,\"total_ns\":%llu,\"mean_ns\":%.1f,\"log2_ns_histogram\":[",
+            name, h.calls, h.totalNs, h.calls ? (double)h.totalNs / h.calls : 0.0);
+    for (int i = 0; i < STATS_HISTOGRAM_BUCKETS; i++) {
+        fprintf(out, i ? ",%llu" : "%llu", h.buckets[i]);
+    }
+    fprintf(out, "]}");
+}
+
+// Writes the current thread's counters as one JSON object per line
+void DumpSearchStats(FILE* out, int depth, double elapsedMs) {
+    const SearchStats& s = searchStats;
+    unsigned long long totalNodes = s.nodes + s.qnodes;
+    fprintf(out, "{\"depth\":%d,\"time_ms\":%.3f,\"nodes\":%llu,\"qnodes\":%llu,\"nps\":%.0f,",
+            depth, elapsedMs, s.nodes, s.qnodes, elapsedMs > 0 ? totalNodes * 1000.0 / elapsedMs : 0.0);
+    fprintf(out, "\"beta_cutoffs\":%llu,\"first_move_cutoffs\":%llu,\"first_move_cutoff_rate\":%.4f,",
+            s.betaCutoffs, s.firstMoveCutoffs,
+            s.betaCutoffs ? (double)s.firstMoveCutoffs / s.betaCutoffs : 0.0);
+    fprintf(out, "\"q_beta_cutoffs\":%llu,\"q_stand_pat_cutoffs\":%llu,\"tt_probes\":%llu,\"tt_hits\":%llu,",
+            s.qBetaCutoffs, s.qStandPatCutoffs, s.ttProbes, s.ttHits);
+    fprintf(out, "\"draws_by_rule\":%llu,", s.drawsByRule);
+    fprintf(out, "\"reverse_futility_cuts\":%llu,\"razor_cuts\":%llu,\"futility_pruned\":%llu,"
+                 "\"late_moves_pruned\":%llu,\"probcuts\":%llu,",
+            s.reverseFutilityCuts, s.razorCuts, s.futilityPruned, s.lateMovesPruned, s.probCuts);
+    DumpTimingHistogram(out, "evaluate_position", s.evaluatePosition);
+    fprintf(out, ",");
+    DumpTimingHistogram(out, "generate_legal_moves", s.generateLegalMoves);
+    fprintf(out, ",");
+    DumpTimingHistogram(out, "generate_capture_moves", s.generateCaptureMoves);
+    fprintf(out, "}\n");
+}
+#endif
+
+#if defined(CHESS_HEADLESS) && defined(CHESS_MICROBENCH)
+// Micro-benchmarks of the engine primitives (-DCHESS_HEADLESS -DCHESS_MICROBENCH, link
+// -lbenchmark). Each benchmark runs once per corpus position; the argument is the
+// corpus index and the label names the game phase.
+struct MicrobenchPosition {
+    const char* phase;
+    const char* fen;
+};
+
+const MicrobenchPosition microbenchCorpus[] = {
+    {"opening", "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"},
+    {"opening", "r1bqkb1r/pppp1ppp/2n2n2/4p3/2B1P3/5N2/PPPP1PPP/RNBQK2R w KQkq - 4 4"},
+    {"middlegame", "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1"},
+    {"middlegame", "4rrk1/pp1n3p/3q2pQ/2p1pb2/2PP4/2P3N1/P2B2PP/4RRK1 b - - 7 19"},
+    {"middlegame", "r3r1k1/2p2ppp/p1p1bn2/8/1q2P3/2NPQN2/PPP3PP/R4RK1 b - - 2 15"},
+    {"endgame", "6k1/6p1/6Pp/ppp5/3pn2P/1P3K2/1PP2P2/8 b - - 3 54"},
+    {"endgame", "8/3p4/p1bk3p/Pp6/1Kp1PpPp/2P2P1P/2P5/5B2 b - - 0 1"},
+    {"endgame", "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1"},
+};
+const int microbenchCorpusCount = sizeof(microbenchCorpus) / sizeof(microbenchCorpus[0]);
+
+static void SetUpCorpusPosition(benchmark::State& state) {
+    const MicrobenchPosition& position = microbenchCorpus[state.range(0)];
+    LoadFen(position.fen);
+    state.SetLabel(position.phase);
+}
+
+static void BM_GenerateLegalMoves(benchmark::State& state) {
+    SetUpCorpusPosition(state);
+    ChessMove moves[256];
+    int moveCount = 0;
+    for (auto _ : state) {
+        GenerateLegalMoves(currentPlayer, moves, moveCount);
+        benchmark::DoNotOptimize(moves);
+    }
+    state.SetItemsProcessed(state.iterations() * moveCount);
+}
+
+static void BM_GenerateCaptureMoves(benchmark::State& state) {
+    SetUpCorpusPosition(state);
+    ChessMove moves[256];
+    int moveCount = 0;
+    for (auto _ : state) {
+        GenerateCaptureMoves(currentPlayer, moves, moveCount);
+        benchmark::DoNotOptimize(moves);
+    }
+    state.SetItemsProcessed(state.iterations() * moveCount);
+}
+
+// One iteration asks about all 64 squares
+static void BM_IsSquareUnderAttack(benchmark::State& state) {
+    SetUpCorpusPosition(state);
+    for (auto _ : state) {
+        int attacked = 0;
+        for (int square = 0; square < 64; square++) {
+            attacked += IsSquareUnderAttack(square % 8, square / 8, currentPlayer);
+        }
+        benchmark::DoNotOptimize(attacked);
+    }
+    state.SetItemsProcessed(state.iterations() * 64);
+}
+
+static void BM_IsInCheck(benchmark::State& state) {
+    SetUpCorpusPosition(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(IsInCheck(currentPlayer));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_EvaluatePosition(benchmark::State& state) {
+    SetUpCorpusPosition(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(EvaluatePosition());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Both sides per iteration
+static void BM_EvaluatePawnStructure(benchmark::State& state) {
+    SetUpCorpusPosition(state);
+    for (auto _ : state) {
+        int terms[EVAL_PARAM_COUNT] = {};
+        AddPawnStructureTerms(1, 1, terms);
+        AddPawnStructureTerms(-1, -1, terms);
+        benchmark::DoNotOptimize(terms);
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+
+// The sorts work in place, so each iteration sorts a fresh copy of the generated list
+static void BM_SortMoves(benchmark::State& state) {
+    SetUpCorpusPosition(state);
+    ChessMove generated[256], moves[256];
+    int moveCount = 0;
+    GenerateLegalMoves(currentPlayer, generated, moveCount);
+    for (auto _ : state) {
+        memcpy(moves, generated, moveCount * sizeof(ChessMove));
+        SortMoves(moves, moveCount);
+        benchmark::DoNotOptimize(moves);
+    }
+    state.SetItemsProcessed(state.iterations() * moveCount);
+}
+
+static void BM_SortCaptures(benchmark::State& state) {
+    SetUpCorpusPosition(state);
+    ChessMove generated[256], moves[256];
+    int moveCount = 0;
+    GenerateCaptureMoves(currentPlayer, generated, moveCount);
+    for (auto _ : state) {
+        memcpy(moves, generated, moveCount * sizeof(ChessMove));
+        SortCaptures(moves, moveCount);
+        benchmark::DoNotOptimize(moves);
+    }
+    state.SetItemsProcessed(state.iterations() * moveCount);
+}
+
+// Make and unmake every legal move of the position once per iteration
+static void BM_MakeUnmakeMove(benchmark::State& state) {
+    SetUpCorpusPosition(state);
+    ChessMove moves[256];
+    int moveCount = 0;
+    GenerateLegalMoves(currentPlayer, moves, moveCount);
+    for (auto _ : state) {
+        for (int i = 0; i < moveCount; i++) {
+            MoveUndo undo;
+            MakeMove(moves[i], undo);
+            benchmark::DoNotOptimize(board);
+            UnmakeMove(moves[i], undo);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * moveCount);
+}
+
+#define CORPUS_BENCHMARK(function) BENCHMARK(function)->DenseRange(0, microbenchCorpusCount - 1)
+CORPUS_BENCHMARK(BM_GenerateLegalMoves);
+CORPUS_BENCHMARK(BM_GenerateCaptureMoves);
+CORPUS_BENCHMARK(BM_IsSquareUnderAttack);
+CORPUS_BENCHMARK(BM_IsInCheck);
+CORPUS_BENCHMARK(BM_EvaluatePosition);
+CORPUS_BENCHMARK(BM_EvaluatePawnStructure);
+CORPUS_BENCHMARK(BM_SortMoves);
+CORPUS_BENCHMARK(BM_SortCaptures);
+CORPUS_BENCHMARK(BM_MakeUnmakeMove);
+
+BENCHMARK_MAIN();
+#elif defined(CHESS_HEADLESS)
+// Positions searched by "bench": opening, middlegame and endgame mix
+const char* benchPositions[] = {
+    "rnbqkb1r/pppppppp/5n2/8/4P3/8/PPPP1PPP/RNBQKBNR w KQkq - 1 2",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "4rrk1/pp1n3p/3q2pQ/2p1pb2/2PP4/2P3N1/P2B2PP/4RRK1 b - - 7 19",
+    "r3r1k1/2p2ppp/p1p1bn2/8/1q2P3/2NPQN2/PPP3PP/R4RK1 b - - 2 15",
+    "r1bbk1nr/pp3p1p/2n5/1N4p1/2Np1B2/8/PPP2PPP/2KR1B1R w kq - 0 13",
+    "6k1/6p1/6Pp/ppp5/3pn2P/1P3K2/1PP2P2/8 b - - 3 54",
+    "8/3p4/p1bk3p/Pp6/1Kp1PpPp/2P2P1P/2P5/5B2 b - - 0 1",
+    "8/8/8/8/5kp1/P7/8/1K1N4 w - - 0 1",
+};
+const int benchPositionCount = sizeof(benchPositions) / sizeof(benchPositions[0]);
+
+// Searches one position and prints the result line, returns nodes searched
+unsigned long long RunSearch(const char* fen, int depth, bool verbose) {
+    if (!LoadFen(fen)) {
+        fprintf(stderr, "bad FEN: %s\n", fen);
+        return 0;
+    }
+    searchNodes = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    ChessMove move = SearchBestMove(depth);
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    if (verbose) {
+        char text[6];
+        MoveToString(move, text);
+        printf("%-72s bestmove %-5s nodes %10llu  time %9.1f ms\n", fen, text, searchNodes, ms);
+    }
+    return searchNodes;
+}
+
+// One timed search, as for a move with 'clock' left
+int GoCommand(const TimeControl& clock, const char* fen) {
+    if (!LoadFen(fen)) {
+        fprintf(stderr, "bad FEN: %s\n", fen);
+        return 1;
+    }
+    long long softMs, hardMs;
+    AllocateTime(clock, softMs, hardMs);
+    searchNodes = 0;
+    long long startUs = SteadyMicros();
+    int depth;
+    ChessMove move = SearchTimed(clock, TIME_MAX_DEPTH, depth);
+    double ms = (SteadyMicros() - startUs) / 1000.0;
+    char text[6];
+    MoveToString(move, text);
+    printf("bestmove %s score %d depth %d nodes %llu time %.1f ms (soft %lld ms, hard %lld ms)\n",
+           text, move.score, depth, searchNodes, ms, softMs, hardMs);
+    return 0;
+}
+
+// The best 'lines' moves with their scores and PVs
+int MultiPvCommand(int depth, int lines, const char* fen) {
+    if (!LoadFen(fen)) {
+        fprintf(stderr, "bad FEN: %s\n", fen);
+        return 1;
+    }
+    MultiPvLine found[MULTIPV_MAX_LINES];
+    searchNodes = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    int count = SearchMultiPV(depth, lines, found);
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    for (int i = 0; i < count; i++) {
+        char text[400];
+        FormatPvLine(found[i], text, sizeof(text));
+        printf("%2d  depth %2d  %s\n", i + 1, found[i].depth, text);
+    }
+    printf("Nodes searched  : %llu\n", searchNodes);
+    printf("Total time (ms) : %.1f\n", ms);
+    return 0;
+}
+
+// ---------------------------------------------------------------------------
+// Self-play match runner: config A vs config B, one game per thread, SPRT stop
+// ---------------------------------------------------------------------------
+
+// Used when no openings file is given: balanced positions after a few moves
+const char* defaultOpenings[] = {
+    "e2e4 e7e5 g1f3 b8c6",
+    "e2e4 c7c5 g1f3 d7d6",
+    "e2e4 e7e6 d2d4 d7d5",
+    "e2e4 c7c6 d2d4 d7d5",
+    "d2d4 d7d5 c2c4 e7e6",
+    "d2d4 g8f6 c2c4 g7g6",
+    "d2d4 g8f6 c2c4 e7e6",
+    "c2c4 e7e5 b1c3 g8f6",
+    "g1f3 d7d5 g2g3 g8f6",
+    "e2e4 d7d5 e4d5 d8d5",
+};
+
+// Parses "depth=3,book=0,nnue=1,weights=file" on top of the defaults
+bool ParseEngineConfig(const char* text, EngineConfig& config) {
+    std::string spec(text);
+    size_t start = 0;
+    while (start < spec.size()) {
+        size_t end = spec.find(',', start);
+        if (end == std::string::npos) end = spec.size();
+        std::string item = spec.substr(start, end - start);
+        size_t eq = item.find('=');
+        if (eq == std::string::npos) return false;
+        std::string key = item.substr(0, eq);
+        int value = atoi(item.c_str() + eq + 1);
+        if (key == "weights") {
+            // Tuned evaluation weights, shared by the config and its per-move copies
+            std::shared_ptr<std::vector<int>> weights = std::make_shared<std::vector<int>>(EVAL_PARAM_COUNT);
+            if (!LoadEvalWeights(item.c_str() + eq + 1, weights->data())) return false;
+            config.evalWeights = weights->data();
+            config.loadedWeights = weights;
+        }
+        else if (key == "depth") config.depth = value;
+        else if (key == "book") config.openingHeuristics = value != 0;
+        else if (key == "nnue") config.nnue = value != 0;
+        else if (key == "prune") config.pruning = value ? PRUNE_ALL : 0;
+        else if (key == "time") config.timeMs = Max(0, value);
+        else if (key == "inc") config.incrementMs = Max(0, value);
+        else if (key == "mtg") config.movesToGo = Max(0, value);
+        else {
+            int bit = -1;
+            for (int i = 0; i < 5; i++) {
+                if (key == pruneNames[i]) bit = i;
+            }
+            if (bit < 0) return false;
+            config.pruning = value ? config.pruning | 1 << bit : config.pruning & ~(1 << bit);
+        }
+        start = end + 1;
+    }
+    return true;
+}
+
+// An opening is either a FEN or a list of coordinate moves from the start position
+bool SetUpOpening(const std::string& opening) {
+    if (opening.find('/') != std::string::npos) return LoadFen(opening.c_str());
+    ResetGame();
+    size_t start = 0;
+    while (start < opening.size()) {
+        size_t end = opening.find(' ', start);
+        if (end == std::string::npos) end = opening.size();
+        std::string text = opening.substr(start, end - start);
+        if (!text.empty()) {
+            ChessMove move;
+            if (!ParseMove(text.c_str(), move)) return false;
+            MoveUndo undo;
+            MakeMove(move, undo);
+        }
+        start = end + 1;
+    }
+    return true;
+}
+
+// Bare kings, or a king and a single minor piece against a bare king
+bool IsInsufficientMaterial() {
+    int minors = 0;
+    for (int y = 0; y < 8; y++) {
+        for (int x = 0; x < 8; x++) {
+            int piece = abs(board[y][x]);
+            if (piece == WHITE_KNIGHT || piece == WHITE_BISHOP) minors++;
+            else if (piece != EMPTY && piece != WHITE_KING) return false;
+        }
+    }
+    return minors <= 1;
+}
+
+// Plays one game on the calling thread. Returns 1 white wins, -1 black wins, 0 draw.
+int PlayGame(const std::string& opening, const EngineConfig& white, const EngineConfig& black, int maxPlies) {
+    if (!SetUpOpening(opening)) {
+        fprintf(stderr, "bad opening: %s\n", opening.c_str());
+        return 0;
+    }
+
+    // Game clocks of configs with a time control; their searches go by time, not depth
+    TimeControl clocks[2];
+    const EngineConfig* configs[2] = {&white, &black};
+    for (int side = 0; side < 2; side++) {
+        clocks[side].remainingMs = configs[side]->timeMs;
+        clocks[side].incrementMs = configs[side]->incrementMs;
+        clocks[side].movesToGo = configs[side]->movesToGo;
+    }
+
+    for (int ply = 0; ; ply++) {
+        ChessMove moves[256];
+        int moveCount = 0;
+        GenerateLegalMoves(currentPlayer, moves, moveCount);
+        if (moveCount == 0) {
+            return IsInCheck(currentPlayer) ? -currentPlayer : 0; // Checkmate or stalemate
+        }
+        if (halfmoveClock >= 100 || IsInsufficientMaterial() || ply >= maxPlies) return 0;
+        if (CountRepetitions() >= 2) return 0; // Threefold
+
+        engineConfig = (currentPlayer == 1) ? white : black;
+        TimeControl& clock = clocks[currentPlayer == 1 ? 0 : 1];
+        bool timed = engineConfig.timeMs > 0;
+        searchClock = timed ? &clock : NULL;
+        long long startUs = SteadyMicros();
+        ChessMove move = FindBestMove(timed ? TIME_MAX_DEPTH : engineConfig.depth);
+        searchClock = NULL;
+        if (timed) {
+            long long usedMs = (SteadyMicros() - startUs) / 1000;
+            if (usedMs > clock.remainingMs) {
+                fprintf(stderr, "%s lost on time (%lld ms used, %lld ms left) in game from \"%s\"\n",
+                        currentPlayer == 1 ? "white" : "black", usedMs, clock.remainingMs, opening.c_str());
+                return -currentPlayer;
+            }
+            clock.remainingMs += clock.incrementMs - usedMs;
+            if (clock.movesToGo > 0 && --clock.movesToGo == 0) {
+                clock.movesToGo = engineConfig.movesToGo;
+                clock.remainingMs += engineConfig.timeMs;
+            }
+        }
+
+        bool legal = false;
+        for (int i = 0; i < moveCount && !legal; i++) {
+            legal = moves[i].fromX == move.fromX && moves[i].fromY == move.fromY &&
+                    moves[i].toX == move.toX && moves[i].toY == move.toY;
+        }
+        if (!legal) {
+            char text[6];
+            MoveToString(move, text);
+            fprintf(stderr, "illegal move %s in game from \"%s\", forfeited\n", text, opening.c_str());
+            return -currentPlayer;
+        }
+
+        MoveUndo undo;
+        MakeMove(move, undo); // Stays on the hash history
+    }
+}
+
+// Expected score of a side that is "elo" points stronger
+double EloToScore(double elo) {
+    return 1.0 / (1.0 + pow(10.0, -elo / 400.0));
+}
+
+double ScoreToElo(double score) {
+    return -400.0 * log10(1.0 / score - 1.0);
+}
+
+// Log-likelihood ratio of H1 (elo1) vs H0 (elo0) for a win/draw/loss record,
+// using the normal approximation of the trinomial GSPRT (as in cutechess/fishtest)
+double SprtLLR(int wins, int draws, int losses, double elo0, double elo1) {
+    int games = wins + draws + losses;
+    // Without both a win and a loss the variance estimate is zero or meaningless, so the LLR
+    // stays 0 as in cutechess; a one-sided match runs to its game limit instead of stopping
+    if (wins == 0 || losses == 0) return 0.0;
+    double w = (double)wins / games, d = (double)draws / games;
+    double score = w + d / 2;
+    double variance = w + d / 4 - score * score;
+    if (variance <= 0) return 0.0;
+    double s0 = EloToScore(elo0), s1 = EloToScore(elo1);
+    return 0.5 * games * (s1 - s0) * (2 * score - s0 - s1) / variance;
+}
+
+struct MatchSettings {
+    EngineConfig configA, configB;
+    int games;
+    int threads;
+    int maxPlies;
+    double elo0, elo1, alpha, beta;
+    std::vector<std::string> openings;
+};
+
+int RunMatch(const MatchSettings& settings) {
+    std::atomic<int> nextGame(0);
+    std::atomic<bool> stop(false);
+    std::mutex resultMutex;
+    int wins = 0, draws = 0, losses = 0; // From config A's point of view
+    double lowerBound = log(settings.beta / (1 - settings.alpha));
+    double upperBound = log((1 - settings.beta) / settings.alpha);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    auto worker = [&]() {
+        while (!stop) {
+            int game = nextGame++;
+            if (game >= settings.games) break;
+            // Each opening is played twice with colors reversed
+            const std::string& opening = settings.openings[(game / 2) % settings.openings.size()];
+            bool aIsWhite = (game % 2) == 0;
+            int result = aIsWhite ? PlayGame(opening, settings.configA, settings.configB, settings.maxPlies)
+                                  : -PlayGame(opening, settings.configB, settings.configA, settings.maxPlies);
+
+            std::lock_guard<std::mutex> lock(resultMutex);
+            if (result > 0) wins++;
+            else if (result < 0) losses++;
+            else draws++;
+            int played = wins + draws + losses;
+            double llr = SprtLLR(wins, draws, losses, settings.elo0, settings.elo1);
+            double score = (wins + draws / 2.0) / played;
+            double elo = (score > 0 && score < 1) ? ScoreToElo(score) : (score > 0 ? 999 : -999);
+            printf("Games %5d  +%d =%d -%d  Elo %+7.1f  LLR %6.2f [%.2f, %.2f]\n",
+                   played, wins, draws, losses, elo, llr, lowerBound, upperBound);
+            fflush(stdout);
+            if (llr >= upperBound || llr <= lowerBound) stop = true;
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (int i = 0; i < settings.threads; i++) pool.emplace_back(worker);
+    for (size_t i = 0; i < pool.size(); i++) pool[i].join();
+
+    int played = wins + draws + losses;
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    printf("===========================\n");
+    printf("Games           : %d (+%d =%d -%d) in %.1f s\n", played, wins, draws, losses, seconds);
+    if (played > 0) {
+        double w = (double)wins / played, d = (double)draws / played;
+        double score = w + d / 2;
+        double stdev = sqrt((w + d / 4 - score * score) / played);
+        if (score > 0 && score < 1) {
+            double low = score - 1.96 * stdev, high = score + 1.96 * stdev;
+            if (low < 0.0001) low = 0.0001;
+            printf("Elo (A - B)     : %+.1f  95%% [%+.1f, %+.1f]\n", ScoreToElo(score),
+                   ScoreToElo(low), high < 1 ? ScoreToElo(high) : 999.0);
+        }
+    }
+    double llr = SprtLLR(wins, draws, losses, settings.elo0, settings.elo1);
+    printf("SPRT            : elo0=%.1f elo1=%.1f alpha=%.3f beta=%.3f LLR=%.2f -> %s\n",
+           settings.elo0, settings.elo1, settings.alpha, settings.beta, llr,
+           llr >= upperBound ? "H1 accepted (A is stronger)" :
+           llr <= lowerBound ? "H0 accepted" : "inconclusive");
+    return 0;
+}
+
+int SelfPlayCommand(int argc, char* argv[]) {
+    MatchSettings settings;
+    // The opening shortcuts play the same moves every game, so matches measure the search alone
+    settings.configA.openingHeuristics = settings.configB.openingHeuristics = false;
+    settings.games = 1000;
+    settings.threads = Max(1, (int)std::thread::hardware_concurrency());
+    settings.maxPlies = 400;
+    settings.elo0 = 0;
+    settings.elo1 = 10;
+    settings.alpha = 0.05;
+    settings.beta = 0.05;
+    const char* openingsFile = NULL;
+
+    for (int i = 2; i + 1 < argc; i += 2) {
+        const char* option = argv[i];
+        const char* value = argv[i + 1];
+        if (strcmp(option, "--a") == 0) {
+            if (!ParseEngineConfig(value, settings.configA)) return fprintf(stderr, "bad config: %s\n", value), 1;
+        } else if (strcmp(option, "--b") == 0) {
+            if (!ParseEngineConfig(value, settings.configB)) return fprintf(stderr, "bad config: %s\n", value), 1;
+        }
+        else if (strcmp(option, "--games") == 0) settings.games = atoi(value);
+        else if (strcmp(option, "--threads") == 0) settings.threads = Max(1, atoi(value));
+        else if (strcmp(option, "--maxplies") == 0) settings.maxPlies = atoi(value);
+        else if (strcmp(option, "--elo0") == 0) settings.elo0 = atof(value);
+        else if (strcmp(option, "--elo1") == 0) settings.elo1 = atof(value);
+        else if (strcmp(option, "--alpha") == 0) settings.alpha = atof(value);
+        else if (strcmp(option, "--beta") == 0) settings.beta = atof(value);
+        else if (strcmp(option, "--openings") == 0) openingsFile = value;
+        else if (strcmp(option, "--net") == 0) {
+            if (!NnueLoad(value)) return fprintf(stderr, "cannot load network %s\n", value), 1;
+        }
+        else return fprintf(stderr, "unknown option: %s\n", option), 1;
+    }
+
+    if (openingsFile) {
+        FILE* file = fopen(openingsFile, "r");
+        if (!file) return fprintf(stderr, "cannot open %s\n", openingsFile), 1;
+        char line[512];
+        while (fgets(line, sizeof(line), file)) {
+            std::string opening(line);
+            while (!opening.empty() && (opening.back() == '\n' || opening.back() == '\r')) opening.pop_back();
+            if (!opening.empty() && opening[0] != '#') settings.openings.push_back(opening);
+        }
+        fclose(file);
+    } else {
+        for (size_t i = 0; i < sizeof(defaultOpenings) / sizeof(defaultOpenings[0]); i++) {
+            settings.openings.push_back(defaultOpenings[i]);
+        }
+    }
+    if (settings.openings.empty()) return fprintf(stderr, "no openings\n"), 1;
+
+    printf("Self-play: A depth=%d book=%d nnue=%d prune=%d time=%d+%d vs B depth=%d book=%d nnue=%d prune=%d time=%d+%d, "
+           "%d games on %d threads, %zu openings\n",
+           settings.configA.depth, settings.configA.openingHeuristics, settings.configA.nnue, settings.configA.pruning,
+           settings.configA.timeMs, settings.configA.incrementMs,
+           settings.configB.depth, settings.configB.openingHeuristics, settings.configB.nnue, settings.configB.pruning,
+           settings.configB.timeMs, settings.configB.incrementMs,
+           settings.games, settings.threads, settings.openings.size());
+    return RunMatch(settings);
+}
+
+// ---------------------------------------------------------------------------
+// The engine as a game for the shared searcher in game_search.h
+// ---------------------------------------------------------------------------
+struct ChessGame {
+    typedef ChessMove Move;
+    static const int MAX_MOVES = 256;
+    static const int WIN_SCORE = 100000;
+
+    MoveUndo undoStack[GAME_SEARCH_MAX_PLY];
+    int ply;
+
+    ChessGame() : ply(0) {}
+    int GenerateMoves(ChessMove moves[]) {
+        int count = 0;
+        GenerateLegalMoves(currentPlayer, moves, count);
+        SortMoves(moves, count);
+        return count;
+    }
+    void MakeMove(const ChessMove& move) { ::MakeMove(move, undoStack[ply++]); }
+    void UnmakeMove(const ChessMove& move) { ::UnmakeMove(move, undoStack[--ply]); }
+    bool IsTerminal(int& score) {
+        score = 0;
+        return IsInsufficientMaterial();
+    }
+    int NoMovesScore() { return IsInCheck(currentPlayer) ? -WIN_SCORE : 0; }
+    // Quiescence-resolved, so leaves are not scored in the middle of an exchange. The
+    // window turns white-relative for QuiescenceSearch() and back.
+    int Evaluate(int alpha, int beta) {
+        if (currentPlayer == 1) return QuiescenceSearch(alpha, beta, 1);
+        return -QuiescenceSearch(-beta, -alpha, -1);
+    }
+    unsigned long long Hash() { return positionHash; }
+    void MoveToText(const ChessMove& move, char out[16]) { MoveToString(move, out); }
+};
+
+bool SetUpBenchPosition(ChessGame& game, int index) {
+    game.ply = 0;
+    return LoadFen(benchPositions[index]);
+}
+
+// Pondering in a game against a stand-in for the human: white searches on the main
+// thread and then "thinks" for thinkMs more, while black ponders in the background.
+// Reports black's response times.
+int PonderCommand(int depth, int plies, int thinkMs) {
+    ResetGame();
+    engineConfig.depth = depth;
+    engineConfig.openingHeuristics = false;
+    double hitMs = 0, missMs = 0;
+    int hits = 0, misses = 0;
+    for (int ply = 0; ply < plies; ply++) {
+        ChessMove moves[256];
+        int moveCount = 0;
+        GenerateLegalMoves(currentPlayer, moves, moveCount);
+        if (moveCount == 0 || halfmoveClock >= 100 || CountRepetitions() >= 2) break;
+        
+        ChessMove move;
+        if (currentPlayer == 1) {
+            move = FindBestMove(depth); // The "human", the ponder thread runs meanwhile
+            std::this_thread::sleep_for(std::chrono::milliseconds(thinkMs));
+        } else {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            bool hit = TakePonderResult(move);
+            if (!hit) move = FindBestMove(depth);
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            char text[6];
+            MoveToString(move, text);
+            printf("ply %3d  %-5s  %-4s  response %9.2f ms\n", ply + 1, text, hit ? "hit" : "miss", ms);
+            if (hit) { hits++; hitMs += ms; } else { misses++; missMs += ms; }
+        }
+        MoveUndo undo;
+        MakeMove(move, undo);
+        if (currentPlayer == 1) StartPondering();
+    }
+    StopPondering();
+    printf("===========================\n");
+    printf("Ponder hits     : %d (avg response %.2f ms)\n", hits, hits ? hitMs / hits : 0.0);
+    printf("Ponder misses   : %d (avg response %.2f ms)\n", misses, misses ? missMs / misses : 0.0);
+    return 0;
+}
+
+// ---------------------------------------------------------------------------
+// NNUE checks and benchmarks
+// ---------------------------------------------------------------------------
+
+// Random weights over the full int8 range, small enough in the feature transformer that
+// the int16 accumulators cannot overflow; exercises every kernel path
+void NnueRandomNetwork(unsigned long long seed) {
+    auto next = [&seed]() {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        return (int)(seed >> 33);
+    };
+    for (int i = 0; i < NNUE_HIDDEN; i++) nnueNet.ftBias[i] = (int16_t)(next() % 64);
+    for (int i = 0; i < NNUE_FEATURES * NNUE_HIDDEN; i++) nnueNet.ftWeights[i] = (int16_t)(next() % 33 - 16);
+    for (int i = 0; i < NNUE_FEATURES; i++) nnueNet.ftPsqt[i] = next() % 201 - 100;
+    for (int i = 0; i < NNUE_L1; i++) nnueNet.l1Bias[i] = next() % 4001 - 2000;
+    for (int i = 0; i < NNUE_L1 * 2 * NNUE_HIDDEN; i++) nnueNet.l1Weights[i] = (int8_t)(next() & 255);
+    for (int i = 0; i < NNUE_L2; i++) nnueNet.l2Bias[i] = next() % 4001 - 2000;
+    for (int i = 0; i < NNUE_L2 * NNUE_L1; i++) nnueNet.l2Weights[i] = (int8_t)(next() & 255);
+    nnueNet.outBias = next() % 4001 - 2000;
+    for (int i = 0; i < NNUE_L2; i++) nnueNet.outWeights[i] = (int8_t)(next() & 255);
+}
+
+// Walks the tree below the current position comparing, at every node, the incrementally
+// updated accumulators with a scalar refresh and the score of every supported kernel set.
+// Returns the number of nodes that disagree.
+int NnueCheckTree(int depth, unsigned long long& nodes) {
+    nodes++;
+    int score = NnueEvaluate();
+    const NnueAccumulator& acc = nnueStack[nnueTop];
+    NnueKernels active = nnueKernels;
+    nnueKernels = nnueKernelSets[nnueKernelSetCount - 1];
+    NnueAccumulator fresh;
+    NnueRefresh(fresh);
+    bool same = memcmp(fresh.values, acc.values, sizeof(fresh.values)) == 0 &&
+                fresh.psqt[0] == acc.psqt[0] && fresh.psqt[1] == acc.psqt[1];
+    for (int i = 0; i < nnueKernelSetCount; i++) {
+        if (!NnueKernelsSupported(nnueKernelSets[i])) continue;
+        nnueKernels = nnueKernelSets[i];
+        if (NnueEvaluate() != score) same = false;
+    }
+    nnueKernels = active;
+    int bad = same ? 0 : 1;
+    if (depth == 0) return bad;
+    
+    ChessMove moves[256];
+    int moveCount = 0;
+    GenerateLegalMoves(currentPlayer, moves, moveCount);
+    for (int i = 0; i < moveCount; i++) {
+        MoveUndo undo;
+        MakeMove(moves[i], undo);
+        bad += NnueCheckTree(depth - 1, nodes);
+        UnmakeMove(moves[i], undo);
+    }
+    return bad;
+}
+
+// Make, evaluate and unmake every legal move of the bench positions 'rounds' times.
+// mode 0: EvaluatePosition(), 1: NNUE with incremental accumulators, 2: NNUE refreshed
+// at every evaluation. Returns evaluations per second.
+double EvalThroughput(int mode, int rounds) {
+    engineConfig.nnue = (mode != 0);
+    unsigned long long evals = 0;
+    long long sink = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        for (int p = 0; p < benchPositionCount; p++) {
+            LoadFen(benchPositions[p]);
+            if (mode == 1) NnueRefresh(nnueStack[nnueTop]); // The parent the moves update from
+            ChessMove moves[256];
+            int moveCount = 0;
+            GenerateLegalMoves(currentPlayer, moves, moveCount);
+            for (int i = 0; i < moveCount; i++) {
+                MoveUndo undo;
+                MakeMove(moves[i], undo);
+                if (mode == 2) nnueStack[nnueTop].valid = false;
+                sink += (mode == 0) ? EvaluatePosition() : NnueEvaluate();
+                UnmakeMove(moves[i], undo);
+                evals++;
+            }
+        }
+    }
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    if (sink == 42) printf(" "); // Keeps the evaluations from being optimized away
+    return ms > 0 ? evals * 1000.0 / ms : 0.0;
+}
+
+// Bench position search at 'depth' with the classical or the NNUE evaluator, nodes per second
+double SearchThroughput(bool nnue, int depth) {
+    engineConfig.nnue = nnue;
+    unsigned long long nodes = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i = 0; i < benchPositionCount; i++) nodes += RunSearch(benchPositions[i], depth, false);
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return ms > 0 ? nodes * 1000.0 / ms : 0.0;
+}
+
+// nnue bench [depth] [games] [net file]: evaluation and search speed per kernel set against the
+// classical evaluator, then a self-play match NNUE vs classical at 'depth'
+// nnue check [depth]: incremental vs refreshed accumulators and all kernel sets agree
+// nnue export <file>: writes the loaded (or built-in) network
+int NnueCommand(int argc, char* argv[]) {
+    const char* mode = (argc > 2) ? argv[2] : "bench";
+    if (strcmp(mode, "export") == 0 && argc > 3) {
+        if (!NnueSave(argv[3])) return fprintf(stderr, "cannot write %s\n", argv[3]), 1;
+        return 0;
+    }
+    if (strcmp(mode, "check") == 0) {
+        int depth = (argc > 3) ? atoi(argv[3]) : 3;
+        NnueRandomNetwork(12345);
+        engineConfig.nnue = true;
+        unsigned long long nodes = 0;
+        int bad = 0;
+        for (int i = 0; i < benchPositionCount; i++) {
+            LoadFen(benchPositions[i]);
+            bad += NnueCheckTree(depth, nodes);
+        }
+        printf("Kernels         :");
+        for (int i = 0; i < nnueKernelSetCount; i++) {
+            if (NnueKernelsSupported(nnueKernelSets[i])) printf(" %s", nnueKernelSets[i].name);
+        }
+        printf("\nNodes checked   : %llu\nMismatches      : %d\n", nodes, bad);
+        return bad != 0;
+    }
+    if (strcmp(mode, "bench") != 0) return fprintf(stderr, "unknown nnue command: %s\n", mode), 1;
+    
+    int depth = (argc > 3) ? atoi(argv[3]) : 3;
+    int games = (argc > 4) ? atoi(argv[4]) : 20;
+    if (argc > 5 && !NnueLoad(argv[5])) return fprintf(stderr, "cannot load network %s\n", argv[5]), 1;
+    const int rounds = 200;
+    NnueKernels best = nnueKernels;
+    printf("%-18s %14s %14s\n", "evaluator", "evals/s", "search nps");
+    printf("%-18s %14.0f %14.0f\n", "classical", EvalThroughput(0, rounds), SearchThroughput(false, depth));
+    for (int i = 0; i < nnueKernelSetCount; i++) {
+        if (!NnueKernelsSupported(nnueKernelSets[i])) continue;
+        nnueKernels = nnueKernelSets[i];
+        char name[32];
+        snprintf(name, sizeof(name), "nnue %s", nnueKernels.name);
+        printf("%-18s %14.0f %14.0f\n", name, EvalThroughput(1, rounds), SearchThroughput(true, depth));
+        snprintf(name, sizeof(name), "nnue %s refresh", nnueKernels.name);
+        printf("%-18s %14.0f %14s\n", name, EvalThroughput(2, rounds), "-");
+    }
+    nnueKernels = best;
+    if (games <= 0) return 0;
+    
+    MatchSettings settings;
+    settings.configA.depth = settings.configB.depth = depth;
+    settings.configA.openingHeuristics = settings.configB.openingHeuristics = false;
+    settings.configA.nnue = true;
+    settings.games = games;
+    settings.threads = Max(1, (int)std::thread::hardware_concurrency());
+    settings.maxPlies = 400;
+    settings.elo0 = 0;
+    settings.elo1 = 10;
+    settings.alpha = 0.05;
+    settings.beta = 0.05;
+    for (size_t i = 0; i < sizeof(defaultOpenings) / sizeof(defaultOpenings[0]); i++) {
+        settings.openings.push_back(defaultOpenings[i]);
+    }
+    printf("Match: A nnue (%s) vs B classical, depth %d, %d games\n", nnueKernels.name, depth, games);
+    return RunMatch(settings);
+}
+
+// ---------------------------------------------------------------------------
+// Texel tuning of the evaluation weights
+// ---------------------------------------------------------------------------
+
+// Results of "FEN [1.0]" or "FEN ... 1-0" / "0-1" / "1/2-1/2" lines, from white's side
+bool ParseTuneResult(const char* line, float& result) {
+    const char* bracket = strchr(line, '[');
+    if (bracket) {
+        result = (float)atof(bracket + 1);
+        return true;
+    }
+    if (strstr(line, "1/2-1/2")) result = 0.5f;
+    else if (strstr(line, "1-0")) result = 1.0f;
+    else if (strstr(line, "0-1")) result = 0.0f;
+    else return false;
+    return true;
+}
+
+// gendata <file> [games] [depth] [threads]: self-play games, 8 random plies and then
+// searched moves; every quiet position after the random part (not in check, quiescence
+// search equal to the static evaluation) is written as "FEN [result]"
+int GenDataCommand(int argc, char* argv[]) {
+    if (argc < 3) return fprintf(stderr, "usage: %s gendata <file> [games] [depth] [threads]\n", argv[0]), 1;
+    FILE* out = fopen(argv[2], "w");
+    if (!out) return fprintf(stderr, "cannot write %s\n", argv[2]), 1;
+    int games = (argc > 3) ? atoi(argv[3]) : 1000;
+    int depth = (argc > 4) ? atoi(argv[4]) : 2;
+    int threads = (argc > 5) ? Max(1, atoi(argv[5])) : Max(1, (int)std::thread::hardware_concurrency());
+    const int randomPlies = 8;
+    std::atomic<int> nextGame(0);
+    std::mutex outMutex;
+    unsigned long long written = 0;
+    
+    auto worker = [&]() {
+        for (int game = nextGame++; game < games; game = nextGame++) {
+            unsigned long long seed = 0x9E3779B97F4A7C15ULL * (game + 1);
+            ResetGame();
+            engineConfig = EngineConfig();
+            engineConfig.depth = depth;
+            engineConfig.openingHeuristics = false;
+            std::vector<std::string> fens;
+            float result = 0.5f;
+            for (int ply = 0; ply < 400; ply++) {
+                ChessMove moves[256];
+                int moveCount = 0;
+                GenerateLegalMoves(currentPlayer, moves, moveCount);
+                bool inCheck = IsInCheck(currentPlayer);
+                if (moveCount == 0) {
+                    if (inCheck) result = currentPlayer == 1 ? 0.0f : 1.0f;
+                    break;
+                }
+                if (halfmoveClock >= 100 || IsInsufficientMaterial() || CountRepetitions() >= 2) break;
+                
+                ChessMove move;
+                if (ply < randomPlies) {
+                    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+                    move = moves[(seed >> 33) % moveCount];
+                } else {
+                    if (!inCheck && QuiescenceSearch(-1000000, 1000000, currentPlayer) == EvaluatePosition()) {
+                        char fen[100];
+                        PositionToFen(fen);
+                        fens.push_back(fen);
+                    }
+                    move = FindBestMove(depth);
+                }
+                MoveUndo undo;
+                MakeMove(move, undo);
+            }
+            std::lock_guard<std::mutex> lock(outMutex);
+            for (size_t i = 0; i < fens.size(); i++) fprintf(out, "%s [%.1f]\n", fens[i].c_str(), result);
+            written += fens.size();
+        }
+    };
+    std::vector<std::thread> pool;
+    for (int i = 0; i < threads; i++) pool.emplace_back(worker);
+    for (size_t i = 0; i < pool.size(); i++) pool[i].join();
+    fclose(out);
+    printf("Positions       : %llu from %d games\n", written, games);
+    return 0;
+}
+
+// Training positions in a compact form: per position the EvaluationTerms() counts as
+// int16, padded to a SIMD-friendly stride, and the game result
+const int TUNE_STRIDE = (EVAL_PARAM_COUNT + 7) & ~7;
+struct TuneData {
+    std::vector<int16_t> terms;
+    std::vector<float> results;
+    size_t Count() const { return results.size(); }
+};
+
+// Squared sigmoid error over positions [begin, end); with 'grad' also adds, per weight,
+// sum of (result - sigmoid) * sigmoid' * term, the loss gradient up to a -2k/N factor
+double TuneErrorRange(const TuneData& data, const float weights[TUNE_STRIDE], double k, size_t begin, size_t end,
+                      double grad[TUNE_STRIDE]) {
+    double error = 0;
+    float partial[TUNE_STRIDE] = {};
+    for (size_t p = begin; p < end; p++) {
+        const int16_t* terms = &data.terms[p * TUNE_STRIDE];
+        float score = 0;
+        for (int i = 0; i < TUNE_STRIDE; i++) score += weights[i] * terms[i];
+        double sigmoid = 1.0 / (1.0 + exp(-k * score));
+        double diff = data.results[p] - sigmoid;
+        error += diff * diff;
+        if (grad) {
+            float g = (float)(diff * sigmoid * (1 - sigmoid));
+            for (int i = 0; i < TUNE_STRIDE; i++) partial[i] += g * terms[i];
+        }
+        // Flush the float partial sums now and then so millions of positions keep precision
+        if (grad && ((p - begin) & 4095) == 4095) {
+            for (int i = 0; i < TUNE_STRIDE; i++) grad[i] += partial[i];
+            memset(partial, 0, sizeof(partial));
+        }
+    }
+    if (grad) {
+        for (int i = 0; i < TUNE_STRIDE; i++) grad[i] += partial[i];
+    }
+    return error;
+}
+
+// Mean error over all positions, split across 'threads'; fills grad when given
+double TuneError(const TuneData& data, const float weights[TUNE_STRIDE], double k, int threads,
+                 double grad[TUNE_STRIDE]) {
+    size_t count = data.Count();
+    std::vector<double> errors(threads, 0.0);
+    std::vector<double> grads(threads * TUNE_STRIDE, 0.0);
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; t++) {
+        pool.emplace_back([&, t]() {
+            errors[t] = TuneErrorRange(data, weights, k, count * t / threads, count * (t + 1) / threads,
+                                       grad ? &grads[t * TUNE_STRIDE] : NULL);
+        });
+    }
+    double error = 0;
+    for (int t = 0; t < threads; t++) {
+        pool[t].join();
+        error += errors[t];
+    }
+    if (grad) {
+        for (int i = 0; i < TUNE_STRIDE; i++) {
+            grad[i] = 0;
+            for (int t = 0; t < threads; t++) grad[i] += grads[t * TUNE_STRIDE + i];
+        }
+    }
+    return count ? error / count : 0.0;
+}
+
+// Reads the positions file and extracts the terms on 'threads' threads; lines without a
+// result, unreadable FENs and positions in check are skipped
+bool LoadTuneData(const char* path, int threads, TuneData& data) {
+    FILE* file = fopen(path, "r");
+    if (!file) return false;
+    std::vector<std::string> lines;
+    char line[512];
+    while (fgets(line, sizeof(line), file)) lines.push_back(line);
+    fclose(file);
+    
+    std::vector<TuneData> parts(threads);
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; t++) {
+        pool.emplace_back([&, t]() {
+            TuneData& part = parts[t];
+            for (size_t i = lines.size() * t / threads; i < lines.size() * (t + 1) / threads; i++) {
+                float result;
+                if (!ParseTuneResult(lines[i].c_str(), result) || !LoadFen(lines[i].c_str())) continue;
+                if (IsInCheck(currentPlayer)) continue;
+                int terms[EVAL_PARAM_COUNT];
+                EvaluationTerms(terms);
+                for (int j = 0; j < TUNE_STRIDE; j++) part.terms.push_back((int16_t)(j < EVAL_PARAM_COUNT ? terms[j] : 0));
+                part.results.push_back(result);
+            }
+        });
+    }
+    for (int t = 0; t < threads; t++) {
+        pool[t].join();
+        data.terms.insert(data.terms.end(), parts[t].terms.begin(), parts[t].terms.end());
+        data.results.insert(data.results.end(), parts[t].results.begin(), parts[t].results.end());
+    }
+    return true;
+}
+
+// tune <positions file> [--epochs N] [--lr X] [--threads N] [--weights file] [--out file]:
+// fits the sigmoid scale to the starting weights, then minimizes the error with Adam
+int TuneCommand(int argc, char* argv[]) {
+    if (argc < 3) {
+        return fprintf(stderr, "usage: %s tune <positions file> [--epochs N] [--lr X] [--threads N]"
+                               " [--weights file] [--out file]\n", argv[0]), 1;
+    }
+    int epochs = 2000;
+    double rate = 1.0;
+    int threads = Max(1, (int)std::thread::hardware_concurrency());
+    const char* outPath = "tuned_weights.txt"; // Not eval_weights.txt, which the GUI loads
+    int start[EVAL_PARAM_COUNT];
+    memcpy(start, defaultEvalWeights, sizeof(start));
+    for (int i = 3; i + 1 < argc; i += 2) {
+        const char* option = argv[i];
+        const char* value = argv[i + 1];
+        if (strcmp(option, "--epochs") == 0) epochs = atoi(value);
+        else if (strcmp(option, "--lr") == 0) rate = atof(value);
+        else if (strcmp(option, "--threads") == 0) threads = Max(1, atoi(value));
+        else if (strcmp(option, "--out") == 0) outPath = value;
+        else if (strcmp(option, "--weights") == 0) {
+            if (!LoadEvalWeights(value, start)) return fprintf(stderr, "cannot load weights %s\n", value), 1;
+        }
+        else return fprintf(stderr, "unknown option: %s\n", option), 1;
+    }
+    
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    TuneData data;
+    if (!LoadTuneData(argv[2], threads, data)) return fprintf(stderr, "cannot read %s\n", argv[2]), 1;
+    if (data.Count() == 0) return fprintf(stderr, "no positions in %s\n", argv[2]), 1;
+    double loadSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    printf("Positions       : %zu (%.1f MB, loaded in %.1f s on %d threads)\n", data.Count(),
+           (data.terms.size() * sizeof(int16_t) + data.results.size() * sizeof(float)) / 1048576.0, loadSeconds, threads);
+    
+    float weights[TUNE_STRIDE] = {};
+    double tuned[TUNE_STRIDE] = {};
+    for (int i = 0; i < EVAL_PARAM_COUNT; i++) weights[i] = (float)(tuned[i] = start[i]);
+    
+    // Sigmoid scale: k = K * ln(10) / 400 with K minimizing the error of the start weights
+    double low = 0.1, high = 3.0;
+    for (int i = 0; i < 40; i++) {
+        double a = low + (high - low) / 3, b = high - (high - low) / 3;
+        double errorA = TuneError(data, weights, a * log(10.0) / 400, threads, NULL);
+        double errorB = TuneError(data, weights, b * log(10.0) / 400, threads, NULL);
+        if (errorA < errorB) high = b;
+        else low = a;
+    }
+    double k = (low + high) / 2 * log(10.0) / 400;
+    printf("Scale K         : %.3f, start error %.6f\n", (low + high) / 2, TuneError(data, weights, k, threads, NULL));
+    
+    // Adam; the king weight only matters once a king is captured, no data position has that
+    const double beta1 = 0.9, beta2 = 0.999, epsilon = 1e-8;
+    double m[TUNE_STRIDE] = {}, v[TUNE_STRIDE] = {};
+    for (int epoch = 1; epoch <= epochs; epoch++) {
+        double grad[TUNE_STRIDE];
+        double error = TuneError(data, weights, k, threads, grad);
+        for (int i = 0; i < EVAL_PARAM_COUNT; i++) {
+            if (i == EVAL_KING) continue;
+            double g = -2.0 * k * grad[i] / data.Count();
+            m[i] = beta1 * m[i] + (1 - beta1) * g;
+            v[i] = beta2 * v[i] + (1 - beta2) * g * g;
+            double mHat = m[i] / (1 - pow(beta1, epoch));
+            double vHat = v[i] / (1 - pow(beta2, epoch));
+            tuned[i] -= rate * mHat / (sqrt(vHat) + epsilon);
+            weights[i] = (float)tuned[i];
+        }
+        if (epoch % 100 == 0 || epoch == epochs) {
+            printf("Epoch %5d     : error %.6f  (%.1f s)\n", epoch, error,
+                   std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count());
+            fflush(stdout);
+        }
+    }
+    
+    int result[EVAL_PARAM_COUNT];
+    for (int i = 0; i < EVAL_PARAM_COUNT; i++) {
+        result[i] = (int)floor(tuned[i] + 0.5);
+        weights[i] = (float)result[i];
+        printf("  %-16s %6d -> %6d\n", evalParamNames[i], start[i], result[i]);
+    }
+    printf("Final error     : %.6f\n", TuneError(data, weights, k, threads, NULL));
+    if (!SaveEvalWeights(outPath, result)) return fprintf(stderr, "cannot write %s\n", outPath), 1;
+    printf("Weights written to %s\n", outPath);
+    return 0;
+}
+
+// ---------------------------------------------------------------------------
+// Multi-game server: many independent games behind a Unix domain socket
+// ---------------------------------------------------------------------------
+//
+// One command per line, one reply line each. Replies start with the game id (0 when there
+// is none) so "go" commands can be pipelined and answered in any order:
+//
+//   new [depth D] [ms T] [clock C] [inc I] [fen <FEN>]  -> "<id> ok"
+//   move <id> <move>                                    -> "<id> ok"
+//   go <id>                                             -> "<id> bestmove <move> score <cp> depth <d> time <ms>"
+//                                                          or "<id> gameover 1-0|0-1|1/2-1/2"
+//   fen <id>                                            -> "<id> fen <FEN>"
+//   free <id>                                           -> "<id> ok"
+//   stats                                               -> "0 stats games <n> searches <n> nodes <n> queued <n>"
+//
+// and "<id> error <reason>" on failure. Each game keeps its position and move history in a
+// PositionSnapshot; "go" is queued to a fixed pool of workers, which restore the game,
+// search it with SearchMultiPV() and save it back. A search gets the game's per-move
+// time (ms) or the soft limit AllocateTime() gives its clock (plus increment I after each
+// move), whichever is smaller; a timer thread raises the worker's
+// stop flag when it runs out, and the last completed iteration is played. The workers
+// share one transposition table cut into partitions, a game always searching its own,
+// so hundreds of games do not evict each other's entries. With --pin 1 each NUMA node
+// owns a block of the partitions: its workers place that block in the node's memory and
+// serve only the games searching in it. A client's games are freed when it disconnects.
+
+struct ServerConnection {
+    int fd;
+    std::mutex writeMutex;             // Workers and the reader thread both answer
+    std::atomic<bool> sessionDone;     // ServerSession() has returned, its thread can be joined
+
+    explicit ServerConnection(int fd) : fd(fd), sessionDone(false) {}
+    ~ServerConnection() { close(fd); } // After the last reply of a search still running
+};
+
+struct ServerGame {
+    int id;
+    const ServerConnection* owner;
+    int depth;
+    int moveMs;                        // Per-move limit, 0 for none
+    long long clockMs;                 // Engine time left for the game, < 0 for no clock
+    int incrementMs;                   // ... added after each move
+    bool busy;                         // A "go" is queued or running
+    PositionSnapshot position;
+};
+
+struct ServerJob {
+    std::shared_ptr<ServerGame> game;
+    std::shared_ptr<ServerConnection> connection;
+};
+
+// A client's reader thread, joined by ServeCommand() once done or at shutdown
+struct ServerSessionThread {
+    std::thread thread;
+    std::shared_ptr<ServerConnection> connection;
+};
+
+struct ServerWorkerClock {
+    std::atomic<bool> stop;
+    std::atomic<long long> deadlineUs; // steady_clock microseconds, 0 while idle
+};
+
+// The jobs of the games whose partitions one node owns, see ServerPartitionNode()
+struct ServerNodeQueue {
+    std::deque<ServerJob> jobs;
+    std::condition_variable work;
+};
+
+std::mutex serverMutex;                // Games, job queues, counters
+std::map<int, std::shared_ptr<ServerGame>> serverGames;
+int serverNextGameId = 1;
+bool serverStopping = false;
+unsigned long long serverSearches = 0, serverNodes = 0;
+LargeTable serverTable = {};
+bool serverPin = false;                // Workers spread over the NUMA nodes, see PinThreadToNumaNode()
+std::atomic<int> serverCleared(0);     // Workers done clearing their part of the table
+int serverPartitions = 1;
+size_t serverPartitionSize = 1;
+int serverNodeCount = 1;               // Nodes with a queue of their own: 1 unless pinned
+std::unique_ptr<ServerNodeQueue[]> serverQueues;
+std::unique_ptr<ServerWorkerClock[]> serverClocks;
+volatile sig_atomic_t serverInterrupted = 0;
+
+// Writes all of 'text' plus a newline; false once the peer is gone
+bool SendLine(int fd, const std::string& text) {
+    std::string line = text + "\n";
+    size_t sent = 0;
+    while (sent < line.size()) {
+        ssize_t n = send(fd, line.data() + sent, line.size() - sent, MSG_NOSIGNAL);
+        if (n <= 0) return false;
+        sent += (size_t)n;
+    }
+    return true;
+}
+
+void ServerReply(ServerConnection& connection, const std::string& text) {
+    std::lock_guard<std::mutex> lock(connection.writeMutex);
+    SendLine(connection.fd, text);
+}
+
+// Buffered line reader over a socket
+struct LineReader {
+    int fd;
+    char buffer[4096];
+    int start, end;
+
+    explicit LineReader(int fd) : fd(fd), start(0), end(0) {}
+
+    bool ReadLine(std::string& line) {
+        line.clear();
+        for (;;) {
+            for (; start < end; start++) {
+                if (buffer[start] == '\n') {
+                    start++;
+                    return true;
+                }
+                if (buffer[start] != '\r') line += buffer[start];
+            }
+            ssize_t n = recv(fd, buffer, sizeof(buffer), 0);
+            if (n <= 0) return false;
+            start = 0;
+            end = (int)n;
+        }
+    }
+};
+
+// Set up on the worker's thread: the game's position, as after the moves played so far
+const char* ServerGameResult() {
+    ChessMove moves[256];
+    int moveCount = 0;
+    GenerateLegalMoves(currentPlayer, moves, moveCount);
+    if (moveCount == 0) return !IsInCheck(currentPlayer) ? "1/2-1/2" : currentPlayer == 1 ? "0-1" : "1-0";
+    if (halfmoveClock >= 100 || CountRepetitions() >= 2 || IsInsufficientMaterial()) return "1/2-1/2";
+    return NULL;
+}
+
+// Node n owns a contiguous block of partitions, so its part of the table is one range
+int ServerPartitionNode(int partition) {
+    return (int)((long long)partition * serverNodeCount / serverPartitions);
+}
+
+int ServerFirstPartition(int node) {
+    return (int)(((long long)node * serverPartitions + serverNodeCount - 1) / serverNodeCount);
+}
+
+void ServerWorker(int index, int workers) {
+    ServerWorkerClock& clock = serverClocks[index];
+    searchStop = &clock.stop;
+    int node, cpu;
+    if (serverPin && !PinThreadToNumaNode(index, node, cpu)) fprintf(stderr, "worker %d: cannot pin to cpu %d\n", index, cpu);
+    // Worker i runs on node i % nodes (PinThreadToNumaNode()); with the other workers of
+    // that node it first-touches the node's partitions and then serves only their games
+    int queueIndex = index % serverNodeCount;
+    ServerNodeQueue& queue = serverQueues[queueIndex];
+    size_t partitionBytes = serverPartitionSize * sizeof(PvTTEntry);
+    int nodeWorkers = (workers - queueIndex + serverNodeCount - 1) / serverNodeCount;
+    ClearLargeTableRange(serverTable, ServerFirstPartition(queueIndex) * partitionBytes,
+                         ServerFirstPartition(queueIndex + 1) * partitionBytes, index / serverNodeCount, nodeWorkers);
+    serverCleared++;
+    for (;;) {
+        ServerJob job;
+        {
+            std::unique_lock<std::mutex> lock(serverMutex);
+            queue.work.wait(lock, [&queue] { return serverStopping || !queue.jobs.empty(); });
+            if (queue.jobs.empty()) return;
+            job = queue.jobs.front();
+            queue.jobs.pop_front();
+        }
+        ServerGame& game = *job.game;
+        RestorePosition(game.position);
+        char reply[512];
+        const char* result = ServerGameResult();
+        if (result) {
+            snprintf(reply, sizeof(reply), "%d gameover %s", game.id, result);
+        } else {
+            long long budgetMs = game.moveMs > 0 ? game.moveMs : 0;
+            if (game.clockMs >= 0) {
+                TimeControl clock = {game.clockMs, game.incrementMs, 0};
+                long long softMs, hardMs;
+                AllocateTime(clock, softMs, hardMs);
+                budgetMs = budgetMs > 0 ? std::min(budgetMs, softMs) : softMs;
+            }
+            UsePvTablePartition((PvTTEntry*)serverTable.memory + (size_t)(game.id % serverPartitions) * serverPartitionSize,
+                                serverPartitionSize);
+            long long startUs = SteadyMicros();
+            clock.stop = false;
+            clock.deadlineUs = budgetMs > 0 ? startUs + budgetMs * 1000 : 0;
+            searchNodes = 0;
+            MultiPvLine line;
+            int found = SearchMultiPV(game.depth, 1, &line);
+            clock.deadlineUs = 0;
+            clock.stop = false;
+            if (found == 0) found = SearchMultiPV(1, 1, &line); // Out of time before depth 1 finished
+            long long usedMs = (SteadyMicros() - startUs) / 1000;
+            if (game.clockMs >= 0) game.clockMs = std::max(game.clockMs - usedMs, 0LL) + game.incrementMs;
+
+            MoveUndo undo;
+            MakeMove(line.pv[0], undo);
+            char text[6];
+            MoveToString(line.pv[0], text);
+            snprintf(reply, sizeof(reply), "%d bestmove %s score %d depth %d time %lld", game.id, text,
+                     line.score, line.depth, usedMs);
+            std::lock_guard<std::mutex> lock(serverMutex);
+            serverSearches++;
+            serverNodes += searchNodes;
+        }
+        {
+            std::lock_guard<std::mutex> lock(serverMutex);
+            SavePosition(game.position);
+            game.busy = false;
+        }
+        ServerReply(*job.connection, reply);
+    }
+}
+
+// Raises a worker's stop flag once its search is past the deadline
+void ServerTimer(int workers) {
+    for (;;) {
+        {
+            std::lock_guard<std::mutex> lock(serverMutex);
+            if (serverStopping) return;
+        }
+        long long now = SteadyMicros();
+        for (int i = 0; i < workers; i++) {
+            long long deadline = serverClocks[i].deadlineUs.load();
+            if (deadline != 0 && now >= deadline) serverClocks[i].stop = true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+// The game 'text' names, if this connection owns it and no search is running on it
+std::shared_ptr<ServerGame> ServerFindGame(const ServerConnection& connection, const char* text, std::string& error) {
+    std::lock_guard<std::mutex> lock(serverMutex);
+    std::map<int, std::shared_ptr<ServerGame>>::iterator it = serverGames.find(atoi(text));
+    if (it == serverGames.end() || it->second->owner != &connection) {
+        error = "unknown game";
+        return std::shared_ptr<ServerGame>();
+    }
+    if (it->second->busy) {
+        error = "busy";
+        return std::shared_ptr<ServerGame>();
+    }
+    return it->second;
+}
+
+// Reads and answers one client's commands until it disconnects
+void ServerSession(std::shared_ptr<ServerConnection> connection) {
+    LineReader reader(connection->fd);
+    std::vector<int> owned;
+    std::string line;
+    while (reader.ReadLine(line)) {
+        char command[16] = "", arg[32] = "", arg2[32] = "";
+        int offset = 0;
+        sscanf(line.c_str(), "%15s %n", command, &offset);
+        const char* rest = line.c_str() + offset;
+        sscanf(rest, "%31s %31s", arg, arg2);
+        std::string error;
+        char reply[512];
+        reply[0] = '\0';
+
+        if (strcmp(command, "new") == 0) {
+            std::shared_ptr<ServerGame> game = std::make_shared<ServerGame>();
+            game->owner = connection.get();
+            game->depth = 4;
+            game->moveMs = 0;
+            game->clockMs = -1;
+            game->incrementMs = 0;
+            game->busy = false;
+            bool ok = true;
+            ResetGame();
+            std::vector<std::string> words;
+            for (const char* p = rest; *p; ) {
+                while (*p == ' ') p++;
+                const char* wordEnd = p;
+                while (*wordEnd && *wordEnd != ' ') wordEnd++;
+                std::string word(p, wordEnd);
+                p = wordEnd;
+                if (word.empty()) break;
+                if (word == "fen") {
+                    while (*p == ' ') p++;
+                    ok = LoadFen(p);
+                    break;
+                }
+                while (*p == ' ') p++;
+                const char* valueEnd = p;
+                while (*valueEnd && *valueEnd != ' ') valueEnd++;
+                int value = atoi(std::string(p, valueEnd).c_str());
+                p = valueEnd;
+                if (word == "depth") game->depth = Max(1, Min(value, MULTIPV_MAX_PLY - 1));
+                else if (word == "ms") game->moveMs = Max(0, value);
+                else if (word == "clock") game->clockMs = Max(0, value);
+                else if (word == "inc") game->incrementMs = Max(0, value);
+                else ok = false;
+            }
+            if (!ok) {
+                snprintf(reply, sizeof(reply), "0 error bad new: %s", rest);
+            } else {
+                SavePosition(game->position);
+                std::lock_guard<std::mutex> lock(serverMutex);
+                game->id = serverNextGameId++;
+                serverGames[game->id] = game;
+                owned.push_back(game->id);
+                snprintf(reply, sizeof(reply), "%d ok", game->id);
+            }
+        } else if (strcmp(command, "move") == 0) {
+            std::shared_ptr<ServerGame> game = ServerFindGame(*connection, arg, error);
+            if (game) {
+                RestorePosition(game->position);
+                ChessMove move;
+                if (ParseMove(arg2, move)) {
+                    MoveUndo undo;
+                    MakeMove(move, undo);
+                    SavePosition(game->position);
+                } else {
+                    error = "illegal move";
+                }
+            }
+            snprintf(reply, sizeof(reply), "%d %s%s", atoi(arg), error.empty() ? "ok" : "error ", error.c_str());
+        } else if (strcmp(command, "go") == 0) {
+            std::shared_ptr<ServerGame> game = ServerFindGame(*connection, arg, error);
+            if (game) {
+                // Answered by a worker of the node that owns the game's partition
+                std::lock_guard<std::mutex> lock(serverMutex);
+                game->busy = true;
+                ServerJob job;
+                job.game = game;
+                job.connection = connection;
+                ServerNodeQueue& queue = serverQueues[ServerPartitionNode(game->id % serverPartitions)];
+                queue.jobs.push_back(job);
+                queue.work.notify_one();
+            } else {
+                snprintf(reply, sizeof(reply), "%d error %s", atoi(arg), error.c_str());
+            }
+        } else if (strcmp(command, "fen") == 0) {
+            std::shared_ptr<ServerGame> game = ServerFindGame(*connection, arg, error);
+            if (game) {
+                RestorePosition(game->position);
+                char fen[100];
+                PositionToFen(fen);
+                snprintf(reply, sizeof(reply), "%d fen %s", game->id, fen);
+            } else {
+                snprintf(reply, sizeof(reply), "%d error %s", atoi(arg), error.c_str());
+            }
+        } else if (strcmp(command, "free") == 0) {
+            std::shared_ptr<ServerGame> game = ServerFindGame(*connection, arg, error);
+            if (game) {
+                std::lock_guard<std::mutex> lock(serverMutex);
+                serverGames.erase(game->id);
+            }
+            snprintf(reply, sizeof(reply), "%d %s%s", atoi(arg), error.empty() ? "ok" : "error ", error.c_str());
+        } else if (strcmp(command, "stats") == 0) {
+            std::lock_guard<std::mutex> lock(serverMutex);
+            size_t queued = 0;
+            for (int i = 0; i < serverNodeCount; i++) queued += serverQueues[i].jobs.size();
+            snprintf(reply, sizeof(reply), "0 stats games %d searches %llu nodes %llu queued %d", (int)serverGames.size(),
+                     serverSearches, serverNodes, (int)queued);
+        } else if (command[0] != '\0') {
+            snprintf(reply, sizeof(reply), "0 error unknown command %s", command);
+        }
+        if (reply[0] != '\0') ServerReply(*connection, reply);
+    }
+
+    // Searches still running finish on their own shared_ptr
+    {
+        std::lock_guard<std::mutex> lock(serverMutex);
+        for (size_t i = 0; i < owned.size(); i++) serverGames.erase(owned[i]);
+    }
+    connection->sessionDone = true;
+}
+
+void ServerInterrupt(int) {
+    serverInterrupted = 1;
+}
+
+int ServeCommand(int argc, char* argv[]) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s serve <socket> [--workers N] [--hash MB] [--partitions N] [--pin 0|1]\n", argv[0]);
+        return 1;
+    }
+    const char* path = argv[2];
+    int workers = Max(1, (int)std::thread::hardware_concurrency());
+    int hashMb = 64;
+    serverPartitions = 64;
+    for (int i = 3; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--workers") == 0) workers = Max(1, atoi(argv[i + 1]));
+        else if (strcmp(argv[i], "--hash") == 0) hashMb = Max(1, atoi(argv[i + 1]));
+        else if (strcmp(argv[i], "--partitions") == 0) serverPartitions = Max(1, atoi(argv[i + 1]));
+        else if (strcmp(argv[i], "--pin") == 0) serverPin = atoi(argv[i + 1]) != 0;
+        else return fprintf(stderr, "unknown option: %s\n", argv[i]), 1;
+    }
+    // A node without workers gets no partitions, and every node at least one
+    serverNodeCount = serverPin ? Max(1, Min((int)NumaNodeCpus().size(), workers)) : 1;
+    serverPartitions = Max(serverPartitions, serverNodeCount);
+    serverQueues.reset(new ServerNodeQueue[serverNodeCount]);
+    // Partitions are a power of two entries each, together within --hash
+    size_t perPartition = ((size_t)hashMb << 20) / sizeof(PvTTEntry) / serverPartitions;
+    serverPartitionSize = 1;
+    while (serverPartitionSize * 2 <= perPartition) serverPartitionSize *= 2;
+    if (!AllocateLargeTable(serverTable, serverPartitionSize * serverPartitions * sizeof(PvTTEntry), useLargePages)) {
+        fprintf(stderr, "cannot allocate a %d MB table\n", hashMb);
+        return 1;
+    }
+
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(address.sun_path)) return fprintf(stderr, "socket path too long\n"), 1;
+    strcpy(address.sun_path, path);
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    unlink(path);
+    if (listener < 0 || bind(listener, (sockaddr*)&address, sizeof(address)) != 0 || listen(listener, 128) != 0) {
+        fprintf(stderr, "cannot listen on %s\n", path);
+        return 1;
+    }
+    signal(SIGINT, ServerInterrupt);
+    signal(SIGTERM, ServerInterrupt);
+
+    serverClocks.reset(new ServerWorkerClock[workers]);
+    for (int i = 0; i < workers; i++) {
+        serverClocks[i].stop = false;
+        serverClocks[i].deadlineUs = 0;
+    }
+    std::vector<std::thread> pool;
+    for (int i = 0; i < workers; i++) pool.push_back(std::thread(ServerWorker, i, workers));
+    std::thread timer(ServerTimer, workers);
+    while (serverCleared < workers) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    printf("Serving on %s: %d workers%s, %d table partitions of %zu entries on %s, %d node queue%s\n", path,
+           workers, serverPin ? " (pinned)" : "", serverPartitions, serverPartitionSize, largePageNames[serverTable.pages],
+           serverNodeCount, serverNodeCount == 1 ? "" : "s");
+    fflush(stdout);
+
+    std::vector<ServerSessionThread> sessions;
+    while (!serverInterrupted) {
+        // Reap the sessions of clients that have gone
+        for (size_t i = 0; i < sessions.size(); ) {
+            if (sessions[i].connection->sessionDone) {
+                sessions[i].thread.join();
+                sessions[i] = std::move(sessions.back());
+                sessions.pop_back();
+            } else {
+                i++;
+            }
+        }
+        pollfd waiting = {listener, POLLIN, 0};
+        if (poll(&waiting, 1, 200) <= 0) continue;
+        int fd = accept(listener, NULL, NULL);
+        if (fd < 0) continue;
+        ServerSessionThread session;
+        session.connection = std::make_shared<ServerConnection>(fd);
+        session.thread = std::thread(ServerSession, session.connection);
+        sessions.push_back(std::move(session));
+    }
+
+    close(listener);
+    unlink(path);
+    // Wake the sessions blocked in recv() and wait for them: none may touch the games or
+    // the table once they are torn down
+    for (size_t i = 0; i < sessions.size(); i++) {
+        shutdown(sessions[i].connection->fd, SHUT_RDWR);
+        sessions[i].thread.join();
+    }
+    sessions.clear();
+    {
+        std::lock_guard<std::mutex> lock(serverMutex);
+        serverStopping = true;
+        for (int i = 0; i < workers; i++) serverClocks[i].stop = true;
+    }
+    for (int i = 0; i < serverNodeCount; i++) serverQueues[i].work.notify_all();
+    for (size_t i = 0; i < pool.size(); i++) pool[i].join();
+    timer.join();
+    FreeLargeTable(serverTable);
+    printf("Searches        : %llu\n", serverSearches);
+    printf("Nodes searched  : %llu\n", serverNodes);
+    return 0;
+}
+
+// Load generator: plays --games engine-vs-engine games to --plies over --connections
+// client connections, each keeping a "go" outstanding for every one of its games, and
+// reports moves per second and the latency of the replies
+int LoadGenCommand(int argc, char* argv[]) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s loadgen <socket> [--games N] [--connections N] [--plies N] [--depth D] "
+                        "[--ms T] [--clock C] [--inc I]\n", argv[0]);
+        return 1;
+    }
+    const char* path = argv[2];
+    int games = 100, connections = 4, plies = 40, depth = 4, moveMs = 0, clockMs = -1, incrementMs = 0;
+    for (int i = 3; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--games") == 0) games = Max(1, atoi(argv[i + 1]));
+        else if (strcmp(argv[i], "--connections") == 0) connections = Max(1, atoi(argv[i + 1]));
+        else if (strcmp(argv[i], "--plies") == 0) plies = Max(1, atoi(argv[i + 1]));
+        else if (strcmp(argv[i], "--depth") == 0) depth = Max(1, atoi(argv[i + 1]));
+        else if (strcmp(argv[i], "--ms") == 0) moveMs = Max(0, atoi(argv[i + 1]));
+        else if (strcmp(argv[i], "--clock") == 0) clockMs = Max(0, atoi(argv[i + 1]));
+        else if (strcmp(argv[i], "--inc") == 0) incrementMs = Max(0, atoi(argv[i + 1]));
+        else return fprintf(stderr, "unknown option: %s\n", argv[i]), 1;
+    }
+    connections = Min(connections, games);
+
+    std::mutex resultMutex;
+    std::vector<double> latencies;
+    int finished = 0, failures = 0;
+    auto client = [&](int index) {
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        sockaddr_un address = {};
+        address.sun_family = AF_UNIX;
+        strncpy(address.sun_path, path, sizeof(address.sun_path) - 1);
+        if (fd < 0 || connect(fd, (sockaddr*)&address, sizeof(address)) != 0) {
+            std::lock_guard<std::mutex> lock(resultMutex);
+            failures++;
+            if (fd >= 0) close(fd);
+            return;
+        }
+        LineReader reader(fd);
+        std::string line;
+        char request[128];
+        if (clockMs >= 0) {
+            snprintf(request, sizeof(request), "new depth %d ms %d clock %d inc %d", depth, moveMs, clockMs, incrementMs);
+        }
+        else snprintf(request, sizeof(request), "new depth %d ms %d", depth, moveMs);
+        std::map<int, int> played;                 // Game id -> plies so far
+        std::map<int, long long> sentUs;
+        int mine = games / connections + (index < games % connections ? 1 : 0);
+        for (int i = 0; i < mine; i++) {
+            int id = 0;
+            if (!SendLine(fd, request) || !reader.ReadLine(line) || sscanf(line.c_str(), "%d ok", &id) != 1 || id == 0) {
+                std::lock_guard<std::mutex> lock(resultMutex);
+                failures++;
+                continue;
+            }
+            played[id] = 0;
+        }
+        std::vector<double> mineLatencies;
+        int mineFinished = 0, mineFailures = 0;
+        for (std::map<int, int>::iterator it = played.begin(); it != played.end(); ++it) {
+            sentUs[it->first] = SteadyMicros();
+            SendLine(fd, "go " + std::to_string(it->first));
+        }
+        int open = (int)played.size();
+        while (open > 0 && reader.ReadLine(line)) {
+            int id = 0;
+            char kind[16] = "";
+            if (sscanf(line.c_str(), "%d %15s", &id, kind) != 2 || played.count(id) == 0) {
+                mineFailures++;
+                continue;
+            }
+            if (strcmp(kind, "bestmove") == 0) {
+                mineLatencies.push_back((SteadyMicros() - sentUs[id]) / 1000.0);
+                if (++played[id] < plies) {
+                    sentUs[id] = SteadyMicros();
+                    SendLine(fd, "go " + std::to_string(id));
+                    continue;
+                }
+            } else if (strcmp(kind, "gameover") != 0) {
+                mineFailures++;
+            }
+            mineFinished++;
+            open--;
+        }
+        close(fd);
+        std::lock_guard<std::mutex> lock(resultMutex);
+        latencies.insert(latencies.end(), mineLatencies.begin(), mineLatencies.end());
+        finished += mineFinished;
+        failures += mineFailures + open;
+    };
+
+    long long startUs = SteadyMicros();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < connections; i++) threads.push_back(std::thread(client, i));
+    for (size_t i = 0; i < threads.size(); i++) threads[i].join();
+    double seconds = (SteadyMicros() - startUs) / 1e6;
+
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&](double p) {
+        return latencies.empty() ? 0.0 : latencies[Min((int)(p * latencies.size()), (int)latencies.size() - 1)];
+    };
+    printf("Games           : %d finished, %d failures, %d connections\n", finished, failures, connections);
+    printf("Moves           : %zu in %.2f s (%.1f moves/s)\n", latencies.size(), seconds,
+           seconds > 0 ? latencies.size() / seconds : 0.0);
+    printf("Latency (ms)    : p50 %.1f  p90 %.1f  p99 %.1f  max %.1f\n", percentile(0.50), percentile(0.90),
+           percentile(0.99), latencies.empty() ? 0.0 : latencies.back());
+    return failures == 0 ? 0 : 1;
+}
+
+volatile unsigned long long tableBenchSink = 0; // Keeps the probe loop from being optimized away
+
+// ttbench [--mb N] [--threads N] [--depth D] [--probes N]: a table of N MB on normal and
+// on huge pages, cleared and searched by unpinned and by NUMA-pinned threads. Reports
+// the clear time, the memory huge pages back, the latency of dependent random probes
+// (TLB and cache misses, nothing to overlap them with) and the nps of MultiPV searches
+// over the bench positions sharing the table.
+int TableBenchCommand(int argc, char* argv[]) {
+    int mb = 1024, threads = Max(1, (int)std::thread::hardware_concurrency()), depth = 5;
+    long long probes = 20000000;
+    for (int i = 2; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--mb") == 0) mb = Max(1, atoi(argv[i + 1]));
+        else if (strcmp(argv[i], "--threads") == 0) threads = Max(1, Min(atoi(argv[i + 1]), 64));
+        else if (strcmp(argv[i], "--depth") == 0) depth = Max(1, atoi(argv[i + 1]));
+        else if (strcmp(argv[i], "--probes") == 0) probes = Max(1, atoi(argv[i + 1]));
+        else return fprintf(stderr, "unknown option: %s\n", argv[i]), 1;
+    }
+    printf("%d MB table, %d threads, %d NUMA nodes, search depth %d\n", mb, threads, (int)NumaNodeCpus().size(), depth);
+    printf("%-24s %-4s %10s %10s %10s %12s\n", "pages", "pin", "clear ms", "huge MB", "probe ns", "nps");
+    for (int config = 0; config < 4; config++) {
+        bool large = config & 1, pin = config >> 1;
+        long long hugeBefore = HugePageKb();
+        LargeTable table;
+        if (!AllocateLargeTable(table, (size_t)mb << 20, large)) return fprintf(stderr, "cannot allocate %d MB\n", mb), 1;
+        size_t entries = (size_t)1 << 4;
+        while (entries * 2 * sizeof(PvTTEntry) <= table.bytes) entries *= 2;
+
+        // Each thread first-touches the part it clears
+        long long start = SteadyMicros();
+        std::vector<std::thread> pool;
+        for (int t = 0; t < threads; t++) {
+            pool.push_back(std::thread([&, t] {
+                int node, cpu;
+                if (pin) PinThreadToNumaNode(t, node, cpu);
+                ClearLargeTableSlice(table, t, threads);
+            }));
+        }
+        for (int t = 0; t < threads; t++) pool[t].join();
+        pool.clear();
+        double clearMs = (SteadyMicros() - start) / 1000.0;
+        long long hugeAfter = HugePageKb();
+
+        // Each probe's index depends on the entry read before
+        const PvTTEntry* entry = (const PvTTEntry*)table.memory;
+        unsigned long long x = 0x9E3779B97F4A7C15ULL;
+        start = SteadyMicros();
+        for (long long i = 0; i < probes; i++) {
+            x = (x ^ entry[x & (entries - 1)].data.load(std::memory_order_relaxed)) * 0xBF58476D1CE4E5B9ULL + 1;
+            x ^= x >> 31;
+        }
+        double probeNs = (SteadyMicros() - start) * 1000.0 / probes;
+        tableBenchSink = x;
+
+        std::atomic<unsigned long long> nodes(0);
+        start = SteadyMicros();
+        for (int t = 0; t < threads; t++) {
+            pool.push_back(std::thread([&, t] {
+                int node, cpu;
+                if (pin) PinThreadToNumaNode(t, node, cpu);
+                UsePvTablePartition((PvTTEntry*)table.memory, entries);
+                searchNodes = 0;
+                for (int i = t; i < benchPositionCount * Max(1, threads); i += threads) {
+                    LoadFen(benchPositions[i % benchPositionCount]);
+                    MultiPvLine line;
+                    SearchMultiPV(depth, 1, &line);
+                }
+                nodes += searchNodes;
+            }));
+        }
+        for (int t = 0; t < threads; t++) pool[t].join();
+        double seconds = (SteadyMicros() - start) / 1e6;
+
+        char huge[24] = "?";
+        if (hugeBefore >= 0) snprintf(huge, sizeof(huge), "%lld", (hugeAfter - hugeBefore) / 1024);
+        printf("%-24s %-4s %10.1f %10s %10.1f %12.0f\n", largePageNames[table.pages], pin ? "yes" : "no", clearMs,
+               huge, probeNs, seconds > 0 ? nodes / seconds : 0.0);
+        FreeLargeTable(table);
+    }
+    return 0;
+}
+
+// ---------------------------------------------------------------------------
+// Perft: move generator check and throughput
+// ---------------------------------------------------------------------------
+//
+// Counts the leaves of the legal move tree. The last ply is counted in bulk (the number of
+// legal moves, none of them made), subtree counts from depth 2 up are kept in a hash table
+// shared by all threads, and the root moves are handed out to a thread pool.
+
+// Lockless like PvTTEntry: check = key ^ data, data = count << 8 | depth
+struct PerftEntry {
+    std::atomic<unsigned long long> check;
+    std::atomic<unsigned long long> data;
+};
+
+PerftEntry* perftTable = NULL;                  // Buckets of two: depth-preferred, always-replace
+size_t perftBucketMask = 0;
+thread_local unsigned long long perftProbes = 0;
+thread_local unsigned long long perftHits = 0;
+
+template <int Side>
+unsigned long long PerftT(int depth) {
+    PerftEntry* bucket = NULL;
+    if (perftTable && depth >= 2) {
+        bucket = perftTable + (positionHash & perftBucketMask) * 2;
+        perftProbes++;
+        for (int i = 0; i < 2; i++) {
+            unsigned long long data = bucket[i].data.load(std::memory_order_relaxed);
+            if ((data & 255) == (unsigned long long)depth &&
+                (bucket[i].check.load(std::memory_order_relaxed) ^ data) == positionHash) {
+                perftHits++;
+                return data >> 8;
+            }
+        }
+    }
+
+    ChessMove moves[256];
+    int moveCount = 0;
+    const POINT& king = (Side == 1) ? whiteKingPos : blackKingPos;
+    if (IsAttackedBy<-Side>(king.x, king.y)) GenerateMoves<Side, GEN_EVASIONS>(moves, moveCount);
+    else GenerateMoves<Side, GEN_ALL>(moves, moveCount);
+    if (depth == 1) return moveCount;
+
+    unsigned long long count = 0;
+    for (int i = 0; i < moveCount; i++) {
+        MoveUndo undo;
+        MakeMove(moves[i], undo);
+        count += PerftT<-Side>(depth - 1);
+        UnmakeMove(moves[i], undo);
+    }
+    if (bucket) {
+        unsigned long long data = count << 8 | (unsigned long long)depth;
+        int slot = depth >= (int)(bucket[0].data.load(std::memory_order_relaxed) & 255) ? 0 : 1;
+        bucket[slot].check.store(positionHash ^ data, std::memory_order_relaxed);
+        bucket[slot].data.store(data, std::memory_order_relaxed);
+    }
+    return count;
+}
+
+// Perft of the current position, the root moves spread over 'threads' threads. The count
+// below each root move goes to divide[] (GenerateLegalMoves() order) when given; probes
+// and hits of the hash table are added to the totals passed in.
+unsigned long long Perft(int depth, int threads, ChessMove moves[], int& moveCount, unsigned long long divide[],
+                         unsigned long long& probes, unsigned long long& hits) {
+    moveCount = 0;
+    GenerateLegalMoves(currentPlayer, moves, moveCount);
+    if (depth <= 1) {
+        for (int i = 0; i < moveCount && divide; i++) divide[i] = 1;
+        return depth == 1 ? moveCount : 1;
+    }
+
+    PositionSnapshot root;
+    SavePosition(root);
+    std::atomic<int> next(0);
+    std::atomic<unsigned long long> totalProbes(0), totalHits(0);
+    unsigned long long counts[256];
+    auto worker = [&]() {
+        RestorePosition(root);
+        perftProbes = perftHits = 0;
+        for (int i; (i = next++) < moveCount; ) {
+            MoveUndo undo;
+            MakeMove(moves[i], undo);
+            counts[i] = (currentPlayer == 1) ? PerftT<1>(depth - 1) : PerftT<-1>(depth - 1);
+            UnmakeMove(moves[i], undo);
+        }
+        totalProbes += perftProbes;
+        totalHits += perftHits;
+    };
+    std::vector<std::thread> pool;
+    for (int t = 0; t < Min(threads, moveCount); t++) pool.emplace_back(worker);
+    for (size_t t = 0; t < pool.size(); t++) pool[t].join();
+
+    unsigned long long total = 0;
+    for (int i = 0; i < moveCount; i++) {
+        total += counts[i];
+        if (divide) divide[i] = counts[i];
+    }
+    probes += totalProbes;
+    hits += totalHits;
+    return total;
+}
+
+// The usual perft test positions with known counts (chessprogramming.org "Perft Results")
+struct PerftCase {
+    const char* fen;
+    int depth;
+    unsigned long long nodes;
+};
+const PerftCase perftSuite[] = {
+    {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", 6, 119060324ULL},
+    {"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1", 5, 193690690ULL},
+    {"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1", 7, 178633661ULL},
+    {"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1", 5, 15833292ULL},
+    {"rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8", 5, 89941194ULL},
+    {"r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10", 5, 164075551ULL},
+};
+
+// perft <depth> [--fen "<fen>"] [--threads N] [--hash MB] [--divide 1]
+// perft suite [--threads N] [--hash MB]: perftSuite against its known counts
+int PerftCommand(int argc, char* argv[]) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s perft <depth>|suite [--fen \"<fen>\"] [--threads N] [--hash MB] [--divide 1]\n", argv[0]);
+        return 1;
+    }
+    bool suite = strcmp(argv[2], "suite") == 0;
+    int depth = atoi(argv[2]), threads = Max(1, (int)std::thread::hardware_concurrency()), mb = 256;
+    bool divide = false;
+    const char* fen = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+    for (int i = 3; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--fen") == 0) fen = argv[i + 1];
+        else if (strcmp(argv[i], "--threads") == 0) threads = Max(1, Min(atoi(argv[i + 1]), 256));
+        else if (strcmp(argv[i], "--hash") == 0) mb = Max(0, atoi(argv[i + 1]));
+        else if (strcmp(argv[i], "--divide") == 0) divide = atoi(argv[i + 1]) != 0;
+        else return fprintf(stderr, "unknown option: %s\n", argv[i]), 1;
+    }
+    if (!suite && depth < 1) return fprintf(stderr, "bad depth: %s\n", argv[2]), 1;
+
+    LargeTable table;
+    if (mb > 0) {
+        if (!AllocateLargeTable(table, (size_t)mb << 20, useLargePages)) return fprintf(stderr, "cannot allocate %d MB\n", mb), 1;
+        size_t buckets = 1;
+        while (buckets * 4 * sizeof(PerftEntry) <= table.bytes) buckets *= 2;
+        ClearLargeTable(table, threads);
+        perftTable = (PerftEntry*)table.memory;
+        perftBucketMask = buckets - 1;
+    }
+
+    int cases = suite ? (int)(sizeof(perftSuite) / sizeof(perftSuite[0])) : 1;
+    int failures = 0;
+    unsigned long long totalNodes = 0, probes = 0, hits = 0;
+    long long start = SteadyMicros();
+    for (int c = 0; c < cases; c++) {
+        const char* caseFen = suite ? perftSuite[c].fen : fen;
+        int caseDepth = suite ? perftSuite[c].depth : depth;
+        if (!LoadFen(caseFen)) return fprintf(stderr, "bad FEN: %s\n", caseFen), 1;
+        ChessMove moves[256];
+        unsigned long long counts[256];
+        int moveCount;
+        long long caseStart = SteadyMicros();
+        unsigned long long nodes = Perft(caseDepth, threads, moves, moveCount, counts, probes, hits);
+        double caseMs = (SteadyMicros() - caseStart) / 1000.0;
+        totalNodes += nodes;
+        if (divide) {
+            for (int i = 0; i < moveCount; i++) {
+                char text[6];
+                MoveToString(moves[i], text);
+                printf("%-5s %llu\n", text, counts[i]);
+            }
+        }
+        if (suite) {
+            bool ok = nodes == perftSuite[c].nodes;
+            if (!ok) failures++;
+            printf("%-72s depth %d  nodes %12llu  %-4s %9.1f ms\n", caseFen, caseDepth, nodes, ok ? "ok" : "FAIL", caseMs);
+        }
+    }
+    double ms = (SteadyMicros() - start) / 1000.0;
+    printf("===========================\n");
+    printf("Nodes           : %llu\n", totalNodes);
+    printf("Total time (ms) : %.0f\n", ms);
+    printf("Nodes/second    : %.0f\n", ms > 0 ? totalNodes * 1000.0 / ms : 0.0);
+    if (perftTable) {
+        printf("Hash            : %d MB %s, %llu / %llu probes hit (%.1f%%)\n", mb, largePageNames[table.pages], hits,
+               probes, probes ? hits * 100.0 / probes : 0.0);
+        perftTable = NULL;
+        FreeLargeTable(table);
+    }
+    if (suite) printf("Suite           : %d of %d positions wrong\n", failures, cases);
+    return failures ? 1 : 0;
+}
+
+// ---------------------------------------------------------------------------
+// PGN reader and position index
+// ---------------------------------------------------------------------------
+//
+// The PGN file is memory-mapped and parsed in place, only a FEN tag is copied. The mapping
+// is cut into chunks handed out to a thread pool; a game belongs to the chunk its first
+// line starts in, so a thread finds the games of its chunk without looking at the others.
+// Comments, variations, NAGs and move numbers are skipped, moves are decoded by
+// ParseSanMove() and made on the board. A move that does not decode ends the replay of
+// its game, the rest of the game is still read to find the next one.
+//
+// The index maps positions to the games they occur in: a PgnIndexHeader, then
+// PgnIndexEntry records sorted by key, then game offset. Each thread sorts its entries in
+// runs spilled to temporary files next to the index, which are merged at the end.
+
+const char PGN_INDEX_MAGIC[8] = {'C', 'H', 'E', 'S', 'S', 'P', 'X', '1'};
+const size_t PGN_CHUNK_MIN_BYTES = 1 << 20;
+const size_t PGN_RUN_ENTRIES = 1 << 22;       // 64 MB of entries per thread before a run is spilled
+const size_t PGN_MERGE_BUFFER_ENTRIES = 1 << 16;
+const int PGN_REPORTED_ERRORS = 10;
+
+enum PgnResult { PGN_WHITE_WINS, PGN_DRAW, PGN_BLACK_WINS, PGN_NO_RESULT };
+
+struct PgnIndexHeader {
+    char magic[8];
+    unsigned long long entries;
+    unsigned long long games;
+    unsigned long long pgnBytes;              // Size of the indexed PGN, a changed file makes the index stale
+};
+
+struct PgnIndexEntry {
+    unsigned long long key;                   // PgnPositionKey()
+    unsigned long long offset;                // Of the game's first byte in the PGN
+    bool operator<(const PgnIndexEntry& other) const {
+        return key != other.key ? key < other.key : offset < other.offset;
+    }
+    bool operator==(const PgnIndexEntry& other) const {
+        return key == other.key && offset == other.offset;
+    }
+};
+
+struct PgnGame {
+    const char* start;
+    int plies;                                // Moves replayed
+    int result;                               // PgnResult
+    bool tags;                                // Had a tag section
+    bool failed;                              // Replay stopped at errorToken (or at a bad FEN tag)
+    const char* errorToken;
+    int errorLength;
+};
+
+// The index key: positionHash without the en passant file. MakeMove() sets the target after
+// every double push, FENs written elsewhere usually only when a capture is possible.
+unsigned long long PgnPositionKey() {
+    return enPassantTarget.x >= 0 ? positionHash ^ zobrist.enPassant[enPassantTarget.x] : positionHash;
+}
+
+// Start of the line after the one p is in
+const char* PgnNextLine(const char* p, const char* end) {
+    const char* newline = (const char*)memchr(p, '\n', end - p);
+    return newline ? newline + 1 : end;
+}
+
+bool PgnBlankLine(const char* p, const char* end) {
+    for (; p < end && *p != '\n'; p++) {
+        if (*p != ' ' && *p != '\t' && *p != '\r') return false;
+    }
+    return true;
+}
+
+// [Name "Value"] on a line of its own, so a bracket opening a line of a comment is not taken
+// for the tags of the next game
+bool PgnTagLine(const char* p, const char* end) {
+    if (p == end || *p++ != '[') return false;
+    const char* name = p;
+    while (p < end && ((*p >= 'A' && *p <= 'Z') || (*p >= 'a' && *p <= 'z') || (*p >= '0' && *p <= '9') || *p == '_')) p++;
+    if (p == name) return false;
+    while (p < end && (*p == ' ' || *p == '\t')) p++;
+    if (p == end || *p != '"') return false;
+    const char* close = NULL;
+    for (; p < end && *p != '\n'; p++) {
+        if (*p == ']') close = p;
+    }
+    return close && PgnBlankLine(close + 1, end);
+}
+
+// A game starts at a tag line whose previous non-blank line is not a tag line
+bool PgnGameStartsAt(const char* line, const char* begin, const char* end) {
+    if (!PgnTagLine(line, end)) return false;
+    while (line > begin) {
+        const char* previous = line - 1;
+        while (previous > begin && previous[-1] != '\n') previous--;
+        if (!PgnBlankLine(previous, line)) return !PgnTagLine(previous, line);
+        line = previous;
+    }
+    return true;
+}
+
+// First game starting at or after p
+const char* PgnFindGame(const char* p, const char* begin, const char* end) {
+    if (p == begin) {
+        while (p < end && PgnBlankLine(p, end)) p = PgnNextLine(p, end);
+        return p;
+    }
+    for (p = PgnNextLine(p - 1, end); p < end; p = PgnNextLine(p, end)) {
+        if (PgnGameStartsAt(p, begin, end)) return p;
+    }
+    return end;
+}
+
+// Value of the tag 'name' in the tag line at p ([Name "Value"]), escapes left in
+bool PgnTagValue(const char* p, const char* end, const char* name, const char*& value, int& length) {
+    size_t nameLength = strlen(name);
+    if (*p != '[' || (size_t)(end - p) < nameLength + 3 || memcmp(p + 1, name, nameLength) != 0) return false;
+    p += 1 + nameLength;
+    if (*p != ' ' && *p != '\t') return false;
+    while (p < end && (*p == ' ' || *p == '\t')) p++;
+    if (p == end || *p != '"') return false;
+    value = ++p;
+    while (p < end && *p != '"' && *p != '\n') p += (*p == '\\' && p + 1 < end) ? 2 : 1;
+    length = (int)(p - value);
+    return true;
+}
+
+int PgnResultToken(const char* token, int length) {
+    if (length == 3 && memcmp(token, "1-0", 3) == 0) return PGN_WHITE_WINS;
+    if (length == 3 && memcmp(token, "0-1", 3) == 0) return PGN_BLACK_WINS;
+    if (length == 7 && memcmp(token, "1/2-1/2", 7) == 0) return PGN_DRAW;
+    if (length == 1 && *token == '*') return PGN_NO_RESULT;
+    return -1;
+}
+
+// Reads the game at p and replays its main line, onPosition(game) after every move made.
+// Returns where the next game may start.
+template <class OnPosition>
+const char* ReplayPgnGame(const char* p, const char* end, PgnGame& game, OnPosition onPosition) {
+    game.start = p;
+    game.plies = 0;
+    game.result = PGN_NO_RESULT;
+    game.tags = false;
+    game.failed = false;
+    game.errorToken = NULL;
+    game.errorLength = 0;
+
+    const char* fen = NULL;
+    int fenLength = 0;
+    while (p < end) {
+        const char* next = PgnNextLine(p, end);
+        if (PgnTagLine(p, next)) {
+            game.tags = true;
+            const char* value;
+            int length;
+            if (PgnTagValue(p, next, "FEN", value, length)) {
+                fen = value;
+                fenLength = length;
+            }
+        } else if (!PgnBlankLine(p, next)) {
+            break;
+        }
+        p = next;
+    }
+    ResetGame();
+    if (fen) {
+        char text[128];
+        if (fenLength >= (int)sizeof(text)) {
+            game.failed = true;
+        } else {
+            memcpy(text, fen, fenLength);
+            text[fenLength] = '\0';
+            if (!LoadFen(text)) game.failed = true;
+        }
+        if (game.failed) {
+            game.errorToken = fen;
+            game.errorLength = fenLength;
+        }
+    }
+
+    int variationDepth = 0;
+    bool lineStart = true;
+    while (p < end) {
+        char c = *p;
+        if (c == '\n') {
+            p++;
+            lineStart = true;
+            continue;
+        }
+        if (lineStart && variationDepth == 0 && PgnTagLine(p, end)) return p; // The next game, this one has no result
+        if (lineStart && c == '%') {                                // Escape line
+            p = PgnNextLine(p, end);
+            continue;
+        }
+        lineStart = false;
+        if (c == '{') {
+            const char* close = (const char*)memchr(p, '}', end - p);
+            p = close ? close + 1 : end;
+            continue;
+        }
+        if (c == ';') {
+            p = PgnNextLine(p, end);
+            lineStart = true;
+            continue;
+        }
+        if (c == '(' || c == ')') {
+            variationDepth = (c == '(') ? variationDepth + 1 : Max(0, variationDepth - 1);
+            p++;
+            continue;
+        }
+
+        const char* token = p;
+        while (p < end && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n' && *p != '{' && *p != '}' &&
+               *p != '(' && *p != ')' && *p != ';') p++;
+        if (p == token) {
+            p++;
+            continue;
+        }
+        if (variationDepth > 0) continue;
+        int length = (int)(p - token);
+        int result = PgnResultToken(token, length);
+        if (result >= 0) {
+            game.result = result;
+            return PgnNextLine(p - 1, end);
+        }
+
+        // Move numbers ("12." "12..." and "12.e4" written together)
+        const char* move = token;
+        while (move < p && *move >= '0' && *move <= '9') move++;
+        if (move < p && *move == '.') {
+            while (move < p && *move == '.') move++;
+        } else {
+            move = token;
+        }
+        length = (int)(p - move);
+        // NAGs ("$1"), stand-alone annotations ("!?" "+/-") and "e.p." are not moves
+        if (length == 0 || !((*move >= 'a' && *move <= 'z') || (*move >= 'A' && *move <= 'Z') || *move == '0')) continue;
+        if (length == 4 && memcmp(move, "e.p.", 4) == 0) continue;
+        if (game.failed) continue;
+
+        ChessMove played;
+        if (!ParseSanMove(move, length, played)) {
+            game.failed = true;
+            game.errorToken = move;
+            game.errorLength = length;
+            continue;
+        }
+        MoveUndo undo;
+        MakeMove(played, undo);
+        game.plies++;
+        onPosition(game);
+    }
+    return end;
+}
+
+// Read-only mapping of a whole file
+struct MappedFile {
+    const char* data;
+    size_t size;
+};
+
+bool MapFile(const char* path, MappedFile& file) {
+    file.data = NULL;
+    file.size = 0;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return false;
+    }
+    file.size = (size_t)info.st_size;
+    if (file.size > 0) {
+        void* view = mmap(NULL, file.size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (view != MAP_FAILED) file.data = (const char*)view;
+    }
+    close(fd);
+    if (file.size > 0 && !file.data) return false;
+    if (file.data) madvise((void*)file.data, file.size, MADV_SEQUENTIAL);
+    return true;
+}
+
+void UnmapFile(MappedFile& file) {
+    if (file.data) munmap((void*)file.data, file.size);
+    file.data = NULL;
+}
+
+// Sorts and spills 'entries' as run file number 'run' next to the index
+bool WritePgnRun(const std::string& indexPath, int run, std::vector<PgnIndexEntry>& entries) {
+    std::sort(entries.begin(), entries.end());
+    entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+    FILE* file = fopen((indexPath + ".run" + std::to_string(run)).c_str(), "wb");
+    if (!file) return false;
+    bool ok = fwrite(entries.data(), sizeof(PgnIndexEntry), entries.size(), file) == entries.size();
+    ok = fclose(file) == 0 && ok;
+    entries.clear();
+    return ok;
+}
+
+// Merges run files 0..runs-1 into the index, dropping duplicates, and deletes them
+bool MergePgnRuns(const std::string& indexPath, int runs, unsigned long long games, unsigned long long pgnBytes,
+                  unsigned long long& entries) {
+    struct Run {
+        FILE* file;
+        std::vector<PgnIndexEntry> buffer;
+        size_t next;
+        bool Refill() {
+            buffer.resize(PGN_MERGE_BUFFER_ENTRIES);
+            buffer.resize(fread(buffer.data(), sizeof(PgnIndexEntry), buffer.size(), file));
+            next = 0;
+            return !buffer.empty();
+        }
+    };
+    std::vector<Run> inputs(runs);
+    bool ok = true;
+    for (int r = 0; r < runs; r++) {
+        inputs[r].file = fopen((indexPath + ".run" + std::to_string(r)).c_str(), "rb");
+        if (!inputs[r].file) ok = false;
+    }
+    FILE* out = ok ? fopen(indexPath.c_str(), "wb") : NULL;
+    entries = 0;
+    if (out) {
+        // Magic goes in last: an interrupted merge leaves a file that is not an index
+        PgnIndexHeader header = {};
+        ok = fwrite(&header, sizeof(header), 1, out) == 1;
+
+        // Min-heap of run numbers on each run's current entry
+        std::vector<int> heap;
+        auto later = [&](int a, int b) { return inputs[b].buffer[inputs[b].next] < inputs[a].buffer[inputs[a].next]; };
+        for (int r = 0; r < runs; r++) {
+            if (inputs[r].Refill()) heap.push_back(r);
+        }
+        std::make_heap(heap.begin(), heap.end(), later);
+        std::vector<PgnIndexEntry> output;
+        output.reserve(PGN_MERGE_BUFFER_ENTRIES);
+        PgnIndexEntry last = {0, ~0ULL};
+        while (!heap.empty() && ok) {
+            std::pop_heap(heap.begin(), heap.end(), later);
+            Run& run = inputs[heap.back()];
+            const PgnIndexEntry& entry = run.buffer[run.next];
+            if (!(entry == last)) {
+                output.push_back(entry);
+                last = entry;
+                if (output.size() == PGN_MERGE_BUFFER_ENTRIES) {
+                    ok = fwrite(output.data(), sizeof(PgnIndexEntry), output.size(), out) == output.size();
+                    entries += output.size();
+                    output.clear();
+                }
+            }
+            if (++run.next < run.buffer.size() || run.Refill()) std::push_heap(heap.begin(), heap.end(), later);
+            else heap.pop_back();
+        }
+        ok = ok && fwrite(output.data(), sizeof(PgnIndexEntry), output.size(), out) == output.size();
+        entries += output.size();
+
+        memcpy(header.magic, PGN_INDEX_MAGIC, sizeof(header.magic));
+        header.entries = entries;
+        header.games = games;
+        header.pgnBytes = pgnBytes;
+        ok = ok && fseek(out, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, out) == 1;
+        ok = fclose(out) == 0 && ok;
+    } else {
+        ok = false;
+    }
+    for (int r = 0; r < runs; r++) {
+        if (inputs[r].file) fclose(inputs[r].file);
+        remove((indexPath + ".run" + std::to_string(r)).c_str());
+    }
+    return ok;
+}
+
+// pgn scan <file.pgn> [--threads N] [--index file] [--plies N]: replays every game, the index
+// (when asked for) gets the positions after each of the first N plies of every game, 0 for all
+int PgnScan(int argc, char* argv[]) {
+    const char* path = argv[3];
+    const char* indexPath = NULL;
+    int threads = Max(1, (int)std::thread::hardware_concurrency()), maxPlies = 0;
+    for (int i = 4; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--threads") == 0) threads = Max(1, Min(atoi(argv[i + 1]), 256));
+        else if (strcmp(argv[i], "--index") == 0) indexPath = argv[i + 1];
+        else if (strcmp(argv[i], "--plies") == 0) maxPlies = Max(0, atoi(argv[i + 1]));
+        else return fprintf(stderr, "unknown option: %s\n", argv[i]), 1;
+    }
+    MappedFile pgn;
+    if (!MapFile(path, pgn)) return fprintf(stderr, "cannot read %s\n", path), 1;
+
+    const char* begin = pgn.data;
+    const char* end = pgn.data + pgn.size;
+    if (pgn.size >= 3 && memcmp(begin, "\xEF\xBB\xBF", 3) == 0) begin += 3; // UTF-8 byte order mark
+    size_t chunkBytes = std::max(PGN_CHUNK_MIN_BYTES, pgn.size / (threads * 8));
+    size_t chunkCount = pgn.size ? (size_t)(end - begin + chunkBytes - 1) / chunkBytes : 0;
+
+    std::atomic<size_t> nextChunk(0);
+    std::atomic<int> nextRun(0);
+    std::atomic<unsigned long long> totalGames(0), totalPlies(0), failedGames(0), indexed(0);
+    std::atomic<unsigned long long> results[4] = {};
+    std::atomic<bool> writeFailed(false);
+    std::mutex errorMutex;
+    int reportedErrors = 0;
+    auto worker = [&]() {
+        std::vector<PgnIndexEntry> entries;
+        if (indexPath) entries.reserve(PGN_RUN_ENTRIES);
+        unsigned long long games = 0, plies = 0, failed = 0, positions = 0, gameResults[4] = {};
+        unsigned long long offset = 0;
+        auto onPosition = [&](const PgnGame& game) {
+            if (!indexPath || (maxPlies > 0 && game.plies > maxPlies)) return;
+            PgnIndexEntry entry = {PgnPositionKey(), offset};
+            entries.push_back(entry);
+            positions++;
+            if (entries.size() == PGN_RUN_ENTRIES && !WritePgnRun(indexPath, nextRun++, entries)) writeFailed = true;
+        };
+        for (size_t chunk; (chunk = nextChunk++) < chunkCount; ) {
+            const char* chunkEnd = begin + std::min((size_t)(end - begin), (chunk + 1) * chunkBytes);
+            const char* p = PgnFindGame(begin + chunk * chunkBytes, begin, end);
+            while (p < chunkEnd) {
+                PgnGame game;
+                offset = (unsigned long long)(p - pgn.data);
+                const char* next = ReplayPgnGame(p, end, game, onPosition);
+                // Text after a result that is neither tags nor moves is not a game
+                if (game.tags || game.plies > 0 || game.failed) {
+                    games++;
+                    plies += game.plies;
+                    gameResults[game.result]++;
+                    if (game.failed) {
+                        failed++;
+                        std::lock_guard<std::mutex> lock(errorMutex);
+                        if (reportedErrors++ < PGN_REPORTED_ERRORS) {
+                            fprintf(stderr, "game at byte %llu: cannot play \"%.*s\" after %d plies\n", offset,
+                                    Min(game.errorLength, 40), game.errorToken, game.plies);
+                        }
+                    }
+                }
+                p = next;
+                while (p < end && PgnBlankLine(p, end)) p = PgnNextLine(p, end);
+            }
+        }
+        if (!entries.empty() && !WritePgnRun(indexPath, nextRun++, entries)) writeFailed = true;
+        totalGames += games;
+        totalPlies += plies;
+        failedGames += failed;
+        indexed += positions;
+        for (int i = 0; i < 4; i++) results[i] += gameResults[i];
+    };
+
+    long long start = SteadyMicros();
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; t++) pool.emplace_back(worker);
+    for (int t = 0; t < threads; t++) pool[t].join();
+    double replayMs = (SteadyMicros() - start) / 1000.0;
+
+    unsigned long long entries = 0;
+    bool indexOk = !writeFailed;
+    double mergeMs = 0;
+    if (indexPath) {
+        long long mergeStart = SteadyMicros();
+        indexOk = MergePgnRuns(indexPath, nextRun, totalGames, pgn.size, entries) && indexOk;
+        mergeMs = (SteadyMicros() - mergeStart) / 1000.0;
+    }
+    UnmapFile(pgn);
+
+    double seconds = replayMs / 1000.0;
+    printf("===========================\n");
+    printf("File            : %s (%.1f MB)\n", path, pgn.size / 1048576.0);
+    printf("Games           : %llu, %llu not replayed to the end\n", totalGames.load(), failedGames.load());
+    printf("Results         : 1-0 %llu, 1/2 %llu, 0-1 %llu, * %llu\n", results[PGN_WHITE_WINS].load(),
+           results[PGN_DRAW].load(), results[PGN_BLACK_WINS].load(), results[PGN_NO_RESULT].load());
+    printf("Moves           : %llu\n", totalPlies.load());
+    printf("Total time (ms) : %.0f (%d threads)\n", replayMs, threads);
+    printf("Games/second    : %.0f\n", seconds > 0 ? totalGames / seconds : 0.0);
+    printf("Moves/second    : %.0f\n", seconds > 0 ? totalPlies / seconds : 0.0);
+    printf("MB/second       : %.1f\n", seconds > 0 ? pgn.size / 1048576.0 / seconds : 0.0);
+    if (indexPath) {
+        printf("Index           : %s, %llu entries from %llu positions, %d runs merged in %.0f ms\n", indexPath,
+               entries, indexed.load(), nextRun.load(), mergeMs);
+        if (!indexOk) return fprintf(stderr, "cannot write %s\n", indexPath), 1;
+    }
+    return 0;
+}
+
+// pgn find <index> <file.pgn> "<fen>": the games the position occurs in, with their tags
+int PgnFind(int argc, char* argv[]) {
+    if (argc < 6) return fprintf(stderr, "usage: %s pgn find <index> <file.pgn> \"<fen>\"\n", argv[0]), 1;
+    if (!LoadFen(argv[5])) return fprintf(stderr, "bad FEN: %s\n", argv[5]), 1;
+    unsigned long long key = PgnPositionKey();
+
+    MappedFile index, pgn;
+    if (!MapFile(argv[3], index)) return fprintf(stderr, "cannot read %s\n", argv[3]), 1;
+    const PgnIndexHeader* header = (const PgnIndexHeader*)index.data;
+    if (index.size < sizeof(PgnIndexHeader) || memcmp(header->magic, PGN_INDEX_MAGIC, sizeof(header->magic)) != 0 ||
+        index.size != sizeof(PgnIndexHeader) + header->entries * sizeof(PgnIndexEntry)) {
+        UnmapFile(index);
+        return fprintf(stderr, "%s is not a PGN index\n", argv[3]), 1;
+    }
+    if (!MapFile(argv[4], pgn) || pgn.size != header->pgnBytes) {
+        UnmapFile(index);
+        UnmapFile(pgn);
+        return fprintf(stderr, "%s is missing or not the indexed file\n", argv[4]), 1;
+    }
+
+    const PgnIndexEntry* entries = (const PgnIndexEntry*)(header + 1);
+    PgnIndexEntry first = {key, 0};
+    const PgnIndexEntry* match = std::lower_bound(entries, entries + header->entries, first);
+    int found = 0;
+    for (; match < entries + header->entries && match->key == key; match++, found++) {
+        const char* p = pgn.data + match->offset;
+        const char* end = pgn.data + pgn.size;
+        const char* tags[] = {"White", "Black", "Result", "Event", "Date"};
+        std::string values[5];
+        for (; p < end && *p == '['; p = PgnNextLine(p, end)) {
+            for (int t = 0; t < 5; t++) {
+                const char* value;
+                int length;
+                if (PgnTagValue(p, PgnNextLine(p, end), tags[t], value, length)) values[t].assign(value, length);
+            }
+        }
+        printf("%12llu  %s - %s  %s  %s  %s\n", match->offset, values[0].c_str(), values[1].c_str(),
+               values[2].c_str(), values[3].c_str(), values[4].c_str());
+    }
+    printf("%d of %llu games\n", found, header->games);
+    UnmapFile(index);
+    UnmapFile(pgn);
+    return 0;
+}
+
+int PgnCommand(int argc, char* argv[]) {
+    if (argc >= 4 && strcmp(argv[2], "scan") == 0) return PgnScan(argc, argv);
+    if (argc >= 3 && strcmp(argv[2], "find") == 0) return PgnFind(argc, argv);
+    fprintf(stderr, "usage: %s pgn scan <file.pgn> [--threads N] [--index file] [--plies N]\n"
+                    "       %s pgn find <index> <file.pgn> \"<fen>\"\n", argv[0], argv[0]);
+    return 1;
+}
+
+// cache stats <file>: fill and age of a persistent analysis cache
+int CacheCommand(int argc, char* argv[]) {
+    if (argc < 4 || strcmp(argv[2], "stats") != 0) {
+        fprintf(stderr, "usage: %s cache stats <file>\n", argv[0]);
+        return 1;
+    }
+    if (!OpenAnalysisCache(argv[3], 0)) {
+        fprintf(stderr, "cannot open %s\n", argv[3]);
+        return 1;
+    }
+    unsigned long long used = 0, ageTotal = 0, depthTotal = 0;
+    for (unsigned long long b = 0; b < analysisCache.bucketCount; b++) {
+        for (int i = 0; i < ANALYSIS_CACHE_BUCKET_SIZE; i++) {
+            unsigned long long data = analysisCache.buckets[b].entries[i].data.load(std::memory_order_relaxed);
+            if (data == 0) continue;
+            used++;
+            depthTotal += CacheDataDepth(data);
+            // Opening for stats is a session of its own, the newest results are one session old
+            ageTotal += CacheDataAge(data) - 1;
+        }
+    }
+    unsigned long long entries = analysisCache.bucketCount * ANALYSIS_CACHE_BUCKET_SIZE;
+    printf("File            : %s (%.1f MB)\n", argv[3], analysisCache.bytes / 1048576.0);
+    printf("Sessions        : %llu\n", (unsigned long long)analysisCache.header->generation);
+    printf("Entries         : %llu / %llu (%.2f%%)\n", used, entries, used * 100.0 / entries);
+    printf("Average age     : %.2f sessions\n", used ? (double)ageTotal / used : 0.0);
+    printf("Average depth   : %.2f\n", used ? (double)depthTotal / used : 0.0);
+    CloseAnalysisCache();
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    NnueInit();
+
+    // Global options ahead of the command: --cache <file> [--cache-mb N] keeps root
+    // search results in a persistent analysis cache (fixed-depth searches only: timed
+    // searches and MultiPV never consult it), --large-pages 0 keeps search tables
+    // off huge pages, --engine <config> sets the search as in selfplay (e.g. lmp=1,probcut=0)
+    const char* cachePath = NULL;
+    int cacheMb = 0;
+    while (argc > 2 && (strcmp(argv[1], "--cache") == 0 || strcmp(argv[1], "--cache-mb") == 0 ||
+                        strcmp(argv[1], "--large-pages") == 0 || strcmp(argv[1], "--engine") == 0)) {
+        if (strcmp(argv[1], "--cache") == 0) cachePath = argv[2];
+        else if (strcmp(argv[1], "--cache-mb") == 0) cacheMb = atoi(argv[2]);
+        else if (strcmp(argv[1], "--engine") == 0) {
+            if (!ParseEngineConfig(argv[2], engineConfig)) {
+                fprintf(stderr, "bad engine config: %s\n", argv[2]);
+                return 1;
+            }
+        }
+        else useLargePages = atoi(argv[2]) != 0;
+        argv[2] = argv[0];
+        argv += 2;
+        argc -= 2;
+    }
+    if (cachePath) {
+        if (!OpenAnalysisCache(cachePath, cacheMb)) {
+            fprintf(stderr, "cannot open analysis cache %s\n", cachePath);
+            return 1;
+        }
+        atexit(CloseAnalysisCache);
+    }
+    const char* command = (argc > 1) ? argv[1] : "bench";
+
+    if (strcmp(command, "bench") == 0) {
+        // bench [depth] [repeat]: the node total is the bench signature
+        int depth = (argc > 2) ? atoi(argv[2]) : 3;
+        int repeat = Max(1, (argc > 3) ? atoi(argv[3]) : 1);
+        unsigned long long totalNodes = 0;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeat; r++) {
+            for (int i = 0; i < benchPositionCount; i++) {
+                totalNodes += RunSearch(benchPositions[i], depth, r == 0);
+            }
+        }
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        printf("===========================\n");
+        printf("Total time (ms) : %.0f\n", ms);
+        printf("Nodes searched  : %llu\n", totalNodes / repeat);
+        printf("Nodes/second    : %.0f\n", ms > 0 ? totalNodes * 1000.0 / ms : 0.0);
+        if (analysisCache.header) {
+            printf("Cache hits      : %llu / %llu probes, %llu stores\n", analysisCacheHits.load(),
+                   analysisCacheHits.load() + analysisCacheMisses.load(), analysisCacheStores.load());
+        }
+        return 0;
+    }
+    if (strcmp(command, "search") == 0 && argc > 3) {
+        // search <depth> <fen>
+        if (!LoadFen(argv[3])) return fprintf(stderr, "bad FEN: %s\n", argv[3]), 1;
+        RunSearch(argv[3], atoi(argv[2]), true);
+        return 0;
+    }
+    if (strcmp(command, "go") == 0 && argc > 5) {
+        // go <time ms> <increment ms> <moves to go> <fen>
+        TimeControl clock = {atoll(argv[2]), atoll(argv[3]), atoi(argv[4])};
+        return GoCommand(clock, argv[5]);
+    }
+    if (strcmp(command, "multipv") == 0 && argc > 4) {
+        // multipv <depth> <lines> <fen>
+        return MultiPvCommand(atoi(argv[2]), atoi(argv[3]), argv[4]);
+    }
+    if (strcmp(command, "selfplay") == 0) {
+        return SelfPlayCommand(argc, argv);
+    }
+    if (strcmp(command, "ponder") == 0) {
+        // ponder [depth] [plies] [think ms]
+        return PonderCommand((argc > 2) ? atoi(argv[2]) : 4, (argc > 3) ? atoi(argv[3]) : 60,
+                             (argc > 4) ? atoi(argv[4]) : 1000);
+    }
+    if (strcmp(command, "gendata") == 0) {
+        return GenDataCommand(argc, argv);
+    }
+    if (strcmp(command, "tune") == 0) {
+        return TuneCommand(argc, argv);
+    }
+    if (strcmp(command, "nnue") == 0) {
+        return NnueCommand(argc, argv);
+    }
+    if (strcmp(command, "cache") == 0) {
+        return CacheCommand(argc, argv);
+    }
+    if (strcmp(command, "serve") == 0) {
+        return ServeCommand(argc, argv);
+    }
+    if (strcmp(command, "loadgen") == 0) {
+        return LoadGenCommand(argc, argv);
+    }
+    if (strcmp(command, "ttbench") == 0) {
+        return TableBenchCommand(argc, argv);
+    }
+    if (strcmp(command, "perft") == 0) {
+        return PerftCommand(argc, argv);
+    }
+    if (strcmp(command, "pgn") == 0) {
+        return PgnCommand(argc, argv);
+    }
+    if (strcmp(command, "gbench") == 0) {
+        // gbench [depth] [ms]: the bench positions through the shared searcher
+        int depth = (argc > 2) ? atoi(argv[2]) : 4;
+        int timeLimitMs = (argc > 3) ? atoi(argv[3]) : 0;
+        ChessGame game;
+        RunGameBench("chess", game, SetUpBenchPosition, benchPositionCount, depth, timeLimitMs);
+        return 0;
+    }
+
+    fprintf(stderr, "usage: %s [--cache file] [--cache-mb N] [--large-pages 0|1] [--engine config] <command> ...\n"
+                    "       (--cache serves fixed-depth root searches; go, time=, multipv and serve do not use it)\n"
+                    "       %s bench [depth] [repeat]\n"
+                    "       %s search <depth> \"<fen>\"\n"
+                    "       %s go <time ms> <increment ms> <moves to go> \"<fen>\"\n"
+                    "       %s multipv <depth> <lines> \"<fen>\"\n"
+                    "       %s gbench [depth] [ms]\n"
+                    "       %s ponder [depth] [plies] [think ms]\n"
+                    "       %s nnue bench [depth] [games] [net file] | nnue check [depth] | nnue export <file>\n"
+                    "       %s gendata <file> [games] [depth] [threads]\n"
+                    "       %s tune <positions file> [--epochs N] [--lr X] [--threads N] [--weights file] [--out file]\n"
+                    "       %s cache stats <file>\n"
+                    "       %s serve <socket> [--workers N] [--hash MB] [--partitions N] [--pin 0|1]\n"
+                    "       %s loadgen <socket> [--games N] [--connections N] [--plies N] [--depth D] [--ms T] [--clock C]\n"
+                    "                [--inc I]\n"
+                    "       %s ttbench [--mb N] [--threads N] [--depth D] [--probes N]\n"
+                    "       %s perft <depth>|suite [--fen \"<fen>\"] [--threads N] [--hash MB] [--divide 1]\n"
+                    "       %s pgn scan <file.pgn> [--threads N] [--index file] [--plies N]\n"
+                    "       %s pgn find <index> <file.pgn> \"<fen>\"\n"
+                    "       %s selfplay [--a depth=3,book=0,nnue=0,weights=file,prune=1,time=ms,inc=ms,mtg=N] [--b ...]\n"
+                    "                [--games N] [--threads N] [--openings file] [--maxplies N] [--elo0 E] [--elo1 E]\n"
+                    "                [--alpha A] [--beta B] [--net file]\n",
+                    argv[0], argv[0], argv[0], argv[0], argv[0], argv[0], argv[0], argv[0], argv[0],
+                    argv[0], argv[0], argv[0], argv[0], argv[0], argv[0], argv[0], argv[0], argv[0]);
+    return 1;
+}
+#else
+int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int nCmdShow) {    
+
+    // The AI evaluates with a trained network when one sits next to the program
+    NnueInit();
+    if (NnueLoad("chess.nnue")) engineConfig.nnue = true;
+    // ... and with tuned weights once they are copied to eval_weights.txt ("tune" writes
+    // tuned_weights.txt, so a tuning run never changes the GUI's play by itself)
+    static int tunedWeights[EVAL_PARAM_COUNT];
+    if (LoadEvalWeights("eval_weights.txt", tunedWeights)) engineConfig.evalWeights = tunedWeights;
+    // ... and remembers its analysis across games when an analysis cache file is there
+    if (GetFileAttributesA("analysis_cache.bin") != INVALID_FILE_ATTRIBUTES) OpenAnalysisCache("analysis_cache.bin", 0);
+
+    // Define the window class (like a template for the chess window)
+    WNDCLASS wc = {};
+    wc.lpfnWndProc = WndProc;       // Handles mouse clicks, keyboard, etc.
+    wc.hInstance = hInstance;       // The program instance
+    wc.lpszClassName = _T("chessclass"); // Class name
+    wc.hbrBackground = (HBRUSH)(COLOR_WINDOW + 1); // Background color
+
+    // Register the window class (so Windows knows about it)
+    if (!RegisterClass(&wc)) {
+        MessageBox(NULL, _T("Window Registration Failed!"), _T("Error!"), MB_ICONERROR | MB_OK);
+        return 0;
+    }
+
+    // Calculate window size (8x8 squares + margins + space for buttons)
+    RECT windowRect = {0, 0, 8*squareSize + boardStartX + analysisPanelWidth, 8*squareSize + boardStartY + 100};
+    AdjustWindowRect(&windowRect, WS_OVERLAPPEDWINDOW & ~WS_THICKFRAME & ~WS_MAXIMIZEBOX, FALSE);
+
+    HWND hwnd = CreateWindow(
+        wc.lpszClassName,
+        _T("Chess Game"),
+        WS_OVERLAPPEDWINDOW & ~WS_THICKFRAME & ~WS_MAXIMIZEBOX,
+        CW_USEDEFAULT, CW_USEDEFAULT,
+        windowRect.right - windowRect.left + 30,
+        windowRect.bottom - windowRect.top + 60,
+        NULL, NULL, hInstance, NULL
+    );
+
+    // Create mode selection buttons
+    CreateModeButtons(hwnd);
+
+    // Show the window
+    ShowWindow(hwnd, nCmdShow);
+    UpdateWindow(hwnd);
+
+    // Message loop (keeps the window running)
+    MSG msg;
+    while (GetMessage(&msg, NULL, 0, 0)) {
+        TranslateMessage(&msg); // Handles keyboard input
+        DispatchMessage(&msg);  // Sends messages to WndProc
     }
     return 0;
-}
\ No newline at end of file
+}
+#endif
@@ -0,0 +1,238 @@
+#ifndef GAME_SEARCH_H
+#define GAME_SEARCH_H
+
+// Game-independent alpha-beta search and benchmark driver, shared by chess.cpp and
+// tic_tac_toe.cpp, so a search change is written once and measured on both games. The
+// m,n,k (gomoku) AI of tic_tac_toe.cpp plays its moves through GameSearcher.
+//
+// A game plugs in as a class with:
+//
+//   typedef ... Move;                       small, copyable
+//   static const int MAX_MOVES;             bound on GenerateMoves()
+//   static const int WIN_SCORE;             value of a won game, every other score stays well below it
+//   int  GenerateMoves(Move moves[]);       legal moves of the side to move, likely best first
+//   void MakeMove(const Move& move);
+//   void UnmakeMove(const Move& move);      takes back the last MakeMove()
+//   bool IsTerminal(int& score);            game over before generating moves? score for the side to move
+//   int  NoMovesScore();                    score when GenerateMoves() found nothing (mate, stalemate)
+//   int  Evaluate(int alpha, int beta);     leaf score for the side to move, may stop at the
+//                                           window bounds (a quiescence search) or ignore them
+//   unsigned long long Hash();              position key, equal positions give equal keys
+//   void MoveToText(const Move& move, char out[16]);
+//
+// Scores are negamax: always from the side to move's point of view. A won or lost game
+// found by the search scores WIN_SCORE - ply, so shorter wins and longer losses rank higher.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+const int GAME_SEARCH_MAX_PLY = 128;       // Deepest ply the searcher (and a game's undo stack) must handle
+const int GAME_SEARCH_INFINITY = 1 << 30;
+
+template <class Game>
+struct GameSearcher {
+    typedef typename Game::Move Move;
+
+    enum Bound { BOUND_NONE, BOUND_EXACT, BOUND_LOWER, BOUND_UPPER };
+    struct TTEntry {
+        unsigned long long key;
+        int score;                 // Won/lost scores stored relative to this node, see ScoreToTT()
+        short depth;
+        unsigned short bestIndex;  // Best move's index in GenerateMoves() order
+        unsigned char bound;
+    };
+
+    struct Result {
+        Move move;
+        bool hasMove;              // False when the root position is already over
+        int score;
+        int depth;                 // Last completed iteration
+        unsigned long long nodes;
+        double ms;
+    };
+
+    bool useTT;
+    unsigned long long nodes;
+    unsigned long long ttHits;
+
+    explicit GameSearcher(int ttBits = 20) : useTT(true), nodes(0), ttHits(0), table((size_t)1 << ttBits),
+                                             timeLimitMs(0), aborted(false), rootHasMove(false) {}
+
+    void Clear() {
+        std::fill(table.begin(), table.end(), TTEntry());
+    }
+
+    // Iterative deepening to maxDepth, stopped early after timeLimitMs (0 for no limit).
+    // The result is that of the last iteration that finished.
+    Result Search(Game& game, int maxDepth, int timeLimitMs) {
+        this->timeLimitMs = timeLimitMs;
+        start = std::chrono::steady_clock::now();
+        aborted = false;
+        nodes = 0;
+        ttHits = 0;
+
+        Result result;
+        result.move = Move();
+        result.hasMove = false;
+        result.score = 0;
+        result.depth = 0;
+        for (int depth = 1; depth <= maxDepth && depth < GAME_SEARCH_MAX_PLY; depth++) {
+            rootHasMove = false;
+            int score = Negamax(game, depth, -GAME_SEARCH_INFINITY, GAME_SEARCH_INFINITY, 0);
+            if (aborted) break;
+            result.move = rootMove;
+            result.hasMove = rootHasMove;
+            result.score = score;
+            result.depth = depth;
+            // A proven result cannot change with more depth
+            if (score >= Game::WIN_SCORE - GAME_SEARCH_MAX_PLY || score <= -Game::WIN_SCORE + GAME_SEARCH_MAX_PLY) break;
+        }
+        result.nodes = nodes;
+        result.ms = ElapsedMs();
+        return result;
+    }
+
+private:
+    std::vector<TTEntry> table;
+    int timeLimitMs;
+    bool aborted;
+    std::chrono::steady_clock::time_point start;
+    Move rootMove;
+    bool rootHasMove;
+
+    double ElapsedMs() const {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    TTEntry& Slot(unsigned long long key) {
+        key ^= key >> 33;
+        key *= 0xFF51AFD7ED558CCDULL;
+        key ^= key >> 33;
+        return table[key & (table.size() - 1)];
+    }
+
+    // Game results carry the ply they were found at; the table keeps them relative to
+    // the stored node so a transposition at another ply reads the right distance
+    static int GameScore(int score, int ply) {
+        if (score >= Game::WIN_SCORE) return Game::WIN_SCORE - ply;
+        if (score <= -Game::WIN_SCORE) return -Game::WIN_SCORE + ply;
+        return score;
+    }
+    static int ScoreToTT(int score, int ply) {
+        if (score >= Game::WIN_SCORE - GAME_SEARCH_MAX_PLY) return score + ply;
+        if (score <= -Game::WIN_SCORE + GAME_SEARCH_MAX_PLY) return score - ply;
+        return score;
+    }
+    static int ScoreFromTT(int score, int ply) {
+        if (score >= Game::WIN_SCORE - GAME_SEARCH_MAX_PLY) return score - ply;
+        if (score <= -Game::WIN_SCORE + GAME_SEARCH_MAX_PLY) return score + ply;
+        return score;
+    }
+
+    int Negamax(Game& game, int depth, int alpha, int beta, int ply) {
+        nodes++;
+        if (timeLimitMs > 0 && (nodes & 1023) == 0 && ElapsedMs() >= timeLimitMs) aborted = true;
+        if (aborted) return 0;
+
+        int score;
+        if (game.IsTerminal(score)) return GameScore(score, ply);
+        if (depth <= 0 || ply >= GAME_SEARCH_MAX_PLY - 1) return game.Evaluate(alpha, beta);
+
+        // Transposition table: cutoff from a deep enough entry, else its move goes first
+        unsigned long long key = 0;
+        TTEntry* entry = 0;
+        int ttIndex = -1;
+        if (useTT) {
+            key = game.Hash();
+            entry = &Slot(key);
+            if (entry->bound != BOUND_NONE && entry->key == key) {
+                ttHits++;
+                ttIndex = entry->bestIndex;
+                if (entry->depth >= depth && ply > 0) {
+                    int ttScore = ScoreFromTT(entry->score, ply);
+                    if (entry->bound == BOUND_EXACT) return ttScore;
+                    if (entry->bound == BOUND_LOWER && ttScore >= beta) return ttScore;
+                    if (entry->bound == BOUND_UPPER && ttScore <= alpha) return ttScore;
+                }
+            }
+        }
+
+        Move moves[Game::MAX_MOVES];
+        int count = game.GenerateMoves(moves);
+        if (count == 0) return GameScore(game.NoMovesScore(), ply);
+
+        unsigned short order[Game::MAX_MOVES];
+        for (int i = 0; i < count; i++) order[i] = (unsigned short)i;
+        if (ttIndex > 0 && ttIndex < count) std::swap(order[0], order[ttIndex]);
+
+        int originalAlpha = alpha;
+        int best = -GAME_SEARCH_INFINITY;
+        int bestIndex = 0;
+        for (int i = 0; i < count; i++) {
+            const Move& move = moves[order[i]];
+            game.MakeMove(move);
+            score = -Negamax(game, depth - 1, -beta, -alpha, ply + 1);
+            game.UnmakeMove(move);
+            if (aborted) return 0;
+
+            if (score > best) {
+                best = score;
+                bestIndex = order[i];
+                if (ply == 0) {
+                    rootMove = move;
+                    rootHasMove = true;
+                }
+            }
+            if (score > alpha) alpha = score;
+            if (alpha >= beta) break;
+        }
+
+        if (entry) {
+            entry->key = key;
+            entry->score = ScoreToTT(best, ply);
+            entry->depth = (short)depth;
+            entry->bestIndex = (unsigned short)bestIndex;
+            entry->bound = (unsigned char)(best <= originalAlpha ? BOUND_UPPER : best >= beta ? BOUND_LOWER : BOUND_EXACT);
+        }
+        return best;
+    }
+};
+
+// Searches 'positions' positions (setUp(game, i) loads number i, false if it cannot) to
+// 'depth' with and without the transposition table, one line per search plus totals.
+// Returns the node total of the TT runs, the bench signature.
+template <class Game>
+unsigned long long RunGameBench(const char* name, Game& game, bool (*setUp)(Game&, int), int positions,
+                                int depth, int timeLimitMs) {
+    GameSearcher<Game> searcher;
+    unsigned long long signature = 0;
+    for (int pass = 0; pass < 2; pass++) {
+        searcher.useTT = (pass == 0);
+        unsigned long long totalNodes = 0;
+        double totalMs = 0;
+        printf("== %s, depth %d, %s\n", name, depth, searcher.useTT ? "alpha-beta + TT" : "alpha-beta");
+        for (int i = 0; i < positions; i++) {
+            if (!setUp(game, i)) {
+                fprintf(stderr, "%s: cannot set up position %d\n", name, i);
+                continue;
+            }
+            searcher.Clear();
+            typename GameSearcher<Game>::Result result = searcher.Search(game, depth, timeLimitMs);
+            char text[16] = "-";
+            if (result.hasMove) game.MoveToText(result.move, text);
+            printf("%3d  depth %3d  score %7d  move %-6s nodes %12llu  tt hits %10llu  time %9.2f ms\n",
+                   i + 1, result.depth, result.score, text, result.nodes, searcher.ttHits, result.ms);
+            totalNodes += result.nodes;
+            totalMs += result.ms;
+        }
+        printf("Nodes searched  : %llu\n", totalNodes);
+        printf("Total time (ms) : %.1f\n", totalMs);
+        printf("Nodes/second    : %.0f\n", totalMs > 0 ? totalNodes * 1000.0 / totalMs : 0.0);
+        if (pass == 0) signature = totalNodes;
+    }
+    return signature;
+}
+
+#endif
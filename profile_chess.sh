@@ -0,0 +1,94 @@
+#!/usr/bin/env bash
+# Sampling profile of the chess search on Linux.
+#
+# Builds the headless search driver (chess.cpp with -DCHESS_HEADLESS) with frame
+# pointers and symbols, runs "bench" over the bench positions under perf record
+# and renders a flame graph per build variant.
+#
+#   ./profile_chess.sh [variant] [depth] [repeat]
+#   ./profile_chess.sh microbench [google benchmark flags...]
+#
+#   variant  fp       -O2, frame pointers, symbols (default)
+#            fp-lto   same with -flto, shows what survives cross-function inlining
+#            build    only build both variants, no profiling
+#            all      profile fp and fp-lto
+#            microbench  build and run the Google Benchmark suite of engine primitives
+#                     (-DCHESS_MICROBENCH, needs libbenchmark), remaining arguments are
+#                     passed through, e.g. --benchmark_filter=BM_Evaluate
+#   depth    bench search depth (default 3)
+#   repeat   times the bench position set is searched (default 5)
+#
+# Needs perf and Brendan Gregg's FlameGraph scripts
+# (git clone https://github.com/brendangregg/FlameGraph, point FLAMEGRAPH_DIR at it).
+# Output goes to profile_out/: binaries, perf.<variant>.data, <variant>.folded, flame.<variant>.svg
+
+set -euo pipefail
+
+cd "$(dirname "$0")"
+
+VARIANT="${1:-fp}"
+DEPTH="${2:-3}"
+REPEAT="${3:-5}"
+CXX="${CXX:-g++}"
+OUT="profile_out"
+FLAMEGRAPH_DIR="${FLAMEGRAPH_DIR:-$HOME/FlameGraph}"
+
+BASE_FLAGS="-std=c++17 -O2 -g -fno-omit-frame-pointer -mno-omit-leaf-frame-pointer -DCHESS_HEADLESS"
+
+mkdir -p "$OUT"
+
+build() {
+    local variant="$1"
+    local flags="$BASE_FLAGS"
+    case "$variant" in
+        fp) ;;
+        fp-lto) flags="$flags -flto" ;;
+        *) echo "unknown variant: $variant" >&2; exit 1 ;;
+    esac
+    echo "== building $OUT/chess_$variant ($flags)"
+    # shellcheck disable=SC2086
+    "$CXX" $flags ${CXXFLAGS:-} chess.cpp -o "$OUT/chess_$variant" -pthread
+}
+
+profile() {
+    local variant="$1"
+    build "$variant"
+
+    if ! command -v perf >/dev/null 2>&1; then
+        echo "perf not found (install linux-perf / linux-tools)" >&2
+        exit 1
+    fi
+
+    echo "== perf record: bench depth $DEPTH x$REPEAT"
+    perf record -F 1999 -g --call-graph fp -o "$OUT/perf.$variant.data" \
+        -- "$OUT/chess_$variant" bench "$DEPTH" "$REPEAT"
+
+    echo "== top functions (self time)"
+    perf report -i "$OUT/perf.$variant.data" --no-children --stdio --percent-limit 2 2>/dev/null \
+        | grep -v '^#' | grep -v '^$' | head -25
+
+    if [[ -x "$FLAMEGRAPH_DIR/stackcollapse-perf.pl" ]]; then
+        perf script -i "$OUT/perf.$variant.data" \
+            | "$FLAMEGRAPH_DIR/stackcollapse-perf.pl" > "$OUT/$variant.folded"
+        "$FLAMEGRAPH_DIR/flamegraph.pl" --title "chess bench depth $DEPTH ($variant)" \
+            "$OUT/$variant.folded" > "$OUT/flame.$variant.svg"
+        echo "== flame graph: $OUT/flame.$variant.svg"
+    else
+        echo "FlameGraph scripts not found in $FLAMEGRAPH_DIR, skipping the SVG" >&2
+    fi
+}
+
+microbench() {
+    local flags="-std=c++17 -O2 -g -DNDEBUG -DCHESS_HEADLESS -DCHESS_MICROBENCH"
+    echo "== building $OUT/chess_microbench ($flags)"
+    # shellcheck disable=SC2086
+    "$CXX" $flags ${CXXFLAGS:-} chess.cpp -o "$OUT/chess_microbench" -lbenchmark -pthread
+    "$OUT/chess_microbench" "$@"
+}
+
+case "$VARIANT" in
+    microbench) shift; microbench "$@" ;;
+    build) build fp; build fp-lto ;;
+    all) profile fp; profile fp-lto ;;
+    *) profile "$VARIANT" ;;
+esac
@@ -1,19 +1,177 @@
+#ifndef TICTACTOE_HEADLESS
 #define UNICODE
 #define _UNICODE
 #include <windows.h>
 #include <tchar.h>
-#include <vector>
+#else
+// Headless build (-DTICTACTOE_HEADLESS): game logic + command-line benchmark, no window
+#include <cstdio>
+#include <cstdlib>
+#endif
+#include "game_search.h" // Shared alpha-beta searcher: the m,n,k AI and the "gbench" command
 #include <algorithm>
+#include <chrono>         // Search deadlines and benchmark timing
+#include <cmath>          // UCT
+#include <cstring>
+#include <atomic>         // Tree-parallel MCTS statistics
+#include <memory>
+#include <thread>
+#include <vector>
+#ifdef _MSC_VER
+#include <intrin.h>       // _BitScanForward
+#endif
 
 // Game state
-int board[3][3] = {0}; // 0=empty, 1=X, 2=O
+// The board is two 9-bit masks, bit (row * 3 + col) set where X / O has played
+struct BitBoard {
+    unsigned short x;
+    unsigned short o;
+};
+BitBoard board = {0, 0};
 int currentPlayer = 1;  // 1=X, 2=O
 bool gameOver = false;
 bool vsAI = false;      // Player vs AI mode
 
+// Board variants, picked with the buttons under the mode buttons
+enum GameVariant { VARIANT_CLASSIC, VARIANT_GOMOKU, VARIANT_ULTIMATE, VARIANT_QUBIC, VARIANT_COUNT };
+GameVariant currentVariant = VARIANT_CLASSIC;
+
 // Constants
 const int CELL_SIZE = 200;
 const int BOARD_SIZE = CELL_SIZE * 3;
+const unsigned short FULL_BOARD = 0x1FF;
+// Rows, columns, diagonals
+const unsigned short WIN_MASKS[8] = {0x007, 0x038, 0x1C0, 0x049, 0x092, 0x124, 0x111, 0x054};
+unsigned long long searchNodes = 0; // Minimax nodes, used by the headless benchmark
+
+// m,n,k engine (gomoku), see MnkNewGame()
+const int MNK_MAX = 19;                              // Largest board side
+const int MNK_MAX_K = 8;                             // Longest row to win
+const int MNK_MAX_WINDOWS = 4 * MNK_MAX * MNK_MAX;   // k-long windows, at most one per cell and direction
+const int MNK_WIN = 100000000;                       // Score of a won position (minus the ply)
+const int MNK_TT_BITS = 18;                          // Transposition table has 2^MNK_TT_BITS entries
+
+int mnkWidth = 15, mnkHeight = 15, mnkK = 5;
+int mnkTimeLimitMs = 1000;                 // AI thinking time per move
+int mnkBranchLimit = 12;                   // Moves searched per node when nothing is forced
+signed char mnkCells[MNK_MAX * MNK_MAX];   // Cell (row * MNK_MAX + col): 0 empty, 1 X, 2 O
+int mnkStones = 0;
+int mnkWinner = 0;                         // Player who made k in a row, 0 if nobody yet
+int mnkThreatScore = 0;                    // Sum of window values, X positive
+int mnkWindowCount = 0;
+unsigned char mnkWindowStones[MNK_MAX_WINDOWS][2];           // X and O stones in each window
+short mnkCellWindows[MNK_MAX * MNK_MAX][4 * MNK_MAX_K];     // Windows through each cell
+int mnkCellWindowCount[MNK_MAX * MNK_MAX];
+unsigned char mnkNear[MNK_MAX * MNK_MAX];  // Stones within two cells, candidate moves need one
+unsigned long long mnkHash = 0;
+unsigned long long mnkZobrist[MNK_MAX * MNK_MAX][2];
+unsigned long long mnkNodes = 0;           // Of the last MnkSearch()
+int mnkDepthReached = 0;
+int mnkBestScore = 0;
+
+// Alpha-beta solver for n x n boards, see GridNewGame()
+const int GRID_MAX = 4;            // Largest board side
+const int GRID_WIN = 100;          // Score of a won position (minus the stones played)
+const int GRID_TT_BITS = 20;       // Transposition table has 2^GRID_TT_BITS entries
+enum GridTTFlag { GRID_TT_EMPTY, GRID_TT_EXACT, GRID_TT_LOWER, GRID_TT_UPPER };
+
+struct GridTTEntry {
+    unsigned int key;     // Canonical X | O << 16
+    signed char score;
+    unsigned char flag;
+};
+
+int gridSize = 3;
+unsigned int gridFull = 0;
+unsigned int gridLines[2 * GRID_MAX + 2];
+int gridLineCount = 0;
+unsigned char gridSymmetry[8][GRID_MAX * GRID_MAX];
+int gridMoveOrder[GRID_MAX * GRID_MAX];
+bool gridUseTT = true;
+bool gridUseSymmetry = true;
+GridTTEntry gridTT[1 << GRID_TT_BITS];
+unsigned long long gridNodes = 0;
+unsigned long long gridTTHits = 0;
+
+// Ultimate tic-tac-toe, see UltimateApply()
+struct UltimateState {
+    unsigned short x[9], o[9];      // Per small board, same layout as BitBoard
+    unsigned short wonX, wonO;      // Small boards won, bit = board index
+    unsigned short drawn;           // Small boards full without a winner
+    signed char forced;             // Board the next move must be played on, -1 for any
+    unsigned char player;           // Side to move, 1=X, 2=O
+    unsigned char winner;           // 0 ongoing, 1 X, 2 O, 3 draw
+};
+
+// MCTS node, see MctsSearch()
+struct MctsNode {
+    int firstChild;            // Pool index of the first child, -1 until expanded
+    unsigned int visits;
+    float wins;                // For the player who made 'move' (draws count half)
+    unsigned char move;        // Move leading here, sub * 9 + cell
+    unsigned char childCount;
+};
+
+const int MCTS_POOL_SIZE = 1 << 20;        // Nodes per pool
+UltimateState ultimateGame;                // Game shown in the window
+int ultimateTimeLimitMs = 1000;            // AI thinking time per move
+int ultimatePlayoutLimit = 0;              // Playouts per move, 0 for the time limit only
+thread_local unsigned long long ultimateRng = 0x2545F4914F6CDD1DULL; // Playout RNG, one per search thread
+MctsNode mctsPools[2][MCTS_POOL_SIZE];     // Active pool plus the one the tree is compacted into
+MctsNode* mctsPool = mctsPools[0];
+int mctsUsed = 0;
+UltimateState mctsRootState;               // Position at the root of the tree
+double mctsExploration = 1.4;              // UCT exploration constant
+unsigned long long mctsPlayouts = 0;       // Playouts in the last search
+unsigned long long mctsReused = 0;         // Root visits carried over from earlier searches
+double mctsSearchMs = 0;
+
+// Parallel MCTS, see MctsSearchParallel()
+enum MctsParallelMode {
+    MCTS_ROOT_PARALLEL,   // Independent trees per thread, root visit counts summed at the end
+    MCTS_TREE_PARALLEL    // One shared tree, atomic statistics and virtual loss
+};
+const int MCTS_VIRTUAL_LOSS = 3;              // Losses a thread adds to each node on its way down
+const int MCTS_THREAD_POOL_SIZE = 1 << 19;    // Nodes per tree in root-parallel mode
+const int MCTS_SHARED_POOL_SIZE = 1 << 21;    // Nodes of the shared tree
+int ultimateThreads = 1;                      // AI search threads, 1 keeps the single tree with reuse
+MctsParallelMode ultimateParallelMode = MCTS_TREE_PARALLEL;
+
+struct MctsSharedNode {
+    std::atomic<int> firstChild;   // Pool index of the first child, -1 leaf, -2 being expanded
+    std::atomic<int> visits;       // Includes the virtual losses of descents in flight
+    std::atomic<int> score;        // 2 per win, 1 per draw, for the player who made 'move'
+    unsigned char move;
+    unsigned char childCount;
+};
+
+// Qubic (4x4x4), see QubicInitLines()
+const int QUBIC_LINES = 76;                  // 16 per axis, 24 face diagonals, 4 space diagonals
+const int QUBIC_TT_SIZE = 1 << 19;           // Proof-number table entries (power of two)
+const unsigned int QUBIC_INF = 100000000;    // Proof / disproof number of a decided node
+
+struct QubicState {
+    unsigned long long x, o;     // Bit z * 16 + y * 4 + x set where X / O has played
+    unsigned char player;        // Side to move, 1=X, 2=O
+    unsigned char winner;        // 0 ongoing, 1 X, 2 O, 3 draw
+};
+
+struct QubicTTEntry {
+    unsigned long long own, opp;   // Side to move's stones and the other side's
+    unsigned int phi, delta;       // Proof numbers from the side to move's point of view
+    unsigned int generation;       // Solve that wrote the entry, older ones count as empty
+};
+
+QubicState qubicGame;                             // Game shown in the window
+unsigned long long qubicLines[QUBIC_LINES];
+int qubicLineCount = 0;
+unsigned char qubicCellLines[64][7];              // Lines through each cell, 7 at most
+int qubicCellLineCount[64];
+QubicTTEntry qubicTT[QUBIC_TT_SIZE];
+unsigned int qubicGeneration = 0;
+unsigned long long qubicNodes = 0;
+unsigned long long qubicNodeLimit = 0;
+unsigned long long qubicNodeBudget = 200000;      // Solver nodes per AI move
 
 // Minimax result structure
 struct MoveScore {
@@ -22,16 +180,157 @@ struct MoveScore {
     int score;
 };
 
+// Perfect-play entry for one board, see tic_tac_toe_solved.h
+struct SolvedEntry {
+    signed char score;  // Minimax value for O: 10 win, 0 draw, -10 loss
+    signed char move;   // Best square (row * 3 + col) for the side to move, -1 if the game is over
+};
+
+// Every board written in base 3 (cell i is digit i: 0 empty, 1 X, 2 O), 3^9 encodings
+const int SOLVED_STATES = 19683;
+struct SolvedTable {
+    SolvedEntry entry[SOLVED_STATES];
+};
+
 // Function prototypes
+#ifndef TICTACTOE_HEADLESS
 void DrawBoard(HDC hdc, HWND hwnd);
 void DrawX(HDC hdc, int row, int col);
 void DrawO(HDC hdc, int row, int col);
+void ShowWinnerMessage(HWND hwnd, int winner);
+#endif
 void ResetGame();
+int GetCell(int row, int col);
+void SetCell(int row, int col, int player);
 int CheckWinner();
-void ShowWinnerMessage(HWND hwnd, int winner);
 void AIMove();
-MoveScore Minimax(int board[3][3], bool isMaximizing);
-int EvaluateBoard(int board[3][3]);
+MoveScore Minimax(BitBoard board, bool isMaximizing);
+int EvaluateBoard(BitBoard board);
+int LowestBit(unsigned int mask);
+int EncodeBoard(BitBoard board);
+int BoardRows();
+int BoardCols();
+int CellSize();
+int BlockSize();
+// m,n,k engine
+void MnkNewGame(int width, int height, int k);
+void MnkPlace(int cell, int player);
+void MnkUndo(int cell);
+int MnkGenerateMoves(int player, int moves[]);
+int MnkSearch(int player, int timeLimitMs);
+// Ultimate tic-tac-toe and its MCTS
+void UltimateNewGame(UltimateState& state);
+int UltimateMoves(const UltimateState& state, unsigned char moves[]);
+bool UltimateIsLegal(const UltimateState& state, int move);
+void UltimateApply(UltimateState& state, int move);
+void UltimatePlay(int move);
+int UltimatePlayout(UltimateState state);
+void MctsReset(const UltimateState& state);
+void MctsAdvance(int move);
+int MctsSearch(int timeLimitMs, int playoutLimit);
+unsigned long long MctsGrow(MctsNode* pool, int& used, int capacity, const UltimateState& rootState,
+                            int timeLimitMs, int playoutLimit);
+int MctsSearchParallel(const UltimateState& rootState, int threads, MctsParallelMode mode,
+                       int timeLimitMs, int playoutLimit);
+bool CanPlay(int row, int col);
+// Qubic
+void QubicInitLines();
+void QubicNewGame(QubicState& state);
+void QubicApply(QubicState& state, int cell);
+unsigned long long QubicWinningCells(unsigned long long own, unsigned long long opp);
+unsigned long long QubicThreatCells(unsigned long long own, unsigned long long opp);
+int QubicSolve(unsigned long long own, unsigned long long opp, unsigned long long nodeLimit, int& move);
+int QubicBestMove(const QubicState& state);
+// n x n alpha-beta solver
+void GridNewGame(int size);
+int GridNegamax(unsigned int own, unsigned int other, int stones, int alpha, int beta);
+int GridSolve(bool useTT, bool useSymmetry);
+
+// The m,n,k board as a game for the shared searcher in game_search.h, which plays the
+// AI's moves, see MnkSearch(). 'player' is the side to move.
+struct MnkGame {
+    typedef int Move;                          // Cell, row * MNK_MAX + col
+    static const int MAX_MOVES = MNK_MAX * MNK_MAX;
+    static const int WIN_SCORE = MNK_WIN;
+    
+    int player;
+    
+    int GenerateMoves(int moves[]) { return MnkGenerateMoves(player, moves); }
+    void MakeMove(const int& cell) {
+        MnkPlace(cell, player);
+        player = 3 - player;
+    }
+    void UnmakeMove(const int& cell) {
+        MnkUndo(cell);
+        player = 3 - player;
+    }
+    bool IsTerminal(int& score) {
+        score = (mnkWinner != 0) ? -WIN_SCORE : 0; // The previous move made k in a row
+        return mnkWinner != 0 || mnkStones == mnkWidth * mnkHeight;
+    }
+    int NoMovesScore() { return 0; }
+    int Evaluate(int, int) { return (player == 1) ? mnkThreatScore : -mnkThreatScore; }
+    unsigned long long Hash() { return mnkHash ^ (unsigned long long)player; }
+    void MoveToText(const int& cell, char out[16]) {
+        snprintf(out, 16, "%c%d", 'a' + cell % MNK_MAX, cell / MNK_MAX + 1);
+    }
+};
+GameSearcher<MnkGame> mnkSearcher(MNK_TT_BITS); // Kept between moves, cleared by MnkNewGame()
+
+// 0 = game continues, 1 = X wins, 2 = O wins, 3 = draw
+int EvaluateBoard(BitBoard board) {
+    for (int i = 0; i < 8; i++) {
+        if ((board.x & WIN_MASKS[i]) == WIN_MASKS[i]) return 1;
+        if ((board.o & WIN_MASKS[i]) == WIN_MASKS[i]) return 2;
+    }
+    return ((board.x | board.o) == FULL_BOARD) ? 3 : 0;
+}
+
+// The perfect-play table, generated by BuildSolvedTable() ("tic_tac_toe gentable") and
+// checked by "tic_tac_toe verify"
+#include "tic_tac_toe_solved.h"
+
+#ifdef TICTACTOE_HEADLESS
+// Solves the whole game. Placing a piece only adds to the base-3 encoding, so walking
+// the encodings from the top down sees every child before its parent and each board
+// costs one pass over its empty squares. Ties go to the lowest square, the same move
+// Minimax() picks.
+SolvedTable BuildSolvedTable() {
+    SolvedTable table = {};
+    int power[9] = {1, 3, 9, 27, 81, 243, 729, 2187, 6561};
+    for (int index = SOLVED_STATES - 1; index >= 0; index--) {
+        BitBoard position = {0, 0};
+        int xCount = 0, oCount = 0;
+        for (int square = 0, rest = index; square < 9; square++, rest /= 3) {
+            if (rest % 3 == 1) { position.x |= 1 << square; xCount++; }
+            if (rest % 3 == 2) { position.o |= 1 << square; oCount++; }
+        }
+        SolvedEntry& entry = table.entry[index];
+        entry.move = -1;
+        if (oCount != xCount && oCount != xCount - 1) continue; // Not a position X-first play can reach
+        
+        int winner = EvaluateBoard(position);
+        if (winner != 0) {
+            entry.score = (winner == 1) ? -10 : (winner == 2) ? 10 : 0;
+            continue;
+        }
+        
+        bool oToMove = xCount > oCount; // O maximizes, X minimizes
+        entry.score = oToMove ? -100 : 100;
+        for (int square = 0; square < 9; square++) {
+            if ((position.x | position.o) & (1 << square)) continue;
+            int score = table.entry[index + (oToMove ? 2 : 1) * power[square]].score;
+            if (oToMove ? score > entry.score : score < entry.score) {
+                entry.score = (signed char)score;
+                entry.move = (signed char)square;
+            }
+        }
+    }
+    return table;
+}
+#endif
+
+#ifndef TICTACTOE_HEADLESS
 
 LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
     switch (msg) {
@@ -58,7 +357,7 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
             int xPos = LOWORD(lParam);
             int yPos = HIWORD(lParam);
             
-            if (yPos > BOARD_SIZE + 50 && yPos < BOARD_SIZE + 100) {
+            if (yPos > BOARD_SIZE + 50 && yPos < BOARD_SIZE + 95) {
                 if (xPos < 300) {
                     vsAI = false; // PvP mode
                 } else {
@@ -68,14 +367,23 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
                 InvalidateRect(hwnd, NULL, TRUE);
                 break;
             }
+            if (yPos > BOARD_SIZE + 100 && yPos < BOARD_SIZE + 140) {
+                int variant = (xPos - 10) * VARIANT_COUNT / (BOARD_SIZE - 20);
+                if (variant >= 0 && variant < VARIANT_COUNT) {
+                    currentVariant = (GameVariant)variant;
+                    ResetGame();
+                    InvalidateRect(hwnd, NULL, TRUE);
+                }
+                break;
+            }
             
             if (currentPlayer == 2 && vsAI) break; // AI's turn
             
-            int row = yPos / CELL_SIZE;
-            int col = xPos / CELL_SIZE;
+            int row = yPos / CellSize();
+            int col = xPos / CellSize();
             
-            if (row >= 0 && row < 3 && col >= 0 && col < 3 && board[row][col] == 0) {
-                board[row][col] = currentPlayer;
+            if (row >= 0 && row < BoardRows() && col >= 0 && col < BoardCols() && CanPlay(row, col)) {
+                SetCell(row, col, currentPlayer);
                 
                 int winner = CheckWinner();
                 if (winner != 0) {
@@ -116,27 +424,51 @@ void DrawBoard(HDC hdc, HWND hwnd) {
     GetClientRect(hwnd, &rect);
     
     // Draw grid
-    HPEN hPen = CreatePen(PS_SOLID, 6, RGB(0, 0, 0));
+    int rows = BoardRows(), cols = BoardCols(), cellSize = CellSize();
+    HPEN hPen = CreatePen(PS_SOLID, cellSize >= 100 ? 6 : 2, RGB(0, 0, 0));
+    HPEN hThickPen = CreatePen(PS_SOLID, 6, RGB(0, 0, 0));
     HPEN hOldPen = (HPEN)SelectObject(hdc, hPen);
     
-    // Vertical lines
-    MoveToEx(hdc, CELL_SIZE, 0, NULL);
-    LineTo(hdc, CELL_SIZE, BOARD_SIZE);
-    MoveToEx(hdc, CELL_SIZE*2, 0, NULL);
-    LineTo(hdc, CELL_SIZE*2, BOARD_SIZE);
+    // Ultimate: tint won small boards and the ones the next move may go to
+    if (currentVariant == VARIANT_ULTIMATE) {
+        unsigned short decided = ultimateGame.wonX | ultimateGame.wonO | ultimateGame.drawn;
+        for (int sub = 0; sub < 9; sub++) {
+            RECT subRect = {(sub % 3) * 3 * cellSize, (sub / 3) * 3 * cellSize,
+                            (sub % 3 + 1) * 3 * cellSize, (sub / 3 + 1) * 3 * cellSize};
+            COLORREF tint;
+            if (ultimateGame.wonX & (1 << sub)) tint = RGB(255, 210, 210);
+            else if (ultimateGame.wonO & (1 << sub)) tint = RGB(210, 210, 255);
+            else if (!gameOver && !(decided & (1 << sub)) && (ultimateGame.forced < 0 || ultimateGame.forced == sub))
+                tint = RGB(255, 255, 200);
+            else continue;
+            HBRUSH hTint = CreateSolidBrush(tint);
+            FillRect(hdc, &subRect, hTint);
+            DeleteObject(hTint);
+        }
+    }
+    
+    // Vertical lines (small-board and layer borders thick)
+    int block = BlockSize();
+    for (int col = 1; col < cols; col++) {
+        SelectObject(hdc, (block != 0 && col % block == 0) ? hThickPen : hPen);
+        MoveToEx(hdc, cellSize * col, 0, NULL);
+        LineTo(hdc, cellSize * col, cellSize * rows);
+    }
     
     // Horizontal lines
-    MoveToEx(hdc, 0, CELL_SIZE, NULL);
-    LineTo(hdc, BOARD_SIZE, CELL_SIZE);
-    MoveToEx(hdc, 0, CELL_SIZE*2, NULL);
-    LineTo(hdc, BOARD_SIZE, CELL_SIZE*2);
+    for (int row = 1; row < rows; row++) {
+        SelectObject(hdc, (block != 0 && row % block == 0) ? hThickPen : hPen);
+        MoveToEx(hdc, 0, cellSize * row, NULL);
+        LineTo(hdc, cellSize * cols, cellSize * row);
+    }
+    SelectObject(hdc, hPen);
     
     // Draw X's and O's
-    for (int row = 0; row < 3; row++) {
-        for (int col = 0; col < 3; col++) {
-            if (board[row][col] == 1) {
+    for (int row = 0; row < rows; row++) {
+        for (int col = 0; col < cols; col++) {
+            if (GetCell(row, col) == 1) {
                 DrawX(hdc, row, col);
-            } else if (board[row][col] == 2) {
+            } else if (GetCell(row, col) == 2) {
                 DrawO(hdc, row, col);
             }
         }
@@ -144,6 +476,7 @@ void DrawBoard(HDC hdc, HWND hwnd) {
     
     SelectObject(hdc, hOldPen);
     DeleteObject(hPen);
+    DeleteObject(hThickPen);
     
     // Draw status text
     HFONT hFont = CreateFont(24, 0, 0, 0, FW_BOLD, FALSE, FALSE, FALSE, DEFAULT_CHARSET,
@@ -171,85 +504,151 @@ void DrawBoard(HDC hdc, HWND hwnd) {
     DrawText(hdc, _T("Player vs Player"), -1, &pvpRect, DT_CENTER | DT_VCENTER | DT_SINGLELINE);
     DrawText(hdc, _T("Player vs AI"), -1, &pvaiRect, DT_CENTER | DT_VCENTER | DT_SINGLELINE);
     
+    // Draw variant buttons
+    const TCHAR* variantNames[VARIANT_COUNT] = {_T("3x3 Classic"), _T("15x15 Gomoku"), _T("Ultimate"), _T("Qubic 4x4x4")};
+    int variantWidth = (BOARD_SIZE - 20) / VARIANT_COUNT;
+    for (int i = 0; i < VARIANT_COUNT; i++) {
+        RECT variantRect = {10 + i * variantWidth, BOARD_SIZE + 100, 10 + (i + 1) * variantWidth - 10, BOARD_SIZE + 140};
+        FillRect(hdc, &variantRect, i == currentVariant ? (HBRUSH)(COLOR_HIGHLIGHT+1) : (HBRUSH)(COLOR_BTNFACE+1));
+        DrawText(hdc, variantNames[i], -1, &variantRect, DT_CENTER | DT_VCENTER | DT_SINGLELINE);
+    }
+    
     SelectObject(hdc, hOldFont);
     DeleteObject(hFont);
 }
 
 void DrawX(HDC hdc, int row, int col) {
-    HPEN hPen = CreatePen(PS_SOLID, 6, RGB(255, 0, 0));
+    int cellSize = CellSize();
+    HPEN hPen = CreatePen(PS_SOLID, cellSize >= 100 ? 6 : 3, RGB(255, 0, 0));
     HPEN hOldPen = (HPEN)SelectObject(hdc, hPen);
     
-    int x = col * CELL_SIZE;
-    int y = row * CELL_SIZE;
-    int padding = CELL_SIZE / 4;
+    int x = col * cellSize;
+    int y = row * cellSize;
+    int padding = cellSize / 4;
     
     MoveToEx(hdc, x + padding, y + padding, NULL);
-    LineTo(hdc, x + CELL_SIZE - padding, y + CELL_SIZE - padding);
-    MoveToEx(hdc, x + CELL_SIZE - padding, y + padding, NULL);
-    LineTo(hdc, x + padding, y + CELL_SIZE - padding);
+    LineTo(hdc, x + cellSize - padding, y + cellSize - padding);
+    MoveToEx(hdc, x + cellSize - padding, y + padding, NULL);
+    LineTo(hdc, x + padding, y + cellSize - padding);
     
     SelectObject(hdc, hOldPen);
     DeleteObject(hPen);
 }
 
 void DrawO(HDC hdc, int row, int col) {
-    HPEN hPen = CreatePen(PS_SOLID, 6, RGB(0, 0, 255));
+    int cellSize = CellSize();
+    HPEN hPen = CreatePen(PS_SOLID, cellSize >= 100 ? 6 : 3, RGB(0, 0, 255));
     HPEN hOldPen = (HPEN)SelectObject(hdc, hPen);
     
-    int x = col * CELL_SIZE;
-    int y = row * CELL_SIZE;
-    int padding = CELL_SIZE / 4;
+    int x = col * cellSize;
+    int y = row * cellSize;
+    int padding = cellSize / 4;
     
-    Ellipse(hdc, x + padding, y + padding, x + CELL_SIZE - padding, y + CELL_SIZE - padding);
+    Ellipse(hdc, x + padding, y + padding, x + cellSize - padding, y + cellSize - padding);
     
     SelectObject(hdc, hOldPen);
     DeleteObject(hPen);
 }
 
+#endif
+
 void ResetGame() {
-    for (int i = 0; i < 3; i++) {
-        for (int j = 0; j < 3; j++) {
-            board[i][j] = 0;
-        }
+    board.x = 0;
+    board.o = 0;
+    if (currentVariant == VARIANT_GOMOKU) MnkNewGame(15, 15, 5);
+    if (currentVariant == VARIANT_ULTIMATE) {
+        UltimateNewGame(ultimateGame);
+        MctsReset(ultimateGame);
     }
+    if (currentVariant == VARIANT_QUBIC) QubicNewGame(qubicGame);
     currentPlayer = 1;
     gameOver = false;
 }
 
-int CheckWinner() {
-    // Check rows
-    for (int i = 0; i < 3; i++) {
-        if (board[i][0] != 0 && board[i][0] == board[i][1] && board[i][1] == board[i][2]) {
-            return board[i][0];
-        }
+int BoardRows() {
+    if (currentVariant == VARIANT_ULTIMATE) return 9;
+    if (currentVariant == VARIANT_QUBIC) return 8;
+    return currentVariant == VARIANT_GOMOKU ? mnkHeight : 3;
+}
+
+int BoardCols() {
+    if (currentVariant == VARIANT_ULTIMATE) return 9;
+    if (currentVariant == VARIANT_QUBIC) return 8;
+    return currentVariant == VARIANT_GOMOKU ? mnkWidth : 3;
+}
+
+// Ultimate move for a cell of the 9x9 grid
+static inline int UltimateMoveAt(int row, int col) {
+    return ((row / 3) * 3 + col / 3) * 9 + (row % 3) * 3 + col % 3;
+}
+
+// Qubic cell for a cell of the 8x8 grid: the four 4x4 layers in a 2x2 arrangement
+static inline int QubicCellAt(int row, int col) {
+    return ((row / 4) * 2 + col / 4) * 16 + (row % 4) * 4 + col % 4;
+}
+
+// Cells between thick grid lines, 0 for none
+int BlockSize() {
+    if (currentVariant == VARIANT_ULTIMATE) return 3;
+    return currentVariant == VARIANT_QUBIC ? 4 : 0;
+}
+
+bool CanPlay(int row, int col) {
+    if (currentVariant == VARIANT_ULTIMATE) return UltimateIsLegal(ultimateGame, UltimateMoveAt(row, col));
+    return GetCell(row, col) == 0;
+}
+
+int CellSize() {
+    return BOARD_SIZE / std::max(BoardRows(), BoardCols());
+}
+
+int GetCell(int row, int col) {
+    if (currentVariant == VARIANT_GOMOKU) return mnkCells[row * MNK_MAX + col];
+    if (currentVariant == VARIANT_ULTIMATE) {
+        int move = UltimateMoveAt(row, col);
+        if (ultimateGame.x[move / 9] & (1 << (move % 9))) return 1;
+        if (ultimateGame.o[move / 9] & (1 << (move % 9))) return 2;
+        return 0;
     }
-    
-    // Check columns
-    for (int j = 0; j < 3; j++) {
-        if (board[0][j] != 0 && board[0][j] == board[1][j] && board[1][j] == board[2][j]) {
-            return board[0][j];
-        }
+    if (currentVariant == VARIANT_QUBIC) {
+        unsigned long long bit = 1ULL << QubicCellAt(row, col);
+        return (qubicGame.x & bit) ? 1 : (qubicGame.o & bit) ? 2 : 0;
     }
-    
-    // Check diagonals
-    if (board[0][0] != 0 && board[0][0] == board[1][1] && board[1][1] == board[2][2]) {
-        return board[0][0];
+    unsigned short bit = 1 << (row * 3 + col);
+    if (board.x & bit) return 1;
+    if (board.o & bit) return 2;
+    return 0;
+}
+
+void SetCell(int row, int col, int player) {
+    if (currentVariant == VARIANT_GOMOKU) {
+        MnkPlace(row * MNK_MAX + col, player);
+        return;
     }
-    if (board[0][2] != 0 && board[0][2] == board[1][1] && board[1][1] == board[2][0]) {
-        return board[0][2];
+    if (currentVariant == VARIANT_ULTIMATE) {
+        UltimatePlay(UltimateMoveAt(row, col)); // Always the side to move
+        return;
     }
-    
-    // Check for draw
-    for (int i = 0; i < 3; i++) {
-        for (int j = 0; j < 3; j++) {
-            if (board[i][j] == 0) {
-                return 0; // Game continues
-            }
-        }
+    if (currentVariant == VARIANT_QUBIC) {
+        QubicApply(qubicGame, QubicCellAt(row, col));
+        return;
     }
-    return 3; // Draw
+    unsigned short bit = 1 << (row * 3 + col);
+    if (player == 1) board.x |= bit;
+    else board.o |= bit;
 }
 
+int CheckWinner() {
+    if (currentVariant == VARIANT_GOMOKU) {
+        if (mnkWinner != 0) return mnkWinner;
+        return mnkStones == mnkWidth * mnkHeight ? 3 : 0;
+    }
+    if (currentVariant == VARIANT_ULTIMATE) return ultimateGame.winner;
+    if (currentVariant == VARIANT_QUBIC) return qubicGame.winner;
+    return EvaluateBoard(board);
+}
+
+#ifndef TICTACTOE_HEADLESS
 void ShowWinnerMessage(HWND hwnd, int winner) {
     TCHAR message[50];
     if (winner == 3) {
@@ -259,59 +658,1482 @@ void ShowWinnerMessage(HWND hwnd, int winner) {
     }
     MessageBox(hwnd, message, _T("Game Over"), MB_OK);
 }
+#endif
 
 void AIMove() {
-    MoveScore move = Minimax(board, true);
-    board[move.row][move.col] = 2; // AI is O (2)
+    if (currentVariant == VARIANT_GOMOKU) {
+        MnkPlace(MnkSearch(2, mnkTimeLimitMs), 2); // Bounded by mnkTimeLimitMs
+        return;
+    }
+    if (currentVariant == VARIANT_ULTIMATE) {
+        int move = (ultimateThreads > 1)
+            ? MctsSearchParallel(ultimateGame, ultimateThreads, ultimateParallelMode, ultimateTimeLimitMs, ultimatePlayoutLimit)
+            : MctsSearch(ultimateTimeLimitMs, ultimatePlayoutLimit);
+        UltimatePlay(move);
+        return;
+    }
+    if (currentVariant == VARIANT_QUBIC) {
+        QubicApply(qubicGame, QubicBestMove(qubicGame));
+        return;
+    }
+    
+    // Perfect play read from the solved table, no search per move
+    int square = solvedTable.entry[EncodeBoard(board)].move;
+    SetCell(square / 3, square % 3, 2); // AI is O (2)
+}
+
+// Base-3 index of the board into solvedTable
+int EncodeBoard(BitBoard board) {
+    int index = 0;
+    for (int square = 8; square >= 0; square--) {
+        index *= 3;
+        if (board.x & (1 << square)) index += 1;
+        else if (board.o & (1 << square)) index += 2;
+    }
+    return index;
 }
 
-MoveScore Minimax(int board[3][3], bool isMaximizing) {
+// The board is passed by value, so making a move is one OR and there is nothing to undo
+MoveScore Minimax(BitBoard board, bool isMaximizing) {
+    searchNodes++;
+    
     // Base cases
     int winner = EvaluateBoard(board);
     if (winner == 1) return {-1, -1, -10};
     if (winner == 2) return {-1, -1, 10};
     if (winner == 3) return {-1, -1, 0};
     
-    std::vector<std::pair<int, int>> availableMoves;
-    for (int i = 0; i < 3; i++) {
-        for (int j = 0; j < 3; j++) {
-            if (board[i][j] == 0) {
-                availableMoves.emplace_back(i, j);
-            }
-        }
-    }
+    // Available moves are the empty bits, taken lowest first (same row-major order as a scan)
+    unsigned int empty = FULL_BOARD & ~(board.x | board.o);
     
     if (isMaximizing) {
         MoveScore bestMove = {-1, -1, -1000};
-        for (const auto& move : availableMoves) {
-            board[move.first][move.second] = 2;
-            int score = Minimax(board, false).score;
-            board[move.first][move.second] = 0;
+        for (; empty != 0; empty &= empty - 1) {
+            int square = LowestBit(empty);
+            BitBoard next = {board.x, (unsigned short)(board.o | (1 << square))};
+            int score = Minimax(next, false).score;
             
             if (score > bestMove.score) {
-                bestMove = {move.first, move.second, score};
+                bestMove = {square / 3, square % 3, score};
             }
         }
         return bestMove;
     } else {
         MoveScore bestMove = {-1, -1, 1000};
-        for (const auto& move : availableMoves) {
-            board[move.first][move.second] = 1;
-            int score = Minimax(board, true).score;
-            board[move.first][move.second] = 0;
+        for (; empty != 0; empty &= empty - 1) {
+            int square = LowestBit(empty);
+            BitBoard next = {(unsigned short)(board.x | (1 << square)), board.o};
+            int score = Minimax(next, true).score;
             
             if (score < bestMove.score) {
-                bestMove = {move.first, move.second, score};
+                bestMove = {square / 3, square % 3, score};
             }
         }
         return bestMove;
     }
 }
 
-int EvaluateBoard(int board[3][3]) {
-    return CheckWinner(); // Reuse the same logic
+// Index of the lowest set bit, mask must be non-zero
+int LowestBit(unsigned int mask) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (int)index;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+// Alpha-beta negamax for n x n boards, n in a row (n = 3 or 4)
+// Positions are two masks like BitBoard, widened to 16 cells. The transposition table is
+// keyed on the canonical form of the board: the smallest of its 8 rotations and
+// reflections, so symmetric positions share one entry. Scores are GRID_WIN - stones for
+// a win, so quicker wins and slower losses are preferred.
+void GridNewGame(int size) {
+    gridSize = size;
+    gridFull = (1u << (size * size)) - 1;
+    
+    // Rows, columns, two diagonals
+    gridLineCount = 0;
+    unsigned int diagonal = 0, antiDiagonal = 0;
+    for (int i = 0; i < size; i++) {
+        unsigned int row = 0, col = 0;
+        for (int j = 0; j < size; j++) {
+            row |= 1u << (i * size + j);
+            col |= 1u << (j * size + i);
+        }
+        gridLines[gridLineCount++] = row;
+        gridLines[gridLineCount++] = col;
+        diagonal |= 1u << (i * size + i);
+        antiDiagonal |= 1u << (i * size + size - 1 - i);
+    }
+    gridLines[gridLineCount++] = diagonal;
+    gridLines[gridLineCount++] = antiDiagonal;
+    
+    // Square each symmetry sends a square to: 4 rotations, each optionally mirrored
+    for (int t = 0; t < 8; t++) {
+        for (int r = 0; r < size; r++) {
+            for (int c = 0; c < size; c++) {
+                int row = r, col = c;
+                for (int turn = 0; turn < (t & 3); turn++) {
+                    int rotated = col;
+                    col = size - 1 - row;
+                    row = rotated;
+                }
+                if (t & 4) col = size - 1 - col;
+                gridSymmetry[t][r * size + c] = (unsigned char)(row * size + col);
+            }
+        }
+    }
+    
+    // Move order: central squares first, then by how many lines pass through
+    int weight[GRID_MAX * GRID_MAX];
+    for (int square = 0; square < size * size; square++) {
+        weight[square] = 0;
+        for (int i = 0; i < gridLineCount; i++) {
+            if (gridLines[i] & (1u << square)) weight[square]++;
+        }
+        gridMoveOrder[square] = square;
+    }
+    std::stable_sort(gridMoveOrder, gridMoveOrder + size * size,
+                     [&weight](int a, int b) { return weight[a] > weight[b]; });
+    
+    memset(gridTT, 0, sizeof(gridTT));
+}
+
+static inline unsigned int GridPermute(unsigned int mask, int t) {
+    unsigned int result = 0;
+    for (; mask != 0; mask &= mask - 1) result |= 1u << gridSymmetry[t][LowestBit(mask)];
+    return result;
+}
+
+// X and O masks packed into one key, reduced to the smallest symmetric image if enabled
+static inline unsigned int GridKey(unsigned int x, unsigned int o) {
+    unsigned int key = x | (o << 16);
+    if (!gridUseSymmetry) return key;
+    for (int t = 1; t < 8; t++) {
+        unsigned int image = GridPermute(x, t) | (GridPermute(o, t) << 16);
+        if (image < key) key = image;
+    }
+    return key;
+}
+
+static inline bool GridHasLine(unsigned int mask) {
+    for (int i = 0; i < gridLineCount; i++) {
+        if ((mask & gridLines[i]) == gridLines[i]) return true;
+    }
+    return false;
+}
+
+// Value for the side to move ('own' stones; 'other' just moved), 'stones' on the board
+int GridNegamax(unsigned int own, unsigned int other, int stones, int alpha, int beta) {
+    gridNodes++;
+    if (GridHasLine(other)) return -(GRID_WIN - stones);
+    if ((own | other) == gridFull) return 0;
+    
+    // X has moved when the stone count is odd, so 'own' is O then
+    unsigned int x = (stones & 1) ? other : own;
+    unsigned int o = (stones & 1) ? own : other;
+    GridTTEntry* entry = 0;
+    unsigned int key = 0;
+    if (gridUseTT) {
+        key = GridKey(x, o);
+        entry = &gridTT[(key * 2654435761u) >> (32 - GRID_TT_BITS)];
+        if (entry->flag != GRID_TT_EMPTY && entry->key == key) {
+            gridTTHits++;
+            int score = entry->score;
+            if (entry->flag == GRID_TT_EXACT) return score;
+            if (entry->flag == GRID_TT_LOWER && score >= beta) return score;
+            if (entry->flag == GRID_TT_UPPER && score <= alpha) return score;
+        }
+    }
+    
+    int originalAlpha = alpha;
+    int best = -GRID_WIN;
+    for (int i = 0; i < gridSize * gridSize; i++) {
+        unsigned int bit = 1u << gridMoveOrder[i];
+        if ((own | other) & bit) continue;
+        int score = -GridNegamax(other, own | bit, stones + 1, -beta, -alpha);
+        if (score > best) best = score;
+        if (score > alpha) alpha = score;
+        if (alpha >= beta) break;
+    }
+    
+    if (entry) {
+        entry->key = key;
+        entry->score = (signed char)best;
+        entry->flag = (best <= originalAlpha) ? GRID_TT_UPPER : (best >= beta) ? GRID_TT_LOWER : GRID_TT_EXACT;
+    }
+    return best;
+}
+
+// Solves the empty board set up by GridNewGame(); returns its value for X
+int GridSolve(bool useTT, bool useSymmetry) {
+    gridUseTT = useTT;
+    gridUseSymmetry = useSymmetry;
+    gridNodes = 0;
+    gridTTHits = 0;
+    return GridNegamax(0, 0, 0, -GRID_WIN, GRID_WIN);
+}
+
+// Ultimate tic-tac-toe: nine 3x3 boards, each move sends the opponent to the board
+// matching the cell just played. Moves are sub * 9 + cell.
+void UltimateNewGame(UltimateState& state) {
+    memset(&state, 0, sizeof(state));
+    state.forced = -1;
+    state.player = 1;
+}
+
+// Legal moves; returns the count
+int UltimateMoves(const UltimateState& state, unsigned char moves[]) {
+    int count = 0;
+    if (state.winner != 0) return 0;
+    unsigned short decided = state.wonX | state.wonO | state.drawn;
+    for (int sub = 0; sub < 9; sub++) {
+        if (state.forced >= 0 && sub != state.forced) continue;
+        if (decided & (1 << sub)) continue;
+        unsigned int empty = FULL_BOARD & ~(state.x[sub] | state.o[sub]);
+        for (; empty != 0; empty &= empty - 1) moves[count++] = (unsigned char)(sub * 9 + LowestBit(empty));
+    }
+    return count;
+}
+
+bool UltimateIsLegal(const UltimateState& state, int move) {
+    int sub = move / 9, cell = move % 9;
+    if (state.winner != 0) return false;
+    if (state.forced >= 0 && sub != state.forced) return false;
+    if ((state.wonX | state.wonO | state.drawn) & (1 << sub)) return false;
+    return ((state.x[sub] | state.o[sub]) & (1 << cell)) == 0;
+}
+
+void UltimateApply(UltimateState& state, int move) {
+    int sub = move / 9, cell = move % 9;
+    if (state.player == 1) state.x[sub] |= 1 << cell;
+    else state.o[sub] |= 1 << cell;
+    
+    // Settle the small board, then the big one
+    BitBoard small = {state.x[sub], state.o[sub]};
+    int result = EvaluateBoard(small);
+    if (result == 1) state.wonX |= 1 << sub;
+    else if (result == 2) state.wonO |= 1 << sub;
+    else if (result == 3) state.drawn |= 1 << sub;
+    if (result != 0) {
+        for (int i = 0; i < 8; i++) {
+            if ((state.wonX & WIN_MASKS[i]) == WIN_MASKS[i]) state.winner = 1;
+            if ((state.wonO & WIN_MASKS[i]) == WIN_MASKS[i]) state.winner = 2;
+        }
+        if (state.winner == 0 && (state.wonX | state.wonO | state.drawn) == FULL_BOARD) state.winner = 3;
+    }
+    
+    unsigned short decided = state.wonX | state.wonO | state.drawn;
+    state.forced = (decided & (1 << cell)) ? -1 : (signed char)cell;
+    state.player = 3 - state.player;
+}
+
+// Plays a move in the window's game and keeps the search tree in step
+void UltimatePlay(int move) {
+    UltimateApply(ultimateGame, move);
+    MctsAdvance(move);
+}
+
+static inline unsigned int UltimateRandom(unsigned int range) {
+    ultimateRng ^= ultimateRng << 13;
+    ultimateRng ^= ultimateRng >> 7;
+    ultimateRng ^= ultimateRng << 17;
+    return (unsigned int)((ultimateRng >> 32) * range >> 32);
+}
+
+// Uniformly random moves to the end of the game; returns the winner (3 = draw)
+int UltimatePlayout(UltimateState state) {
+    unsigned char moves[81];
+    while (state.winner == 0) {
+        int count = UltimateMoves(state, moves);
+        UltimateApply(state, moves[UltimateRandom(count)]);
+    }
+    return state.winner;
+}
+
+// MCTS tree
+// Nodes live in a fixed pool and a node's children are one contiguous block, so the
+// tree needs no pointers and no per-node allocation. After each move the kept subtree
+// is copied breadth-first into the other pool, which frees everything else.
+void MctsReset(const UltimateState& state) {
+    mctsRootState = state;
+    mctsPool = mctsPools[0];
+    mctsUsed = 1;
+    mctsPool[0].firstChild = -1;
+    mctsPool[0].childCount = 0;
+    mctsPool[0].visits = 0;
+    mctsPool[0].wins = 0;
+    mctsPool[0].move = 0;
+}
+
+// Moves the root to the child reached by 'move', keeping its statistics
+void MctsAdvance(int move) {
+    MctsNode* from = mctsPool;
+    int root = -1;
+    if (from[0].firstChild >= 0) {
+        for (int i = 0; i < from[0].childCount; i++) {
+            if (from[from[0].firstChild + i].move == move) root = from[0].firstChild + i;
+        }
+    }
+    UltimateApply(mctsRootState, move);
+    if (root < 0) {
+        MctsReset(mctsRootState);
+        return;
+    }
+    
+    MctsNode* to = (from == mctsPools[0]) ? mctsPools[1] : mctsPools[0];
+    to[0] = from[root];
+    int used = 1;
+    for (int next = 0; next < used; next++) {
+        MctsNode& node = to[next];
+        if (node.firstChild < 0) continue;
+        int first = used;
+        for (int i = 0; i < node.childCount; i++) to[used++] = from[node.firstChild + i];
+        node.firstChild = first;
+    }
+    mctsPool = to;
+    mctsUsed = used;
+}
+
+// Runs playouts on one tree until the budget is spent; returns the number of playouts.
+// The root (pool[0]) must exist; 'used' grows as nodes are expanded, up to 'capacity'.
+unsigned long long MctsGrow(MctsNode* pool, int& used, int capacity, const UltimateState& rootState,
+                            int timeLimitMs, int playoutLimit) {
+    std::chrono::steady_clock::time_point deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(timeLimitMs);
+    unsigned long long playouts = 0;
+    int path[82];
+    unsigned char moves[81];
+    while (playoutLimit <= 0 || playouts < (unsigned long long)playoutLimit) {
+        if ((playouts & 255) == 0 && timeLimitMs > 0 && std::chrono::steady_clock::now() >= deadline) break;
+        
+        // Selection: UCT down to a leaf
+        UltimateState state = rootState;
+        int node = 0, depth = 0;
+        path[depth++] = node;
+        while (pool[node].firstChild >= 0 && pool[node].childCount > 0) {
+            const MctsNode& parent = pool[node];
+            double logVisits = log((double)parent.visits + 1);
+            double bestValue = -1;
+            int best = parent.firstChild;
+            for (int i = 0; i < parent.childCount; i++) {
+                const MctsNode& child = pool[parent.firstChild + i];
+                if (child.visits == 0) {
+                    best = parent.firstChild + i;
+                    break;
+                }
+                double value = child.wins / child.visits + mctsExploration * sqrt(logVisits / child.visits);
+                if (value > bestValue) {
+                    bestValue = value;
+                    best = parent.firstChild + i;
+                }
+            }
+            node = best;
+            UltimateApply(state, pool[node].move);
+            path[depth++] = node;
+        }
+        
+        // Expansion: all children at once, then play out from the first
+        if (state.winner == 0 && (node == 0 || pool[node].visits > 0)) {
+            int count = UltimateMoves(state, moves);
+            if (used + count <= capacity) {
+                MctsNode& leaf = pool[node];
+                leaf.firstChild = used;
+                leaf.childCount = (unsigned char)count;
+                for (int i = 0; i < count; i++) {
+                    MctsNode& child = pool[used++];
+                    child.firstChild = -1;
+                    child.childCount = 0;
+                    child.visits = 0;
+                    child.wins = 0;
+                    child.move = moves[i];
+                }
+                node = leaf.firstChild;
+                UltimateApply(state, pool[node].move);
+                path[depth++] = node;
+            }
+        }
+        
+        // Simulation and backpropagation. A node's wins count for the player who made its
+        // move: the side to move at the root for odd depths, the other side for even ones.
+        int winner = UltimatePlayout(state);
+        for (int i = 0; i < depth; i++) {
+            MctsNode& step = pool[path[i]];
+            int mover = (i & 1) ? rootState.player : 3 - rootState.player;
+            step.visits++;
+            if (winner == mover) step.wins += 1;
+            else if (winner == 3) step.wins += 0.5f;
+        }
+        playouts++;
+    }
+    return playouts;
+}
+
+// Runs playouts from the root until the budget is spent; returns the most visited move
+int MctsSearch(int timeLimitMs, int playoutLimit) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    mctsReused = mctsPool[0].visits;
+    mctsPlayouts = MctsGrow(mctsPool, mctsUsed, MCTS_POOL_SIZE, mctsRootState, timeLimitMs, playoutLimit);
+    mctsSearchMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    
+    unsigned char moves[81];
+    const MctsNode& root = mctsPool[0];
+    if (root.firstChild < 0) {
+        UltimateMoves(mctsRootState, moves);
+        return moves[0];
+    }
+    int best = root.firstChild;
+    for (int i = 1; i < root.childCount; i++) {
+        if (mctsPool[root.firstChild + i].visits > mctsPool[best].visits) best = root.firstChild + i;
+    }
+    return mctsPool[best].move;
+}
+
+// Root parallelization: every thread grows a private tree, the root children's visits
+// are summed per move
+static void MctsRootWorker(const UltimateState& rootState, int timeLimitMs, int playoutLimit, int seed,
+                           unsigned int visits[81], unsigned long long& playouts) {
+    ultimateRng = 0x2545F4914F6CDD1DULL ^ (0x9E3779B97F4A7C15ULL * (unsigned long long)(seed + 1));
+    std::vector<MctsNode> pool(MCTS_THREAD_POOL_SIZE);
+    pool[0].firstChild = -1;
+    pool[0].childCount = 0;
+    pool[0].visits = 0;
+    pool[0].wins = 0;
+    pool[0].move = 0;
+    int used = 1;
+    playouts = MctsGrow(pool.data(), used, MCTS_THREAD_POOL_SIZE, rootState, timeLimitMs, playoutLimit);
+    
+    const MctsNode& root = pool[0];
+    for (int i = 0; root.firstChild >= 0 && i < root.childCount; i++) {
+        visits[pool[root.firstChild + i].move] += pool[root.firstChild + i].visits;
+    }
+}
+
+// Tree parallelization: all threads descend the same tree. Each node passed on the way
+// down takes MCTS_VIRTUAL_LOSS extra visits with no score, which steers the other
+// threads elsewhere until the playout result replaces them.
+static void MctsTreeWorker(MctsSharedNode* pool, std::atomic<int>& used, const UltimateState& rootState,
+                           int timeLimitMs, int playoutLimit, std::atomic<long long>& playoutsLeft,
+                           int seed, unsigned long long& playouts) {
+    ultimateRng = 0x2545F4914F6CDD1DULL ^ (0x9E3779B97F4A7C15ULL * (unsigned long long)(seed + 1));
+    std::chrono::steady_clock::time_point deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(timeLimitMs);
+    int path[82];
+    unsigned char moves[81];
+    playouts = 0;
+    
+    for (;;) {
+        if (playoutLimit > 0 && playoutsLeft.fetch_sub(1) <= 0) break;
+        if ((playouts & 255) == 0 && timeLimitMs > 0 && std::chrono::steady_clock::now() >= deadline) break;
+        
+        UltimateState state = rootState;
+        int node = 0, depth = 0;
+        path[depth++] = node;
+        pool[node].visits.fetch_add(MCTS_VIRTUAL_LOSS);
+        for (;;) {
+            int first = pool[node].firstChild.load(std::memory_order_acquire);
+            if (first < 0) break;
+            int childCount = pool[node].childCount;
+            double logVisits = log((double)pool[node].visits.load(std::memory_order_relaxed) + 1);
+            double bestValue = -1;
+            int best = first;
+            for (int i = 0; i < childCount; i++) {
+                const MctsSharedNode& child = pool[first + i];
+                int visits = child.visits.load(std::memory_order_relaxed);
+                if (visits == 0) {
+                    best = first + i;
+                    break;
+                }
+                double value = child.score.load(std::memory_order_relaxed) * 0.5 / visits +
+                               mctsExploration * sqrt(logVisits / visits);
+                if (value > bestValue) {
+                    bestValue = value;
+                    best = first + i;
+                }
+            }
+            node = best;
+            pool[node].visits.fetch_add(MCTS_VIRTUAL_LOSS);
+            UltimateApply(state, pool[node].move);
+            path[depth++] = node;
+        }
+        
+        // Expansion: the thread that flips firstChild from -1 to -2 builds the children,
+        // the others play out from the leaf meanwhile
+        int expected = -1;
+        if (state.winner == 0 && (node == 0 || pool[node].visits.load() > MCTS_VIRTUAL_LOSS) &&
+            pool[node].firstChild.compare_exchange_strong(expected, -2)) {
+            int count = UltimateMoves(state, moves);
+            int first = used.fetch_add(count);
+            if (first + count <= MCTS_SHARED_POOL_SIZE) {
+                for (int i = 0; i < count; i++) {
+                    MctsSharedNode& child = pool[first + i];
+                    child.firstChild.store(-1, std::memory_order_relaxed);
+                    child.visits.store(0, std::memory_order_relaxed);
+                    child.score.store(0, std::memory_order_relaxed);
+                    child.move = moves[i];
+                    child.childCount = 0;
+                }
+                pool[node].childCount = (unsigned char)count;
+                pool[node].firstChild.store(first, std::memory_order_release);
+                
+                node = first;
+                pool[node].visits.fetch_add(MCTS_VIRTUAL_LOSS);
+                UltimateApply(state, pool[node].move);
+                path[depth++] = node;
+            } else {
+                pool[node].firstChild.store(-1, std::memory_order_release); // Pool full, stay a leaf
+            }
+        }
+        
+        // Replace each virtual loss with the real visit and result
+        int winner = UltimatePlayout(state);
+        for (int i = 0; i < depth; i++) {
+            MctsSharedNode& step = pool[path[i]];
+            int mover = (i & 1) ? rootState.player : 3 - rootState.player;
+            step.visits.fetch_add(1 - MCTS_VIRTUAL_LOSS);
+            if (winner == mover) step.score.fetch_add(2);
+            else if (winner == 3) step.score.fetch_add(1);
+        }
+        playouts++;
+    }
 }
 
+// Searches 'rootState' with 'threads' threads; returns the most visited move. Playout
+// count and time go to mctsPlayouts / mctsSearchMs like MctsSearch(). No tree is kept
+// between moves.
+int MctsSearchParallel(const UltimateState& rootState, int threads, MctsParallelMode mode,
+                       int timeLimitMs, int playoutLimit) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    std::vector<unsigned long long> playouts(threads, 0);
+    unsigned int visits[81] = {0};
+    
+    if (mode == MCTS_ROOT_PARALLEL) {
+        std::vector<unsigned int> threadVisits(threads * 81, 0);
+        int share = playoutLimit > 0 ? (playoutLimit + threads - 1) / threads : 0;
+        for (int t = 0; t < threads; t++) {
+            workers.emplace_back(MctsRootWorker, std::cref(rootState), timeLimitMs, share, t,
+                                 &threadVisits[t * 81], std::ref(playouts[t]));
+        }
+        for (std::thread& worker : workers) worker.join();
+        for (int t = 0; t < threads; t++)
+            for (int move = 0; move < 81; move++) visits[move] += threadVisits[t * 81 + move];
+    } else {
+        std::unique_ptr<MctsSharedNode[]> pool(new MctsSharedNode[MCTS_SHARED_POOL_SIZE]);
+        pool[0].firstChild.store(-1);
+        pool[0].visits.store(0);
+        pool[0].score.store(0);
+        pool[0].move = 0;
+        pool[0].childCount = 0;
+        std::atomic<int> used(1);
+        std::atomic<long long> playoutsLeft(playoutLimit);
+        for (int t = 0; t < threads; t++) {
+            workers.emplace_back(MctsTreeWorker, pool.get(), std::ref(used), std::cref(rootState), timeLimitMs,
+                                 playoutLimit, std::ref(playoutsLeft), t, std::ref(playouts[t]));
+        }
+        for (std::thread& worker : workers) worker.join();
+        int first = pool[0].firstChild.load();
+        for (int i = 0; first >= 0 && i < pool[0].childCount; i++) {
+            visits[pool[first + i].move] += pool[first + i].visits.load();
+        }
+    }
+    
+    mctsPlayouts = 0;
+    for (int t = 0; t < threads; t++) mctsPlayouts += playouts[t];
+    mctsReused = 0;
+    mctsSearchMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    
+    unsigned char moves[81];
+    int count = UltimateMoves(rootState, moves);
+    int best = moves[0];
+    for (int i = 1; i < count; i++) {
+        if (visits[moves[i]] > visits[best]) best = moves[i];
+    }
+    return best;
+}
+
+// m,n,k-game engine: k in a row on a width x height board (15,15,5 is gomoku)
+// Every k-long window of cells keeps its X and O stone counts, so placing a stone only
+// touches the windows through that cell: the threat score, the win test and the move
+// ordering below all come from those counts.
+void MnkNewGame(int width, int height, int k) {
+    mnkWidth = width;
+    mnkHeight = height;
+    mnkK = k;
+    mnkWindowCount = 0;
+    mnkStones = 0;
+    mnkWinner = 0;
+    mnkThreatScore = 0;
+    mnkHash = 0;
+    memset(mnkCells, 0, sizeof(mnkCells));
+    memset(mnkNear, 0, sizeof(mnkNear));
+    memset(mnkCellWindowCount, 0, sizeof(mnkCellWindowCount));
+    
+    // Windows along rows, columns and both diagonals
+    const int directions[4][2] = {{1, 0}, {0, 1}, {1, 1}, {1, -1}};
+    for (int d = 0; d < 4; d++) {
+        int dx = directions[d][0], dy = directions[d][1];
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                int endX = x + dx * (k - 1), endY = y + dy * (k - 1);
+                if (endX < 0 || endX >= width || endY < 0 || endY >= height) continue;
+                int window = mnkWindowCount++;
+                mnkWindowStones[window][0] = 0;
+                mnkWindowStones[window][1] = 0;
+                for (int i = 0; i < k; i++) {
+                    int cell = (y + dy * i) * MNK_MAX + (x + dx * i);
+                    mnkCellWindows[cell][mnkCellWindowCount[cell]++] = (short)window;
+                }
+            }
+        }
+    }
+    
+    // Zobrist keys, fixed seed so runs are repeatable
+    unsigned long long seed = 0x9E3779B97F4A7C15ULL;
+    for (int cell = 0; cell < MNK_MAX * MNK_MAX; cell++) {
+        for (int player = 0; player < 2; player++) {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            mnkZobrist[cell][player] = seed;
+        }
+    }
+    mnkSearcher.Clear();
+}
+
+// Threat value of a window holding 'count' stones of one side and none of the other
+static inline int MnkWindowValue(int count) {
+    return count == 0 ? 0 : 1 << (3 * count);
+}
+
+void MnkPlace(int cell, int player) {
+    int me = player - 1;
+    mnkCells[cell] = (signed char)player;
+    mnkStones++;
+    mnkHash ^= mnkZobrist[cell][me];
+    
+    for (int i = 0; i < mnkCellWindowCount[cell]; i++) {
+        unsigned char* stones = mnkWindowStones[mnkCellWindows[cell][i]];
+        int sign = (player == 1) ? 1 : -1;
+        // Remove the window's old contribution, add the new one
+        if (stones[1 - me] == 0) {
+            mnkThreatScore += sign * (MnkWindowValue(stones[me] + 1) - MnkWindowValue(stones[me]));
+        } else if (stones[me] == 0) {
+            mnkThreatScore += sign * MnkWindowValue(stones[1 - me]); // Opponent's window is dead now
+        }
+        if (++stones[me] == mnkK) mnkWinner = player;
+    }
+    
+    int x = cell % MNK_MAX, y = cell / MNK_MAX;
+    for (int ny = std::max(0, y - 2); ny <= std::min(mnkHeight - 1, y + 2); ny++)
+        for (int nx = std::max(0, x - 2); nx <= std::min(mnkWidth - 1, x + 2); nx++)
+            mnkNear[ny * MNK_MAX + nx]++;
+}
+
+void MnkUndo(int cell) {
+    int player = mnkCells[cell];
+    int me = player - 1;
+    int sign = (player == 1) ? 1 : -1;
+    mnkWinner = 0; // Play stops at the first win, so no earlier one to restore
+    
+    for (int i = 0; i < mnkCellWindowCount[cell]; i++) {
+        unsigned char* stones = mnkWindowStones[mnkCellWindows[cell][i]];
+        --stones[me];
+        if (stones[1 - me] == 0) {
+            mnkThreatScore -= sign * (MnkWindowValue(stones[me] + 1) - MnkWindowValue(stones[me]));
+        } else if (stones[me] == 0) {
+            mnkThreatScore -= sign * MnkWindowValue(stones[1 - me]);
+        }
+    }
+    
+    int x = cell % MNK_MAX, y = cell / MNK_MAX;
+    for (int ny = std::max(0, y - 2); ny <= std::min(mnkHeight - 1, y + 2); ny++)
+        for (int nx = std::max(0, x - 2); nx <= std::min(mnkWidth - 1, x + 2); nx++)
+            mnkNear[ny * MNK_MAX + nx]--;
+    
+    mnkHash ^= mnkZobrist[cell][me];
+    mnkStones--;
+    mnkCells[cell] = 0;
+}
+
+// Candidate moves for 'player', best first. Threat-space pruning: a winning move is
+// played alone, an opponent's k-1 threat must be blocked, otherwise only the
+// mnkBranchLimit cells with the largest threat gain are searched. The order is a function
+// of the position, so the searcher's table can keep the best move's index.
+int MnkGenerateMoves(int player, int moves[]) {
+    int me = player - 1;
+    int scores[MNK_MAX * MNK_MAX];
+    int count = 0;
+    int blocks = 0;
+    
+    if (mnkStones == 0) {
+        moves[0] = (mnkHeight / 2) * MNK_MAX + mnkWidth / 2;
+        return 1;
+    }
+    
+    for (int y = 0; y < mnkHeight; y++) {
+        for (int x = 0; x < mnkWidth; x++) {
+            int cell = y * MNK_MAX + x;
+            if (mnkCells[cell] != 0 || mnkNear[cell] == 0) continue;
+            
+            int score = 0;
+            bool block = false;
+            for (int i = 0; i < mnkCellWindowCount[cell]; i++) {
+                const unsigned char* stones = mnkWindowStones[mnkCellWindows[cell][i]];
+                int own = stones[me], opp = stones[1 - me];
+                if (opp == 0) {
+                    if (own == mnkK - 1) {
+                        moves[0] = cell; // Completes k in a row
+                        return 1;
+                    }
+                    score += MnkWindowValue(own + 1) - MnkWindowValue(own);
+                }
+                if (own == 0) {
+                    if (opp == mnkK - 1) block = true;
+                    score += MnkWindowValue(opp); // Spoils the opponent's window
+                }
+            }
+            
+            // Blocking cells go to the front; once one exists everything else is dropped
+            if (block) {
+                if (blocks == 0) count = 0;
+                moves[count] = cell;
+                scores[count++] = score;
+                blocks++;
+            } else if (blocks == 0) {
+                moves[count] = cell;
+                scores[count++] = score;
+            }
+        }
+    }
+    
+    // Insertion sort, best threat gain first
+    for (int i = 1; i < count; i++) {
+        int move = moves[i], score = scores[i], j = i - 1;
+        while (j >= 0 && scores[j] < score) {
+            moves[j + 1] = moves[j];
+            scores[j + 1] = scores[j];
+            j--;
+        }
+        moves[j + 1] = move;
+        scores[j + 1] = score;
+    }
+    if (blocks == 0 && count > mnkBranchLimit) count = mnkBranchLimit;
+    return count;
+}
+
+// Iterative deepening in mnkSearcher until the time limit; returns the best move of the
+// last completed depth (cell = row * MNK_MAX + col)
+int MnkSearch(int player, int timeLimitMs) {
+    mnkNodes = 0;
+    mnkDepthReached = 0;
+    mnkBestScore = 0;
+    
+    int moves[MNK_MAX * MNK_MAX];
+    int moveCount = MnkGenerateMoves(player, moves);
+    if (moveCount == 1) return moves[0]; // Forced (win, block or opening move)
+    
+    MnkGame game;
+    game.player = player;
+    GameSearcher<MnkGame>::Result result = mnkSearcher.Search(game, mnkWidth * mnkHeight - mnkStones, timeLimitMs);
+    mnkNodes = result.nodes;
+    mnkDepthReached = result.depth;
+    mnkBestScore = result.score;
+    return result.hasMove ? result.move : moves[0];
+}
+
+// Qubic: 4x4x4 tic-tac-toe, four in a row along any of the 76 lines of the cube
+// Cell = z * 16 + y * 4 + x, one bit per cell in a 64-bit mask per player.
+static inline int Popcount64(unsigned long long mask) {
+#ifdef _MSC_VER
+    return (int)__popcnt64(mask);
+#else
+    return __builtin_popcountll(mask);
+#endif
+}
+
+static inline int LowestSetCell(unsigned long long mask) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, mask);
+    return (int)index;
+#else
+    return __builtin_ctzll(mask);
+#endif
+}
+
+// Builds the 76 line masks and the lines through every cell (once)
+void QubicInitLines() {
+    if (qubicLineCount != 0) return;
+    for (int dz = -1; dz <= 1; dz++) {
+        for (int dy = -1; dy <= 1; dy++) {
+            for (int dx = -1; dx <= 1; dx++) {
+                // One direction of each opposite pair
+                int code = dz * 9 + dy * 3 + dx;
+                if (code <= 0) continue;
+                for (int cell = 0; cell < 64; cell++) {
+                    int x = cell % 4, y = (cell / 4) % 4, z = cell / 16;
+                    // A line starts where stepping back leaves the cube and 3 steps ahead stay inside
+                    bool startsHere = (unsigned)(x - dx) >= 4 || (unsigned)(y - dy) >= 4 || (unsigned)(z - dz) >= 4;
+                    bool fits = (unsigned)(x + 3 * dx) < 4 && (unsigned)(y + 3 * dy) < 4 && (unsigned)(z + 3 * dz) < 4;
+                    if (!startsHere || !fits) continue;
+                    unsigned long long line = 0;
+                    for (int i = 0; i < 4; i++) line |= 1ULL << ((z + i * dz) * 16 + (y + i * dy) * 4 + (x + i * dx));
+                    qubicLines[qubicLineCount++] = line;
+                }
+            }
+        }
+    }
+    for (int cell = 0; cell < 64; cell++) {
+        qubicCellLineCount[cell] = 0;
+        for (int i = 0; i < qubicLineCount; i++) {
+            if (qubicLines[i] & (1ULL << cell)) qubicCellLines[cell][qubicCellLineCount[cell]++] = (unsigned char)i;
+        }
+    }
+}
+
+void QubicNewGame(QubicState& state) {
+    QubicInitLines();
+    state.x = 0;
+    state.o = 0;
+    state.player = 1;
+    state.winner = 0;
+}
+
+void QubicApply(QubicState& state, int cell) {
+    unsigned long long& own = (state.player == 1) ? state.x : state.o;
+    own |= 1ULL << cell;
+    for (int i = 0; i < qubicCellLineCount[cell]; i++) {
+        unsigned long long line = qubicLines[qubicCellLines[cell][i]];
+        if ((own & line) == line) state.winner = state.player;
+    }
+    if (state.winner == 0 && (state.x | state.o) == ~0ULL) state.winner = 3;
+    state.player = 3 - state.player;
+}
+
+// Threat counting. Both scans are one branch-free pass over the 76 masks (an OR
+// reduction of popcount compares), which compilers vectorize with wide popcount.
+
+// Empty cells that complete a line for 'own' right away
+unsigned long long QubicWinningCells(unsigned long long own, unsigned long long opp) {
+    unsigned long long cells = 0;
+    for (int i = 0; i < QUBIC_LINES; i++) {
+        unsigned long long line = qubicLines[i];
+        unsigned long long live = 0ULL - (unsigned long long)(((opp & line) == 0) & (Popcount64(own & line) == 3));
+        cells |= line & ~own & live;
+    }
+    return cells;
+}
+
+// Empty cells that give 'own' a line of three with the fourth cell free, i.e. make a threat
+unsigned long long QubicThreatCells(unsigned long long own, unsigned long long opp) {
+    unsigned long long cells = 0;
+    for (int i = 0; i < QUBIC_LINES; i++) {
+        unsigned long long line = qubicLines[i];
+        unsigned long long live = 0ULL - (unsigned long long)(((opp & line) == 0) & (Popcount64(own & line) == 2));
+        cells |= line & ~own & live;
+    }
+    return cells;
+}
+
+// Proof-number search
+// The solver asks whether the side to move (the attacker) wins by continuous threats:
+// every attacker move makes a line of three, so the defender's reply is forced, until
+// two threats at once cannot both be blocked. This is the shape of Qubic's forced wins
+// and keeps the defender's nodes to a single child. Depth-first proof-number search
+// (df-pn) with phi/delta numbers seen from the side to move at each node.
+static inline QubicTTEntry& QubicTTSlot(unsigned long long own, unsigned long long opp) {
+    // Full 64-bit mix: a move changes one bit anywhere in the mask, and siblings that
+    // shared a slot would keep evicting each other
+    unsigned long long hash = own * 0x9E3779B97F4A7C15ULL ^ opp;
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+    return qubicTT[(hash ^ (hash >> 31)) & (QUBIC_TT_SIZE - 1)];
+}
+
+static inline void QubicTTLookup(unsigned long long own, unsigned long long opp, unsigned int& phi, unsigned int& delta) {
+    const QubicTTEntry& entry = QubicTTSlot(own, opp);
+    if (entry.generation == qubicGeneration && entry.own == own && entry.opp == opp) {
+        phi = entry.phi;
+        delta = entry.delta;
+    } else {
+        phi = 1;
+        delta = 1;
+    }
+}
+
+static inline void QubicTTStore(unsigned long long own, unsigned long long opp, unsigned int phi, unsigned int delta) {
+    QubicTTEntry& entry = QubicTTSlot(own, opp);
+    entry.own = own;
+    entry.opp = opp;
+    entry.phi = phi;
+    entry.delta = delta;
+    entry.generation = qubicGeneration;
+}
+
+// Moves of the side to move, or -1 with phi/delta set when the node is decided
+static int QubicChildren(unsigned long long own, unsigned long long opp, bool attacker,
+                         unsigned long long& moves, unsigned int& phi, unsigned int& delta) {
+    unsigned long long empty = ~(own | opp);
+    if (attacker) {
+        unsigned long long oppWins = QubicWinningCells(opp, own);
+        if (QubicWinningCells(own, opp) != 0) { phi = 0; delta = QUBIC_INF; return -1; }
+        moves = QubicThreatCells(own, opp) & empty;
+        if (oppWins != 0) moves &= oppWins;     // Must block, and the block must threaten too
+        if (Popcount64(oppWins) >= 2 || moves == 0) { phi = QUBIC_INF; delta = 0; return -1; }
+    } else {
+        unsigned long long threats = QubicWinningCells(opp, own);
+        if (QubicWinningCells(own, opp) != 0 || threats == 0 || empty == 0) { phi = 0; delta = QUBIC_INF; return -1; }
+        if (Popcount64(threats) >= 2) { phi = QUBIC_INF; delta = 0; return -1; }
+        moves = threats;                        // The one forced block
+    }
+    return Popcount64(moves);
+}
+
+static void QubicMid(unsigned long long own, unsigned long long opp, bool attacker,
+                     unsigned int thPhi, unsigned int thDelta) {
+    qubicNodes++;
+    unsigned long long moves;
+    unsigned int phi, delta;
+    if (QubicChildren(own, opp, attacker, moves, phi, delta) < 0) {
+        QubicTTStore(own, opp, phi, delta);
+        return;
+    }
+    
+    for (;;) {
+        // phi = smallest child delta, delta = sum of child phis
+        unsigned int bestDelta = QUBIC_INF, secondDelta = QUBIC_INF, bestPhi = 0;
+        unsigned long long sumPhi = 0;
+        int bestCell = -1;
+        for (unsigned long long rest = moves; rest != 0; rest &= rest - 1) {
+            int cell = LowestSetCell(rest);
+            unsigned int childPhi, childDelta;
+            QubicTTLookup(opp, own | (1ULL << cell), childPhi, childDelta);
+            sumPhi += childPhi;
+            if (childDelta < bestDelta) {
+                secondDelta = bestDelta;
+                bestDelta = childDelta;
+                bestPhi = childPhi;
+                bestCell = cell;
+            } else if (childDelta < secondDelta) {
+                secondDelta = childDelta;
+            }
+        }
+        phi = bestDelta;
+        delta = sumPhi >= QUBIC_INF ? QUBIC_INF : (unsigned int)sumPhi;
+        if (phi >= thPhi || delta >= thDelta || qubicNodes >= qubicNodeLimit) break;
+        
+        unsigned int childThPhi = (thDelta >= QUBIC_INF) ? QUBIC_INF : thDelta - delta + bestPhi;
+        unsigned int childThDelta = std::min(thPhi, secondDelta >= QUBIC_INF ? QUBIC_INF : secondDelta + 1);
+        QubicMid(opp, own | (1ULL << bestCell), !attacker, childThPhi, childThDelta);
+    }
+    QubicTTStore(own, opp, phi, delta);
+}
+
+// Does the side to move ('own') force a win by threats? 1 proven, 0 disproven,
+// -1 node limit reached. On a proof, 'move' is the first winning move.
+int QubicSolve(unsigned long long own, unsigned long long opp, unsigned long long nodeLimit, int& move) {
+    QubicInitLines();
+    qubicGeneration++;                          // Retires every entry of the last solve
+    qubicNodes = 0;
+    qubicNodeLimit = nodeLimit;
+    move = -1;
+    QubicMid(own, opp, true, QUBIC_INF, QUBIC_INF);
+    
+    unsigned int phi, delta;
+    QubicTTLookup(own, opp, phi, delta);
+    if (phi != 0) return delta == 0 ? 0 : -1;
+    
+    unsigned long long moves;
+    if (QubicChildren(own, opp, true, moves, phi, delta) < 0) {
+        move = LowestSetCell(QubicWinningCells(own, opp));
+        return 1;
+    }
+    for (unsigned long long rest = moves; rest != 0; rest &= rest - 1) {
+        int cell = LowestSetCell(rest);
+        unsigned int childPhi, childDelta;
+        QubicTTLookup(opp, own | (1ULL << cell), childPhi, childDelta);
+        if (childDelta == 0) {
+            move = cell;
+            break;
+        }
+    }
+    return 1;
+}
+
+// AI move for the side to move: a forced win if the solver finds one within
+// qubicNodeBudget, else the opponent's forced-win entry cell, else the cell on the
+// most open lines of either side
+int QubicBestMove(const QubicState& state) {
+    unsigned long long own = (state.player == 1) ? state.x : state.o;
+    unsigned long long opp = (state.player == 1) ? state.o : state.x;
+    unsigned long long empty = ~(own | opp);
+    unsigned long long cells = QubicWinningCells(own, opp);
+    if (cells == 0) cells = QubicWinningCells(opp, own);   // Block
+    if (cells != 0) return LowestSetCell(cells);
+    
+    int move;
+    if (QubicSolve(own, opp, qubicNodeBudget, move) == 1) return move;
+    if (QubicSolve(opp, own, qubicNodeBudget, move) == 1) return move;
+    
+    // Open lines through the cell, weighted by the stones already on them
+    static const int weight[4] = {1, 4, 24, 0};
+    int bestCell = LowestSetCell(empty), bestScore = -1;
+    for (unsigned long long rest = empty; rest != 0; rest &= rest - 1) {
+        int cell = LowestSetCell(rest);
+        int score = 0;
+        for (int i = 0; i < qubicCellLineCount[cell]; i++) {
+            unsigned long long line = qubicLines[qubicCellLines[cell][i]];
+            if ((opp & line) == 0) score += 2 * weight[Popcount64(own & line)];
+            if ((own & line) == 0) score += weight[Popcount64(opp & line)];
+        }
+        if (score > bestScore) {
+            bestScore = score;
+            bestCell = cell;
+        }
+    }
+    return bestCell;
+}
+
+#ifdef TICTACTOE_HEADLESS
+// Headless driver
+//   tic_tac_toe bench [repeat]   solve the full game tree from the empty board, time table lookups
+//   tic_tac_toe verify           check solvedTable against BuildSolvedTable() on every encoding, and against
+//                                Minimax() and GridNegamax() on every reachable board
+//   tic_tac_toe gentable         print tic_tac_toe_solved.h
+//   tic_tac_toe solve [size]     node counts and times of the n x n solvers, size 3 (default) or 4
+//   tic_tac_toe mnk [width height k] [ms]   engine vs engine m,n,k game, ms per move (default 15 15 5, 1000)
+//   tic_tac_toe ultimate [ms] [playouts]    MCTS vs MCTS ultimate game, budget per move (default 1000 ms)
+//   tic_tac_toe mctsbench [threads] [ms] [games]   parallel MCTS scaling: playouts/s and score against
+//                                                  the single-threaded search at equal time per move
+//   tic_tac_toe gbench [size] [depth]              the n x n board through the shared searcher (game_search.h)
+//   tic_tac_toe qubic [positions] [stones] [nodes]  df-pn solve times on random Qubic positions
+//                                                  (default 20 positions, 12 stones, 2000000 nodes)
+static bool verifyVisited[SOLVED_STATES];
+
+// Walks every board reachable from 'position' with 'player' to move; returns the mismatch count
+static int VerifyFrom(BitBoard position, int player, int& checked) {
+    int index = EncodeBoard(position);
+    if (verifyVisited[index]) return 0;
+    verifyVisited[index] = true;
+    if (EvaluateBoard(position) != 0) return 0;
+    
+    checked++;
+    int mismatches = 0;
+    MoveScore expected = Minimax(position, player == 2);
+    const SolvedEntry& entry = solvedTable.entry[index];
+    if (entry.score != expected.score || entry.move != expected.row * 3 + expected.col) {
+        printf("mismatch: x=%03x o=%03x table %d/%d minimax %d/%d\n", position.x, position.o,
+               entry.score, entry.move, expected.score, expected.row * 3 + expected.col);
+        mismatches++;
+    }
+    
+    // The negamax value has the same sign as Minimax's once turned to O's point of view
+    int stones = 0;
+    for (unsigned int mask = position.x | position.o; mask != 0; mask &= mask - 1) stones++;
+    int value = (player == 1) ? GridNegamax(position.x, position.o, stones, -GRID_WIN, GRID_WIN)
+                              : GridNegamax(position.o, position.x, stones, -GRID_WIN, GRID_WIN);
+    if (player == 1) value = -value;
+    if ((value > 0) != (expected.score > 0) || (value < 0) != (expected.score < 0)) {
+        printf("negamax mismatch: x=%03x o=%03x negamax %d minimax %d\n", position.x, position.o,
+               value, expected.score);
+        mismatches++;
+    }
+    
+    unsigned int empty = FULL_BOARD & ~(position.x | position.o);
+    for (; empty != 0; empty &= empty - 1) {
+        BitBoard next = position;
+        if (player == 1) next.x |= 1 << LowestBit(empty);
+        else next.o |= 1 << LowestBit(empty);
+        mismatches += VerifyFrom(next, 3 - player, checked);
+    }
+    return mismatches;
+}
+
+// Plays the m,n,k engine against itself and reports every search
+static int RunMnkGame(int width, int height, int k, int timeLimitMs) {
+    MnkNewGame(width, height, k);
+    printf("m,n,k game %dx%d, %d in a row, %d ms per move\n", width, height, k, timeLimitMs);
+    
+    int player = 1;
+    unsigned long long totalNodes = 0;
+    double totalMs = 0;
+    while (mnkWinner == 0 && mnkStones < width * height) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        int cell = MnkSearch(player, timeLimitMs);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        totalNodes += mnkNodes;
+        totalMs += ms;
+        MnkPlace(cell, player);
+        printf("%3d. %c %c%-2d  depth %2d  score %10d  nodes %9llu  time %7.1f ms\n", mnkStones,
+               player == 1 ? 'X' : 'O', 'a' + cell % MNK_MAX, cell / MNK_MAX + 1,
+               mnkDepthReached, mnkBestScore, mnkNodes, ms);
+        player = 3 - player;
+    }
+    
+    if (mnkWinner != 0) printf("Result           : %c wins\n", mnkWinner == 1 ? 'X' : 'O');
+    else printf("Result           : draw\n");
+    printf("Nodes/second     : %.0f\n", totalMs > 0 ? totalNodes * 1000.0 / totalMs : 0.0);
+    return 0;
+}
+
+// One line of the "solve" report
+static void ReportSolve(const char* name, int value, unsigned long long nodes, unsigned long long ttHits, double ms) {
+    printf("%-28s value %4d  nodes %12llu  tt hits %10llu  time %9.2f ms\n", name, value, nodes, ttHits, ms);
+}
+
+static int RunSolve(int size) {
+    printf("Solving the empty %dx%d board, %d in a row\n", size, size, size);
+    std::chrono::steady_clock::time_point start;
+    double ms;
+    
+    if (size == 3) {
+        // The original full-width Minimax, O's point of view turned into X's
+        BitBoard empty = {0, 0};
+        searchNodes = 0;
+        start = std::chrono::steady_clock::now();
+        int value = -Minimax(empty, false).score;
+        ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        ReportSolve("Minimax", value, searchNodes, 0, ms);
+        
+        GridNewGame(size);
+        start = std::chrono::steady_clock::now();
+        value = GridSolve(false, false);
+        ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        ReportSolve("alpha-beta", value, gridNodes, gridTTHits, ms);
+    }
+    
+    GridNewGame(size);
+    start = std::chrono::steady_clock::now();
+    int value = GridSolve(true, false);
+    ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    ReportSolve("alpha-beta + TT", value, gridNodes, gridTTHits, ms);
+    
+    GridNewGame(size);
+    start = std::chrono::steady_clock::now();
+    value = GridSolve(true, true);
+    ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    ReportSolve("alpha-beta + TT + symmetry", value, gridNodes, gridTTHits, ms);
+    return 0;
+}
+
+// Solves random Qubic positions for the side to move and reports the df-pn times
+static int RunQubicBench(int positions, int stones, unsigned long long nodeLimit) {
+    QubicInitLines();
+    printf("Qubic lines      : %d\n", qubicLineCount);
+    printf("Positions        : %d random, %d stones, node limit %llu\n", positions, stones, nodeLimit);
+    unsigned long long rng = 0x9E3779B97F4A7C15ULL;
+    int won = 0, refuted = 0, unknown = 0;
+    unsigned long long totalNodes = 0;
+    double totalMs = 0, wonMs = 0;
+    for (int n = 0; n < positions; n++) {
+        // Random stones, redrawn if someone already has a line
+        QubicState state;
+        do {
+            QubicNewGame(state);
+            for (int i = 0; i < stones && state.winner == 0; i++) {
+                unsigned long long empty = ~(state.x | state.o);
+                int skip;
+                do {
+                    rng ^= rng << 13; rng ^= rng >> 7; rng ^= rng << 17;
+                    skip = (int)(rng % 64);
+                } while (!(empty & (1ULL << skip)));
+                QubicApply(state, skip);
+            }
+        } while (state.winner != 0);
+        
+        unsigned long long own = (state.player == 1) ? state.x : state.o;
+        unsigned long long opp = (state.player == 1) ? state.o : state.x;
+        int move;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        int result = QubicSolve(own, opp, nodeLimit, move);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        totalNodes += qubicNodes;
+        totalMs += ms;
+        if (result == 1) { won++; wonMs += ms; }
+        else if (result == 0) refuted++;
+        else unknown++;
+        printf("%3d  %c to move  %-10s move %3d  nodes %10llu  time %9.2f ms\n", n + 1, state.player == 1 ? 'X' : 'O',
+               result == 1 ? "win" : result == 0 ? "no win" : "unknown", move, qubicNodes, ms);
+    }
+    printf("Forced wins      : %d (avg %.2f ms)\n", won, won > 0 ? wonMs / won : 0.0);
+    printf("No threat win    : %d\n", refuted);
+    printf("Unknown          : %d\n", unknown);
+    printf("Total time ms    : %.2f\n", totalMs);
+    printf("Nodes/second     : %.0f\n", totalMs > 0 ? totalNodes * 1000.0 / totalMs : 0.0);
+    return 0;
+}
+
+// The n x n board set up by GridNewGame() as a game for the shared searcher in game_search.h
+struct GridGame {
+    typedef int Move;                          // Square, row * gridSize + col
+    static const int MAX_MOVES = GRID_MAX * GRID_MAX;
+    static const int WIN_SCORE = 1000;
+    
+    unsigned int own, other;                   // Side to move's stones and the other side's
+    
+    int GenerateMoves(int moves[]) {
+        int count = 0;
+        for (int i = 0; i < gridSize * gridSize; i++) {
+            if (!((own | other) & (1u << gridMoveOrder[i]))) moves[count++] = gridMoveOrder[i];
+        }
+        return count;
+    }
+    void MakeMove(const int& square) {
+        unsigned int mover = own | (1u << square);
+        own = other;
+        other = mover;
+    }
+    void UnmakeMove(const int& square) {
+        unsigned int mover = other & ~(1u << square);
+        other = own;
+        own = mover;
+    }
+    bool IsTerminal(int& score) {
+        score = GridHasLine(other) ? -WIN_SCORE : 0;
+        return score != 0 || (own | other) == gridFull;
+    }
+    int NoMovesScore() { return 0; }
+    // Lines still open for the side to move minus those open for the opponent
+    int Evaluate(int, int) {
+        int score = 0;
+        for (int i = 0; i < gridLineCount; i++) {
+            score += !(gridLines[i] & other) - !(gridLines[i] & own);
+        }
+        return score;
+    }
+    unsigned long long Hash() { return own | (unsigned long long)other << 32; }
+    void MoveToText(const int& square, char out[16]) {
+        out[0] = 'r';
+        out[1] = (char)('1' + square / gridSize);
+        out[2] = 'c';
+        out[3] = (char)('1' + square % gridSize);
+        out[4] = 0;
+    }
+};
+
+// "gbench" positions: the empty board, X in a corner, X in the centre
+static bool SetUpGridPosition(GridGame& game, int index) {
+    game.own = 0;
+    game.other = 0;
+    if (index == 1) game.MakeMove(0);
+    if (index == 2) game.MakeMove((gridSize / 2) * gridSize + gridSize / 2);
+    return index <= 2;
+}
+
+// Plays the MCTS engine against itself on the ultimate board and reports every search
+static int RunUltimateGame(int timeLimitMs, int playoutLimit) {
+    printf("Ultimate tic-tac-toe, MCTS budget %d ms / %d playouts per move\n", timeLimitMs, playoutLimit);
+    UltimateNewGame(ultimateGame);
+    MctsReset(ultimateGame);
+    
+    unsigned long long totalPlayouts = 0;
+    double totalMs = 0;
+    int ply = 0;
+    while (ultimateGame.winner == 0) {
+        int move = MctsSearch(timeLimitMs, playoutLimit);
+        const MctsNode& root = mctsPool[0];
+        double winRate = 0;
+        for (int i = 0; i < root.childCount; i++) {
+            const MctsNode& child = mctsPool[root.firstChild + i];
+            if (child.move == move && child.visits > 0) winRate = child.wins / child.visits;
+        }
+        totalPlayouts += mctsPlayouts;
+        totalMs += mctsSearchMs;
+        printf("%3d. %c board %d cell %d  playouts %8llu  reused %7llu  tree %7d  win %5.1f%%  %9.0f playouts/s\n",
+               ++ply, ultimateGame.player == 1 ? 'X' : 'O', move / 9, move % 9, mctsPlayouts, mctsReused,
+               mctsUsed, winRate * 100, mctsSearchMs > 0 ? mctsPlayouts * 1000.0 / mctsSearchMs : 0.0);
+        UltimatePlay(move);
+    }
+    
+    if (ultimateGame.winner == 3) printf("Result           : draw\n");
+    else printf("Result           : %c wins\n", ultimateGame.winner == 1 ? 'X' : 'O');
+    printf("Playouts/second  : %.0f\n", totalMs > 0 ? totalPlayouts * 1000.0 / totalMs : 0.0);
+    return 0;
+}
+
+// One ultimate game, parallel search against the single-threaded MctsSearch() with the same
+// time per move (its tree is reset every move too); returns the parallel side's score x2
+static int PlayParallelMatchGame(int threads, MctsParallelMode mode, int timeLimitMs, int parallelSide) {
+    UltimateState state;
+    UltimateNewGame(state);
+    while (state.winner == 0) {
+        int move;
+        if (state.player == parallelSide) {
+            move = MctsSearchParallel(state, threads, mode, timeLimitMs, 0);
+        } else {
+            MctsReset(state);
+            move = MctsSearch(timeLimitMs, 0);
+        }
+        UltimateApply(state, move);
+    }
+    return state.winner == parallelSide ? 2 : state.winner == 3 ? 1 : 0;
+}
+
+static int RunMctsBench(int maxThreads, int timeLimitMs, int games) {
+    printf("Parallel MCTS scaling, %d ms per search, %d games per row against 1 thread\n", timeLimitMs, games);
+    UltimateState start;
+    UltimateNewGame(start);
+    
+    const char* modeNames[2] = {"root", "tree"};
+    double singleRate = 0;
+    for (int mode = MCTS_ROOT_PARALLEL; mode <= MCTS_TREE_PARALLEL; mode++) {
+        for (int threads = 1; threads <= maxThreads; threads = (threads * 2 > maxThreads && threads < maxThreads) ? maxThreads : threads * 2) {
+            // Throughput on the opening position
+            unsigned long long playouts = 0;
+            double ms = 0;
+            for (int i = 0; i < 3; i++) {
+                MctsSearchParallel(start, threads, (MctsParallelMode)mode, timeLimitMs, 0);
+                playouts += mctsPlayouts;
+                ms += mctsSearchMs;
+            }
+            double rate = ms > 0 ? playouts * 1000.0 / ms : 0;
+            if (mode == MCTS_ROOT_PARALLEL && threads == 1) singleRate = rate;
+            
+            // Strength at equal wall time, colours alternating
+            int score = 0;
+            for (int game = 0; game < games; game++) {
+                score += PlayParallelMatchGame(threads, (MctsParallelMode)mode, timeLimitMs, 1 + (game & 1));
+            }
+            printf("%s  threads %2d  playouts/s %10.0f  speedup %5.2f", modeNames[mode], threads, rate,
+                   singleRate > 0 ? rate / singleRate : 0.0);
+            if (games > 0) printf("  score vs 1 thread %5.1f%% (%d games)", score * 50.0 / games, games);
+            printf("\n");
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc >= 2 && strcmp(argv[1], "mctsbench") == 0) {
+        int maxThreads = argc > 2 ? atoi(argv[2]) : (int)std::thread::hardware_concurrency();
+        int timeLimitMs = argc > 3 ? atoi(argv[3]) : 100;
+        int games = argc > 4 ? atoi(argv[4]) : 10;
+        if (maxThreads < 1) maxThreads = 1;
+        if (timeLimitMs < 1) timeLimitMs = 100;
+        return RunMctsBench(maxThreads, timeLimitMs, games);
+    }
+    if (argc >= 2 && strcmp(argv[1], "ultimate") == 0) {
+        int timeLimitMs = argc > 2 ? atoi(argv[2]) : 1000;
+        int playoutLimit = argc > 3 ? atoi(argv[3]) : 0;
+        if (timeLimitMs <= 0 && playoutLimit <= 0) timeLimitMs = 1000;
+        return RunUltimateGame(timeLimitMs, playoutLimit);
+    }
+    if (argc >= 2 && strcmp(argv[1], "qubic") == 0) {
+        int positions = argc > 2 ? atoi(argv[2]) : 20;
+        int stones = argc > 3 ? atoi(argv[3]) : 12;
+        long long nodeLimit = argc > 4 ? atoll(argv[4]) : 2000000;
+        if (positions < 1 || stones < 0 || stones > 40 || nodeLimit < 1) {
+            printf("need positions >= 1, 0 <= stones <= 40, nodes >= 1\n");
+            return 1;
+        }
+        return RunQubicBench(positions, stones, (unsigned long long)nodeLimit);
+    }
+    if (argc >= 2 && strcmp(argv[1], "gbench") == 0) {
+        int size = argc > 2 ? atoi(argv[2]) : 3;
+        if (size < 3 || size > GRID_MAX) {
+            printf("size must be 3 or 4\n");
+            return 1;
+        }
+        int depth = argc > 3 ? atoi(argv[3]) : size * size;
+        GridNewGame(size);
+        GridGame game;
+        char name[32];
+        snprintf(name, sizeof(name), "%dx%d tic-tac-toe", size, size);
+        RunGameBench(name, game, SetUpGridPosition, 3, depth > 0 ? depth : size * size, 0);
+        return 0;
+    }
+    if (argc >= 2 && strcmp(argv[1], "solve") == 0) {
+        int size = argc > 2 ? atoi(argv[2]) : 3;
+        if (size < 3 || size > GRID_MAX) {
+            printf("size must be 3 or 4\n");
+            return 1;
+        }
+        return RunSolve(size);
+    }
+    if (argc >= 2 && strcmp(argv[1], "mnk") == 0) {
+        int width = argc > 4 ? atoi(argv[2]) : 15;
+        int height = argc > 4 ? atoi(argv[3]) : 15;
+        int k = argc > 4 ? atoi(argv[4]) : 5;
+        int timeLimitMs = argc > 5 ? atoi(argv[5]) : argc == 3 ? atoi(argv[2]) : 1000;
+        if (width < 1 || width > MNK_MAX || height < 1 || height > MNK_MAX || k < 2 || k > MNK_MAX_K ||
+            (k > width && k > height)) {
+            printf("board must be at most %dx%d with 2 <= k <= %d\n", MNK_MAX, MNK_MAX, MNK_MAX_K);
+            return 1;
+        }
+        return RunMnkGame(width, height, k, timeLimitMs > 0 ? timeLimitMs : 1000);
+    }
+    if (argc >= 2 && strcmp(argv[1], "verify") == 0) {
+        int checked = 0;
+        BitBoard empty = {0, 0};
+        GridNewGame(3);
+        int mismatches = VerifyFrom(empty, 1, checked);
+        // The generated table must still be what the solver produces, unreachable boards included
+        SolvedTable solved = BuildSolvedTable();
+        for (int index = 0; index < SOLVED_STATES; index++) {
+            if (solvedTable.entry[index].score != solved.entry[index].score ||
+                solvedTable.entry[index].move != solved.entry[index].move) {
+                printf("stale table entry %d: %d/%d, solver %d/%d\n", index, solvedTable.entry[index].score,
+                       solvedTable.entry[index].move, solved.entry[index].score, solved.entry[index].move);
+                mismatches++;
+            }
+        }
+        printf("Boards checked   : %d\n", checked);
+        printf("Mismatches       : %d\n", mismatches);
+        return mismatches == 0 ? 0 : 1;
+    }
+    if (argc >= 2 && strcmp(argv[1], "gentable") == 0) {
+        SolvedTable solved = BuildSolvedTable();
+        printf("#ifndef TIC_TAC_TOE_SOLVED_H\n#define TIC_TAC_TOE_SOLVED_H\n\n");
+        printf("// Generated by \"tic_tac_toe gentable > tic_tac_toe_solved.h\", do not edit.\n");
+        printf("// Entry i is the perfect-play SolvedEntry of the board with base-3 encoding i.\n");
+        printf("const SolvedTable solvedTable = {{\n");
+        for (int index = 0; index < SOLVED_STATES; index++) {
+            printf("%s{%d,%d}%s", index % 12 == 0 ? "    " : "", solved.entry[index].score, solved.entry[index].move,
+                   index == SOLVED_STATES - 1 ? "\n" : index % 12 == 11 ? ",\n" : ",");
+        }
+        printf("}};\n\n#endif\n");
+        return 0;
+    }
+    if (argc < 2 || strcmp(argv[1], "bench") != 0) {
+        printf("usage: %s bench [repeat] | verify | gentable | solve [size] | mnk [width height k] [ms] | ultimate [ms] [playouts]"
+               " | mctsbench [threads] [ms] [games] | gbench [size] [depth] | qubic [positions] [stones] [nodes]\n", argv[0]);
+        return 1;
+    }
+    int repeat = argc > 2 ? atoi(argv[2]) : 20;
+    if (repeat < 1) repeat = 1;
+    
+    ResetGame();
+    searchNodes = 0;
+    MoveScore result = {-1, -1, 0};
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeat; i++) {
+        result = Minimax(board, false); // X to move on the empty board
+    }
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    
+    printf("Full-tree solves : %d\n", repeat);
+    printf("Value / best move: %d / row %d col %d\n", result.score, result.row, result.col);
+    printf("Nodes per solve  : %llu\n", searchNodes / repeat);
+    printf("Time per solve ms: %.3f\n", ms / repeat);
+    printf("Nodes/second     : %.0f\n", ms > 0 ? searchNodes * 1000.0 / ms : 0.0);
+    
+    // Table lookups the way AIMove() does them
+    const int lookups = 10000000;
+    BitBoard corner = {0x001, 0};
+    volatile int sink = 0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < lookups; i++) {
+        corner.o = (unsigned short)(i & 0x100); // Defeats hoisting, alternates two boards
+        sink = sink + solvedTable.entry[EncodeBoard(corner)].move;
+    }
+    ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    printf("Table move ns    : %.2f\n", ms * 1e6 / lookups);
+    return 0;
+}
+#else
 int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int nCmdShow) {
     WNDCLASS wc = {};
     wc.lpfnWndProc = WndProc;
@@ -324,7 +2146,7 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
         return 0;
     }
 
-    RECT windowRect = {0, 0, BOARD_SIZE, BOARD_SIZE + 120};
+    RECT windowRect = {0, 0, BOARD_SIZE, BOARD_SIZE + 150};
     AdjustWindowRect(&windowRect, WS_OVERLAPPEDWINDOW & ~WS_THICKFRAME & ~WS_MAXIMIZEBOX, FALSE);
 
     HWND hwnd = CreateWindow(
@@ -352,4 +2174,5 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
     }
 
     return 0;
-}
\ No newline at end of file
+}
+#endif
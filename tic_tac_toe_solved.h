@@ -0,0 +1,1650 @@
+#ifndef TIC_TAC_TOE_SOLVED_H
+#define TIC_TAC_TOE_SOLVED_H
+
+// Generated by "tic_tac_toe gentable > tic_tac_toe_solved.h", do not edit.
+// Entry i is the perfect-play SolvedEntry of the board with base-3 encoding i.
+const SolvedTable solvedTable = {{
+    {0,0},{0,4},{0,-1},{0,0},{0,-1},{0,3},{0,-1},{-10,3},{0,-1},{0,4},{0,-1},{-10,5},
+    {0,-1},{0,-1},{10,3},{-10,4},{0,4},{0,-1},{0,-1},{-10,3},{0,-1},{0,4},{10,5},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,0},{0,-1},{0,1},{0,-1},{0,-1},{0,4},{-10,0},{-10,2},{0,-1},
+    {0,-1},{0,-1},{0,4},{0,-1},{0,-1},{0,-1},{0,4},{0,-1},{-10,4},{-10,0},{-10,1},{0,-1},
+    {10,8},{0,-1},{-10,4},{0,-1},{-10,4},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{10,0},{0,-1},{10,4},{0,-1},{-10,4},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,0},{0,-1},{0,1},
+    {0,-1},{0,-1},{0,7},{-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,6},{0,-1},{0,-1},{0,-1},
+    {-10,0},{0,-1},{-10,3},{0,0},{0,8},{0,-1},{0,7},{0,-1},{-10,3},{0,-1},{-10,3},{0,-1},
+    {0,-1},{0,-1},{0,5},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,5},{0,5},{0,-1},{-10,1},{0,-1},{0,-1},{-10,5},
+    {-10,0},{-10,5},{0,-1},{-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,6},{0,-1},{-10,2},{0,-1},
+    {-10,0},{0,-1},{-10,6},{0,-1},{0,-1},{10,6},{-10,0},{-10,5},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,5},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,1},{0,-1},{0,0},{0,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,0},{0,1},{0,-1},{0,0},{0,-1},{0,8},{0,-1},{0,7},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,6},{0,-1},{0,-1},{0,-1},{0,-1},{0,0},{0,6},{0,-1},
+    {0,0},{0,-1},{0,8},{0,-1},{-10,6},{0,-1},{0,0},{0,-1},{0,8},{0,-1},{0,-1},{10,8},
+    {0,7},{10,7},{0,-1},{0,-1},{-10,6},{0,-1},{0,6},{10,6},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,2},{0,-1},{-10,2},{0,-1},{0,-1},{10,6},{-10,2},{0,4},{0,-1},
+    {0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,3},{0,0},{0,3},{0,-1},
+    {0,3},{0,-1},{-10,4},{0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{10,4},{0,-1},{0,-1},{0,-1},
+    {10,4},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,4},
+    {10,4},{0,-1},{-10,4},{0,-1},{0,-1},{10,4},{-10,0},{-10,4},{0,-1},{0,0},{0,2},{0,-1},
+    {0,2},{0,-1},{-10,6},{0,-1},{-10,8},{0,-1},{0,8},{0,-1},{-10,6},{0,-1},{0,-1},{10,6},
+    {-10,4},{0,8},{0,-1},{0,-1},{0,1},{0,-1},{0,0},{0,4},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,3},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,3},{0,3},{0,-1},{-10,1},{0,-1},{0,-1},{-10,3},
+    {-10,0},{-10,3},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},
+    {0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{10,-1},{0,0},{0,-1},{0,6},{0,-1},{0,-1},{10,6},
+    {-10,2},{0,8},{0,-1},{0,-1},{0,-1},{10,6},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,6},
+    {0,0},{0,8},{0,-1},{0,7},{0,-1},{-10,7},{0,-1},{-10,8},{0,-1},{0,0},{0,1},{0,-1},
+    {0,0},{0,-1},{0,8},{0,-1},{0,7},{0,-1},{0,8},{0,-1},{-10,8},{0,-1},{0,-1},{10,8},
+    {-10,8},{10,7},{0,-1},{0,-1},{0,6},{0,-1},{0,6},{10,6},{0,-1},{0,-1},{0,-1},{0,-1},
+    {10,0},{0,-1},{10,1},{0,-1},{0,-1},{10,2},{10,0},{10,6},{0,-1},{0,-1},{0,-1},{10,8},
+    {0,-1},{0,-1},{0,-1},{10,7},{0,-1},{-10,8},{10,0},{10,6},{0,-1},{10,0},{0,-1},{10,6},
+    {0,-1},{-10,6},{0,-1},{0,-1},{-10,2},{0,-1},{-10,2},{0,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,8},{0,-1},{-10,8},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,6},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{-10,2},{10,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,4},{0,-1},{-10,4},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{10,3},{0,-1},{0,-1},{0,-1},{0,-1},{0,0},{0,6},{0,-1},
+    {0,0},{0,-1},{0,2},{0,-1},{-10,4},{0,-1},{0,0},{0,-1},{0,1},{0,-1},{0,-1},{0,4},
+    {-10,6},{0,6},{0,-1},{0,-1},{-10,6},{0,-1},{-10,8},{10,6},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,2},{0,-1},{-10,2},{0,-1},
+    {-10,0},{0,-1},{-10,1},{0,-1},{0,-1},{-10,3},{-10,0},{-10,3},{0,-1},{0,-1},{-10,8},{0,-1},
+    {-10,7},{10,8},{0,-1},{0,-1},{0,-1},{0,-1},{0,0},{0,-1},{0,1},{0,-1},{0,-1},{0,7},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,6},{0,-1},{0,-1},{0,-1},{0,6},{0,-1},{-10,6},
+    {0,8},{10,8},{0,-1},{10,8},{0,-1},{-10,7},{0,-1},{-10,6},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,6},
+    {0,-1},{-10,6},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,7},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{-10,1},{0,-1},{0,0},{0,-1},{0,8},{0,-1},{-10,6},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,6},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,4},{0,-1},{-10,2},
+    {0,-1},{0,-1},{0,4},{-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},
+    {0,4},{0,-1},{-10,4},{-10,0},{-10,1},{0,-1},{0,4},{0,-1},{-10,7},{0,-1},{-10,3},{0,-1},
+    {0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,4},{10,0},{0,-1},{10,1},{0,-1},{0,-1},{10,8},
+    {-10,0},{-10,-1},{0,-1},{-10,4},{0,4},{0,-1},{0,4},{0,-1},{-10,4},{0,-1},{-10,4},{0,-1},
+    {0,4},{0,-1},{-10,4},{0,-1},{0,-1},{10,4},{-10,4},{10,4},{0,-1},{0,-1},{-10,8},{0,-1},
+    {-10,7},{10,5},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,2},{0,-1},{0,-1},{0,-1},
+    {-10,0},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},
+    {0,0},{0,-1},{0,1},{0,-1},{0,-1},{0,7},{-10,0},{-10,3},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},
+    {-10,0},{0,-1},{-10,1},{0,-1},{0,-1},{-10,2},{-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{-10,-1},
+    {0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{-10,7},{0,8},{0,-1},{0,7},{0,-1},{-10,7},
+    {0,-1},{-10,8},{0,-1},{0,0},{0,3},{0,-1},{0,0},{0,-1},{0,8},{0,-1},{-10,3},{0,-1},
+    {0,1},{0,-1},{-10,8},{0,-1},{0,-1},{10,3},{0,7},{10,3},{0,-1},{0,-1},{-10,3},{0,-1},
+    {0,0},{0,3},{0,-1},{0,-1},{0,-1},{0,-1},{0,0},{0,-1},{0,8},{0,-1},{0,-1},{10,8},
+    {-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,5},
+    {-10,0},{-10,-1},{0,-1},{0,0},{0,-1},{0,8},{0,-1},{-10,-1},{0,-1},{0,-1},{0,5},{0,-1},
+    {0,5},{10,5},{0,-1},{0,-1},{0,-1},{0,-1},{0,5},{10,1},{0,-1},{10,0},{0,-1},{10,5},
+    {0,-1},{10,5},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,5},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,2},{0,-1},{0,-1},{0,-1},{0,4},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,3},{0,0},{0,-1},{0,1},{0,-1},{0,-1},{0,4},
+    {-10,0},{-10,3},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},
+    {0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{0,2},{0,-1},{-10,1},{0,-1},{0,-1},{-10,2},
+    {-10,2},{0,4},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,4},
+    {0,0},{0,4},{0,-1},{0,4},{0,-1},{-10,7},{0,-1},{-10,8},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,2},{0,-1},{0,-1},{0,-1},{0,2},{0,-1},{-10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,0},{0,-1},{0,1},
+    {0,-1},{0,-1},{0,7},{0,0},{0,8},{0,-1},{0,1},{0,-1},{-10,8},{0,-1},{0,-1},{10,8},
+    {0,7},{10,7},{0,-1},{0,-1},{0,-1},{10,8},{0,-1},{0,-1},{0,-1},{10,7},{0,-1},{-10,8},
+    {0,0},{0,3},{0,-1},{0,0},{0,-1},{0,8},{0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{10,1},
+    {0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,7},{10,0},{0,-1},{10,1},{0,-1},{0,-1},{10,8},{-10,0},{-10,-1},{0,-1},
+    {-10,8},{0,1},{0,-1},{0,2},{0,-1},{-10,8},{0,-1},{0,7},{0,-1},{0,8},{0,-1},{-10,8},
+    {0,-1},{0,-1},{10,8},{-10,8},{10,7},{0,-1},{0,-1},{0,1},{0,-1},{0,0},{0,7},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{0,4},{0,-1},{-10,4},{0,-1},{-10,2},{0,-1},
+    {0,4},{0,-1},{-10,4},{0,-1},{0,-1},{10,4},{-10,0},{-10,3},{0,-1},{0,-1},{-10,3},{0,-1},
+    {-10,8},{10,3},{0,-1},{0,-1},{0,-1},{0,-1},{0,0},{0,-1},{0,2},{0,-1},{0,-1},{10,8},
+    {-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,4},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,4},
+    {-10,0},{-10,-1},{0,-1},{10,8},{0,-1},{0,8},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,4},{0,-1},
+    {-10,4},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,4},{10,4},{0,-1},{10,4},{0,-1},{-10,4},
+    {0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,4},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{0,-1},{-10,1},{0,-1},{0,-1},{-10,2},{-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{-10,-1},
+    {0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{-10,8},{10,8},{0,-1},{10,8},{0,-1},{-10,7},
+    {0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{10,0},{0,-1},{10,1},
+    {0,-1},{0,-1},{10,8},{-10,0},{-10,-1},{0,-1},{-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,2},
+    {0,-1},{-10,2},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},
+    {0,-1},{-10,8},{0,-1},{-10,7},{10,8},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,3},{0,-1},
+    {0,3},{10,3},{0,-1},{0,-1},{0,-1},{0,-1},{0,3},{10,3},{0,-1},{10,0},{0,-1},{10,3},
+    {0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{0,0},{0,-1},{0,8},{0,-1},{-10,-1},{0,-1},{0,0},{0,-1},{0,8},
+    {0,-1},{0,-1},{10,8},{-10,0},{-10,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{10,-1},{0,-1},{10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{10,0},{0,-1},{10,3},{0,-1},{-10,8},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,2},{10,7},{0,-1},
+    {10,8},{0,-1},{-10,4},{0,-1},{-10,4},{0,-1},{0,4},{0,-1},{-10,5},{0,-1},{0,-1},{10,8},
+    {-10,5},{10,7},{0,-1},{0,-1},{-10,4},{0,-1},{-10,4},{10,4},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,0},{0,8},{0,-1},{0,7},{0,-1},{-10,3},{0,-1},{-10,3},{0,-1},
+    {0,0},{0,-1},{0,3},{0,-1},{0,-1},{10,3},{-10,5},{0,8},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,3},{0,-1},{0,-1},{0,-1},{0,-1},{0,5},{0,-1},{-10,1},{0,-1},{0,-1},{-10,2},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,5},{0,-1},{0,-1},{0,-1},{0,5},{0,-1},{-10,5},
+    {-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,5},{0,-1},{-10,5},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{10,0},{0,-1},{10,-1},
+    {0,-1},{-10,8},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,5},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,2},{0,-1},{0,2},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,0},{0,1},{0,-1},{0,0},{0,-1},{0,8},{0,-1},{0,7},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,8},{0,8},{0,-1},
+    {10,0},{0,-1},{10,2},{0,-1},{-10,4},{0,-1},{10,8},{0,-1},{-10,3},{0,-1},{0,-1},{10,3},
+    {-10,3},{0,8},{0,-1},{0,-1},{-10,4},{0,-1},{-10,4},{10,4},{0,-1},{0,-1},{0,-1},{0,-1},
+    {10,4},{0,-1},{-10,2},{0,-1},{0,-1},{10,4},{-10,2},{10,4},{0,-1},{0,-1},{0,-1},{-10,1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,4},{-10,4},{10,4},{0,-1},{10,4},{0,-1},{-10,4},
+    {0,-1},{-10,4},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{-10,1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{-10,8},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,3},{0,-1},{-10,3},{0,-1},{0,-1},{10,3},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{10,3},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,3},
+    {-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,3},{0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{-10,-1},
+    {0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},
+    {0,0},{0,8},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{-10,8},{0,-1},{10,0},{0,-1},{10,-1},
+    {0,-1},{0,-1},{10,-1},{-10,8},{0,8},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,7},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{-10,2},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,8},{0,-1},{-10,8},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,0},{10,1},{0,-1},{10,0},{0,-1},{10,2},
+    {0,-1},{10,2},{0,-1},{10,8},{0,-1},{-10,8},{0,-1},{0,-1},{10,8},{-10,8},{10,7},{0,-1},
+    {0,-1},{10,-1},{0,-1},{10,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,2},{0,-1},{0,2},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,0},{0,1},{0,-1},{0,0},{0,-1},{0,4},{0,-1},{0,4},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,7},
+    {0,-1},{-10,8},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,7},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,1},{10,8},{0,-1},{0,7},{0,-1},{-10,7},{0,-1},{-10,8},{0,-1},{0,0},{0,-1},{0,1},
+    {0,-1},{0,-1},{0,7},{0,0},{0,8},{0,-1},{0,-1},{-10,8},{0,-1},{-10,7},{10,8},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,1},{0,-1},{-10,6},{0,-1},{0,-1},{10,4},{0,0},{0,6},{0,-1},
+    {0,-1},{0,-1},{0,6},{0,-1},{0,-1},{0,-1},{0,6},{0,-1},{-10,3},{-10,8},{0,8},{0,-1},
+    {10,4},{0,-1},{-10,4},{0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},
+    {0,6},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,4},
+    {10,0},{0,-1},{10,1},{0,-1},{0,-1},{10,4},{-10,0},{-10,4},{0,-1},{-10,4},{0,4},{0,-1},
+    {10,4},{0,-1},{-10,4},{0,-1},{-10,8},{0,-1},{0,4},{0,-1},{-10,6},{0,-1},{0,-1},{10,4},
+    {-10,6},{0,4},{0,-1},{0,-1},{-10,4},{0,-1},{-10,4},{10,4},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,1},{0,-1},{0,-1},{0,-1},{0,0},{0,-1},{0,2},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,6},{0,1},{0,-1},{-10,1},{0,-1},{0,-1},{-10,-1},
+    {0,0},{0,8},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},
+    {0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{-10,0},{0,-1},{-10,1},{0,-1},{0,-1},{-10,-1},
+    {-10,6},{0,8},{0,-1},{0,-1},{0,-1},{10,6},{0,-1},{0,-1},{0,-1},{0,6},{0,-1},{-10,6},
+    {-10,0},{-10,1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{-10,8},{0,-1},{0,0},{0,3},{0,-1},
+    {10,0},{0,-1},{10,2},{0,-1},{-10,6},{0,-1},{0,3},{0,-1},{-10,8},{0,-1},{0,-1},{10,3},
+    {-10,8},{0,3},{0,-1},{0,-1},{-10,6},{0,-1},{10,0},{10,3},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,0},{0,-1},{0,8},{0,-1},{0,-1},{10,2},{-10,6},{0,6},{0,-1},{0,-1},{0,-1},{10,8},
+    {0,-1},{0,-1},{0,-1},{0,6},{0,-1},{-10,8},{-10,6},{10,6},{0,-1},{10,0},{0,-1},{10,5},
+    {0,-1},{-10,6},{0,-1},{0,-1},{0,5},{0,-1},{10,0},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,5},{10,5},{0,-1},{10,0},{0,-1},{10,5},{0,-1},{0,5},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{10,5},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},
+    {0,6},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,3},
+    {10,0},{0,-1},{10,1},{0,-1},{0,-1},{10,4},{-10,0},{-10,3},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},
+    {0,2},{0,-1},{-10,6},{0,-1},{0,-1},{10,4},{-10,8},{0,8},{0,-1},{0,-1},{0,-1},{10,6},
+    {0,-1},{0,-1},{0,-1},{0,8},{0,-1},{-10,6},{0,0},{0,4},{0,-1},{0,4},{0,-1},{-10,4},
+    {0,-1},{-10,8},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},
+    {0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{10,1},
+    {0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,6},{0,1},{0,-1},{-10,1},{0,-1},{0,-1},{-10,-1},{0,0},{0,8},{0,-1},
+    {0,2},{0,-1},{-10,8},{0,-1},{0,-1},{10,2},{-10,8},{0,6},{0,-1},{0,-1},{0,-1},{10,8},
+    {0,-1},{0,-1},{0,-1},{0,8},{0,-1},{-10,8},{0,6},{10,6},{0,-1},{10,0},{0,-1},{10,3},
+    {0,-1},{-10,6},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,8},{10,0},{0,-1},{10,1},
+    {0,-1},{0,-1},{10,6},{10,0},{10,6},{0,-1},{-10,8},{0,2},{0,-1},{10,0},{0,-1},{10,2},
+    {0,-1},{-10,8},{0,-1},{0,8},{0,-1},{-10,8},{0,-1},{0,-1},{10,6},{-10,8},{0,8},{0,-1},
+    {0,-1},{0,6},{0,-1},{0,6},{10,6},{0,-1},{0,-1},{0,-1},{0,-1},{-10,4},{0,4},{0,-1},
+    {10,4},{0,-1},{-10,4},{0,-1},{-10,6},{0,-1},{0,4},{0,-1},{-10,4},{0,-1},{0,-1},{10,4},
+    {-10,6},{0,4},{0,-1},{0,-1},{-10,8},{0,-1},{-10,4},{10,4},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,0},{0,-1},{0,1},{0,-1},{0,-1},{0,4},{-10,6},{0,6},{0,-1},{0,-1},{0,-1},{0,4},
+    {0,-1},{0,-1},{0,-1},{0,6},{0,-1},{-10,6},{-10,8},{10,6},{0,-1},{10,4},{0,-1},{-10,4},
+    {0,-1},{-10,6},{0,-1},{0,-1},{-10,4},{0,-1},{-10,4},{10,4},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,4},{10,4},{0,-1},{10,4},{0,-1},{-10,4},{0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,1},{0,-1},{0,-1},{-10,-1},
+    {-10,6},{0,8},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{0,6},{0,-1},{-10,6},
+    {-10,1},{10,8},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{-10,8},{0,-1},{0,-1},{0,-1},{0,1},
+    {0,-1},{0,-1},{0,-1},{10,2},{0,-1},{0,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,6},{10,1},{0,-1},{-10,1},{0,-1},{0,-1},{-10,-1},{10,0},{10,8},{0,-1},
+    {-10,0},{-10,1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{-10,2},{0,-1},{-10,0},{0,-1},{-10,1},
+    {0,-1},{0,-1},{-10,-1},{-10,0},{-10,6},{0,-1},{0,-1},{-10,1},{0,-1},{-10,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,3},{0,-1},{10,0},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,3},{10,3},{0,-1},{10,0},{0,-1},{10,3},{0,-1},{0,3},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{10,3},{0,-1},{0,-1},{0,-1},{0,-1},{-10,6},{0,6},{0,-1},{10,2},{0,-1},{0,8},
+    {0,-1},{-10,6},{0,-1},{0,0},{0,-1},{0,8},{0,-1},{0,-1},{10,8},{-10,6},{0,6},{0,-1},
+    {0,-1},{-10,6},{0,-1},{10,0},{10,6},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{10,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{0,8},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,3},{10,8},{0,-1},{-10,1},{0,-1},{0,-1},{-10,3},
+    {-10,0},{-10,3},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},
+    {0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{-10,0},{0,-1},{-10,1},{0,-1},{0,-1},{-10,2},
+    {-10,2},{0,8},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,4},
+    {-10,1},{0,8},{0,-1},{-10,0},{0,-1},{-10,4},{0,-1},{-10,8},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{-10,0},{0,-1},{-10,1},
+    {0,-1},{0,-1},{-10,-1},{-10,8},{0,8},{0,-1},{0,8},{0,-1},{-10,8},{0,-1},{0,-1},{10,8},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{10,8},{0,-1},{0,-1},{0,-1},{0,8},{0,-1},{-10,8},
+    {-10,0},{-10,1},{0,-1},{10,8},{0,-1},{-10,8},{0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{10,8},
+    {0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,8},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,8},{-10,0},{0,-1},{-10,8},{0,-1},{0,-1},{10,8},{-10,0},{-10,-1},{0,-1},
+    {-10,8},{10,5},{0,-1},{10,5},{0,-1},{-10,8},{0,-1},{-10,8},{0,-1},{10,5},{0,-1},{-10,8},
+    {0,-1},{0,-1},{10,5},{-10,8},{10,5},{0,-1},{0,-1},{-10,8},{0,-1},{-10,8},{10,5},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},
+    {0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{-10,1},
+    {0,-1},{0,-1},{0,-1},{0,8},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,4},{0,8},{0,-1},{-10,1},{0,-1},{0,-1},{-10,4},{-10,8},{0,8},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,-1},{10,8},
+    {0,-1},{0,-1},{0,-1},{0,8},{0,-1},{-10,8},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,8},{0,8},{0,-1},{-10,8},{0,-1},{0,-1},{10,8},{-10,0},{-10,3},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},
+    {10,0},{0,-1},{10,-1},{0,8},{0,-1},{-10,8},{0,-1},{0,-1},{10,8},{-10,8},{0,8},{0,-1},
+    {0,-1},{0,-1},{10,8},{0,-1},{0,-1},{0,-1},{0,8},{0,-1},{-10,8},{-10,8},{0,8},{0,-1},
+    {0,8},{0,-1},{-10,8},{0,-1},{-10,8},{0,-1},{10,8},{0,-1},{-10,1},{0,-1},{0,-1},{-10,2},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,3},
+    {-10,8},{10,8},{0,-1},{10,8},{0,-1},{-10,4},{0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{10,8},
+    {0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,4},{10,8},{0,-1},{-10,8},{0,-1},{0,-1},{10,8},{-10,0},{-10,-1},{0,-1},
+    {-10,4},{10,4},{0,-1},{10,4},{0,-1},{-10,4},{0,-1},{-10,4},{0,-1},{10,4},{0,-1},{-10,4},
+    {0,-1},{0,-1},{10,4},{-10,4},{10,4},{0,-1},{0,-1},{-10,8},{0,-1},{-10,4},{10,4},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{10,8},{0,-1},{-10,1},
+    {0,-1},{0,-1},{-10,-1},{-10,8},{10,8},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{-10,0},{0,-1},{-10,1},
+    {0,-1},{0,-1},{-10,-1},{-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{-10,1},{10,8},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{-10,8},{0,-1},
+    {-10,3},{10,3},{0,-1},{10,3},{0,-1},{-10,8},{0,-1},{-10,3},{0,-1},{10,3},{0,-1},{-10,8},
+    {0,-1},{0,-1},{10,3},{-10,3},{10,3},{0,-1},{0,-1},{-10,3},{0,-1},{-10,8},{10,3},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,8},{0,-1},{0,-1},{10,8},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{10,8},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,8},{-10,0},{-10,-1},{0,-1},
+    {10,8},{0,-1},{-10,8},{0,-1},{-10,-1},{0,-1},{0,-1},{10,-1},{0,-1},{10,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{10,-1},{10,-1},{0,-1},{10,-1},{0,-1},{10,-1},{0,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,0},{0,1},{0,-1},
+    {10,4},{0,-1},{-10,4},{0,-1},{0,2},{0,-1},{0,0},{0,-1},{0,3},{0,-1},{0,-1},{10,3},
+    {0,0},{0,4},{0,-1},{0,-1},{-10,4},{0,-1},{-10,4},{10,4},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,1},{0,-1},{-10,4},{0,-1},{0,-1},{10,4},{0,0},{0,4},{0,-1},{0,-1},{0,-1},{0,4},
+    {0,-1},{0,-1},{0,-1},{0,4},{0,-1},{-10,5},{-10,4},{10,4},{0,-1},{10,4},{0,-1},{-10,4},
+    {0,-1},{-10,4},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{-10,1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{-10,8},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,1},{0,-1},{-10,1},{0,-1},{0,-1},{-10,-1},
+    {0,0},{0,8},{0,-1},{0,-1},{0,-1},{10,3},{0,-1},{0,-1},{0,-1},{0,0},{0,-1},{0,3},
+    {-10,0},{-10,1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{-10,1},
+    {0,-1},{0,-1},{0,-1},{0,5},{0,-1},{-10,5},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,5},{-10,0},{0,-1},{-10,1},{0,-1},{0,-1},{-10,-1},{-10,0},{-10,5},{0,-1},
+    {-10,0},{-10,1},{0,-1},{-10,-1},{0,-1},{10,-1},{0,-1},{-10,8},{0,-1},{10,0},{0,-1},{10,-1},
+    {0,-1},{0,-1},{10,-1},{0,0},{0,8},{0,-1},{0,-1},{-10,1},{0,-1},{-10,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,2},{0,-1},{10,0},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,0},{0,1},{0,-1},{10,0},{0,-1},{10,3},{0,-1},{0,3},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,2},{10,2},{0,-1},{10,0},{0,-1},{10,2},
+    {0,-1},{0,2},{0,-1},{0,0},{0,-1},{0,8},{0,-1},{0,-1},{10,8},{0,0},{0,5},{0,-1},
+    {0,-1},{10,-1},{0,-1},{10,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {10,0},{0,-1},{10,1},{0,-1},{0,-1},{10,3},{0,0},{0,4},{0,-1},{0,-1},{0,-1},{10,3},
+    {0,-1},{0,-1},{0,-1},{0,8},{0,-1},{-10,3},{-10,4},{10,4},{0,-1},{10,4},{0,-1},{-10,4},
+    {0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{10,4},{0,-1},{0,-1},{0,-1},{0,4},{0,-1},{-10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,4},{10,4},{0,-1},{-10,4},
+    {0,-1},{0,-1},{10,4},{-10,4},{10,4},{0,-1},{-10,0},{-10,1},{0,-1},{10,0},{0,-1},{10,-1},
+    {0,-1},{-10,8},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,-1},{10,-1},{-10,8},{0,8},{0,-1},
+    {0,-1},{-10,4},{0,-1},{-10,4},{10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,3},
+    {0,-1},{0,-1},{0,-1},{0,3},{0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,3},{-10,0},{0,-1},{-10,1},{0,-1},{0,-1},{-10,-1},{-10,0},{-10,3},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {-10,-1},{0,-1},{10,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,-1},{10,-1},{0,0},{0,8},{0,-1},
+    {0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{-10,0},{-10,1},{0,-1},
+    {-10,-1},{0,-1},{10,-1},{0,-1},{-10,8},{0,-1},{0,2},{10,2},{0,-1},{10,0},{0,-1},{10,2},
+    {0,-1},{0,2},{0,-1},{0,8},{0,-1},{-10,8},{0,-1},{0,-1},{10,3},{-10,8},{0,8},{0,-1},
+    {0,-1},{10,-1},{0,-1},{10,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,1},
+    {0,-1},{0,-1},{10,2},{0,2},{10,2},{0,-1},{0,-1},{0,-1},{10,8},{0,-1},{0,-1},{0,-1},
+    {0,8},{0,-1},{-10,8},{10,-1},{10,-1},{0,-1},{10,-1},{0,-1},{10,-1},{0,-1},{10,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{10,0},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},
+    {10,0},{0,-1},{10,-1},{0,-1},{-10,8},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,1},{0,1},{0,-1},{-10,0},{0,-1},{-10,4},{0,-1},{0,3},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,1},{10,2},{0,-1},{0,4},{0,-1},{-10,4},
+    {0,-1},{0,2},{0,-1},{0,0},{0,-1},{0,1},{0,-1},{0,-1},{0,4},{0,0},{0,4},{0,-1},
+    {0,-1},{10,1},{0,-1},{-10,4},{10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{-10,1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{-10,8},{0,-1},{0,1},{0,-1},{-10,1},
+    {0,-1},{0,-1},{-10,-1},{0,0},{0,8},{0,-1},{0,-1},{-10,1},{0,-1},{-10,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,1},{0,-1},{-10,1},{0,-1},{0,-1},{-10,-1},{0,0},{0,8},{0,-1},
+    {0,-1},{0,-1},{0,1},{0,-1},{0,-1},{0,-1},{0,0},{0,-1},{0,8},{-10,1},{10,8},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{0,-1},{-10,8},{0,-1},{0,-1},{-10,1},{0,-1},{-10,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{-10,-1},{0,-1},{10,-1},{0,-1},{-10,8},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,2},{0,-1},{0,2},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,0},{0,1},{0,-1},
+    {0,0},{0,-1},{0,8},{0,-1},{0,8},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,0},{0,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{0,0},{0,-1},{0,6},{0,-1},{-10,4},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,6},{0,-1},{0,-1},{0,-1},{0,-1},{-10,4},{10,6},{0,-1},
+    {0,0},{0,-1},{0,4},{0,-1},{-10,4},{0,-1},{0,4},{0,-1},{-10,4},{0,-1},{0,-1},{10,8},
+    {-10,4},{10,4},{0,-1},{0,-1},{-10,4},{0,-1},{0,4},{10,6},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{0,0},{0,-1},{0,3},{0,-1},{-10,2},{0,-1},
+    {-10,0},{0,-1},{-10,3},{0,-1},{0,-1},{10,6},{-10,0},{-10,3},{0,-1},{0,-1},{-10,3},{0,-1},
+    {0,3},{10,8},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},{0,-1},{0,-1},{0,5},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,5},
+    {-10,0},{-10,1},{0,-1},{0,5},{0,-1},{-10,5},{0,-1},{-10,5},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,6},
+    {0,-1},{-10,5},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,8},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,1},{10,1},{0,-1},{0,0},{0,-1},{0,8},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,6},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,4},{0,4},{0,-1},
+    {0,0},{0,-1},{0,3},{0,-1},{-10,4},{0,-1},{10,8},{0,-1},{-10,3},{0,-1},{0,-1},{10,8},
+    {-10,4},{10,4},{0,-1},{0,-1},{-10,3},{0,-1},{0,3},{10,6},{0,-1},{0,-1},{0,-1},{0,-1},
+    {10,4},{0,-1},{-10,2},{0,-1},{0,-1},{0,4},{-10,4},{10,4},{0,-1},{0,-1},{0,-1},{-10,1},
+    {0,-1},{0,-1},{0,-1},{10,4},{0,-1},{-10,4},{-10,0},{-10,1},{0,-1},{0,4},{0,-1},{-10,4},
+    {0,-1},{-10,4},{0,-1},{0,-1},{-10,2},{0,-1},{-10,2},{0,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,6},{0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,4},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},{0,-1},{0,-1},{0,3},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,3},
+    {-10,0},{-10,1},{0,-1},{0,3},{0,-1},{-10,3},{0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{-10,-1},
+    {0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},
+    {-10,2},{0,8},{0,-1},{10,6},{0,-1},{0,6},{0,-1},{-10,2},{0,-1},{-10,0},{0,-1},{-10,6},
+    {0,-1},{0,-1},{10,6},{-10,0},{-10,6},{0,-1},{0,-1},{-10,8},{0,-1},{0,0},{0,8},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,1},{0,-1},{-10,2},{0,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,1},{10,1},{0,-1},{-10,0},{0,-1},{-10,8},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,6},{0,-1},{0,-1},{0,-1},{0,-1},{10,0},{10,1},{0,-1},{10,6},{0,-1},{0,8},
+    {0,-1},{10,-1},{0,-1},{10,1},{0,-1},{-10,8},{0,-1},{0,-1},{10,8},{10,-1},{10,-1},{0,-1},
+    {0,-1},{-10,6},{0,-1},{0,6},{10,6},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{-10,1},{0,-1},{0,0},{0,-1},{0,4},{0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,6},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,6},
+    {0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,8},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{-10,1},{0,-1},{10,8},{0,-1},{0,2},{0,-1},{-10,2},{0,-1},{0,6},{0,-1},{-10,6},
+    {0,-1},{0,-1},{0,6},{-10,0},{-10,6},{0,-1},{0,-1},{-10,6},{0,-1},{0,8},{10,8},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{0,0},{0,-1},{0,2},{0,-1},{-10,3},{0,-1},
+    {0,4},{0,-1},{-10,4},{0,-1},{0,-1},{0,4},{-10,4},{10,4},{0,-1},{0,-1},{-10,3},{0,-1},
+    {0,0},{0,3},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,4},{0,-1},{0,-1},{0,2},
+    {-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{10,4},{0,-1},{0,-1},{0,-1},{10,4},{0,-1},{-10,4},
+    {-10,0},{-10,-1},{0,-1},{0,0},{0,-1},{0,4},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,2},{0,-1},
+    {-10,2},{0,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,4},
+    {0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,4},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{0,-1},{-10,2},{0,-1},{0,-1},{0,2},{-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{-10,-1},
+    {0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{-10,0},{-10,1},{0,-1},{0,0},{0,-1},{0,3},
+    {0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{-10,0},{0,-1},{-10,5},
+    {0,-1},{0,-1},{0,5},{-10,0},{-10,-1},{0,-1},{-10,0},{-10,1},{0,-1},{0,2},{0,-1},{-10,2},
+    {0,-1},{-10,2},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},
+    {0,-1},{-10,8},{0,-1},{0,0},{0,8},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,1},{10,1},{0,-1},{0,0},{0,-1},{0,8},
+    {0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{0,0},{0,-1},{0,8},{0,-1},{-10,-1},{0,-1},{10,0},{0,-1},{10,1},
+    {0,-1},{0,-1},{10,8},{10,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,4},{0,-1},{-10,2},{0,-1},{0,-1},{0,2},
+    {-10,4},{10,4},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{10,4},{0,-1},{-10,4},
+    {-10,3},{0,3},{0,-1},{0,0},{0,-1},{0,3},{0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{10,4},
+    {0,-1},{0,-1},{0,-1},{10,4},{0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,4},{-10,0},{0,-1},{-10,4},{0,-1},{0,-1},{0,4},{-10,0},{-10,-1},{0,-1},
+    {-10,2},{0,2},{0,-1},{0,2},{0,-1},{-10,2},{0,-1},{-10,4},{0,-1},{-10,0},{0,-1},{-10,1},
+    {0,-1},{0,-1},{-10,4},{-10,4},{10,4},{0,-1},{0,-1},{0,1},{0,-1},{0,0},{0,4},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,3},{0,-1},{-10,3},
+    {0,-1},{0,-1},{0,3},{-10,0},{-10,3},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{10,-1},{0,2},{0,-1},{-10,2},
+    {0,-1},{0,-1},{0,2},{-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{0,0},{0,8},{0,-1},{0,0},{0,-1},{0,8},{0,-1},{-10,8},{0,-1},
+    {0,1},{10,1},{0,-1},{0,0},{0,-1},{0,8},{0,-1},{10,-1},{0,-1},{10,1},{0,-1},{-10,8},
+    {0,-1},{0,-1},{10,8},{10,-1},{10,-1},{0,-1},{0,-1},{-10,3},{0,-1},{0,0},{0,3},{0,-1},
+    {0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,1},{0,-1},{0,-1},{10,8},{10,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{10,-1},{-10,0},{-10,-1},{0,-1},
+    {0,0},{0,-1},{0,8},{0,-1},{-10,-1},{0,-1},{0,-1},{0,1},{0,-1},{-10,2},{0,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,1},{10,1},{0,-1},{-10,0},{0,-1},{-10,8},{0,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,8},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,4},
+    {0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{0,0},{0,-1},{0,2},{0,-1},{-10,-1},{0,-1},{-10,0},{0,-1},{-10,4},
+    {0,-1},{0,-1},{0,4},{-10,0},{-10,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{0,2},{0,-1},{-10,2},
+    {0,-1},{-10,2},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},
+    {0,-1},{-10,3},{0,-1},{0,8},{10,8},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},
+    {0,-1},{0,-1},{0,2},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{-10,0},{-10,-1},{0,-1},{10,8},{0,-1},{0,8},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,8},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,0},{0,-1},{0,8},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{-10,8},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,8},{10,1},{0,-1},{10,8},{0,-1},{0,8},{0,-1},{10,4},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,8},{0,-1},
+    {0,8},{10,8},{0,-1},{0,-1},{0,-1},{0,-1},{-10,8},{10,8},{0,-1},{10,0},{0,-1},{10,3},
+    {0,-1},{-10,8},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,8},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,5},{10,8},{0,-1},{10,8},{0,-1},{-10,5},{0,-1},{-10,5},{0,-1},{10,8},{0,-1},{-10,5},
+    {0,-1},{0,-1},{10,8},{-10,5},{10,8},{0,-1},{0,-1},{-10,5},{0,-1},{-10,5},{10,8},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,8},{0,-1},{-10,8},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,8},{10,8},{0,-1},{10,8},{0,-1},{-10,8},{0,-1},{-10,8},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{10,3},{0,-1},{0,-1},{0,-1},{0,-1},{-10,4},{10,4},{0,-1},{10,4},{0,-1},{-10,4},
+    {0,-1},{-10,4},{0,-1},{10,8},{0,-1},{-10,4},{0,-1},{0,-1},{10,8},{-10,4},{10,4},{0,-1},
+    {0,-1},{-10,4},{0,-1},{-10,4},{10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,3},{10,8},{0,-1},{10,3},{0,-1},{-10,3},{0,-1},{-10,3},{0,-1},{10,8},{0,-1},{-10,3},
+    {0,-1},{0,-1},{10,3},{-10,3},{10,8},{0,-1},{0,-1},{-10,3},{0,-1},{-10,3},{10,8},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,8},{0,-1},{10,0},{10,8},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,8},{10,8},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{-10,8},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,8},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{10,1},{0,-1},{10,0},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,8},{10,1},{0,-1},
+    {10,8},{0,-1},{-10,8},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,8},{0,-1},{0,8},{10,8},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,8},{10,8},{0,-1},{10,8},{0,-1},{0,8},{0,-1},{-10,8},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,8},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,4},{0,-1},{-10,2},
+    {0,-1},{0,-1},{0,4},{-10,2},{0,4},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{0,-1},{-10,3},{-10,0},{-10,1},{0,-1},{0,4},{0,-1},{-10,7},{0,-1},{-10,3},{0,-1},
+    {0,-1},{0,-1},{0,2},{0,-1},{0,-1},{0,-1},{0,4},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,4},{0,0},{0,-1},{0,1},{0,-1},{0,-1},{0,4},
+    {-10,0},{-10,4},{0,-1},{-10,2},{0,4},{0,-1},{0,4},{0,-1},{-10,6},{0,-1},{-10,2},{0,-1},
+    {-10,0},{0,-1},{-10,5},{0,-1},{0,-1},{10,5},{-10,0},{-10,4},{0,-1},{0,-1},{-10,4},{0,-1},
+    {-10,4},{10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,2},{0,-1},{0,-1},{0,-1},
+    {-10,0},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,3},
+    {0,0},{0,-1},{0,1},{0,-1},{0,-1},{0,7},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},
+    {-10,0},{0,-1},{-10,6},{0,-1},{0,-1},{10,6},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{10,6},
+    {0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,5},{-10,0},{-10,-1},{0,-1},{-10,0},{0,-1},{-10,7},
+    {0,-1},{-10,-1},{0,-1},{0,0},{0,1},{0,-1},{0,0},{0,-1},{0,2},{0,-1},{0,7},{0,-1},
+    {0,5},{0,-1},{-10,5},{0,-1},{0,-1},{0,5},{-10,5},{10,5},{0,-1},{0,-1},{-10,6},{0,-1},
+    {0,6},{10,3},{0,-1},{0,-1},{0,-1},{0,-1},{0,0},{0,-1},{0,1},{0,-1},{0,-1},{0,2},
+    {0,7},{10,6},{0,-1},{0,-1},{0,-1},{0,5},{0,-1},{0,-1},{0,-1},{10,7},{0,-1},{-10,5},
+    {-10,6},{10,6},{0,-1},{10,6},{0,-1},{0,6},{0,-1},{-10,6},{0,-1},{0,-1},{0,5},{0,-1},
+    {0,5},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,5},{10,5},{0,-1},{10,5},{0,-1},{-10,5},
+    {0,-1},{-10,5},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,5},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{10,0},{0,-1},{10,1},{0,-1},{0,-1},{10,6},
+    {10,0},{10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},
+    {0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{0,2},{0,-1},{-10,2},{0,-1},{0,-1},{10,6},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},
+    {0,0},{0,4},{0,-1},{10,6},{0,-1},{0,6},{0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{10,0},{0,-1},{10,1},
+    {0,-1},{0,-1},{10,6},{-10,0},{-10,-1},{0,-1},{0,2},{0,-1},{-10,2},{0,-1},{0,-1},{0,2},
+    {-10,2},{10,2},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},
+    {0,6},{10,1},{0,-1},{10,6},{0,-1},{0,6},{0,-1},{10,3},{0,-1},{0,-1},{0,-1},{10,2},
+    {0,-1},{0,-1},{0,-1},{10,2},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{10,0},{0,-1},{10,1},{0,-1},{0,-1},{10,6},{10,0},{10,6},{0,-1},
+    {-10,2},{0,2},{0,-1},{0,2},{0,-1},{-10,2},{0,-1},{-10,2},{0,-1},{-10,-1},{0,-1},{-10,-1},
+    {0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},{0,-1},{0,6},{0,-1},{0,6},{10,6},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,4},{0,4},{0,-1},{0,4},{0,-1},{-10,7},{0,-1},{-10,3},{0,-1},
+    {0,4},{0,-1},{-10,6},{0,-1},{0,-1},{10,3},{-10,4},{10,4},{0,-1},{0,-1},{-10,3},{0,-1},
+    {-10,3},{10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,0},{0,-1},{0,1},{0,-1},{0,-1},{0,4},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,4},{0,-1},{0,-1},{0,-1},{0,4},{0,-1},{-10,6},
+    {-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,7},{0,-1},{-10,4},{0,-1},{0,-1},{-10,4},{0,-1},
+    {-10,4},{10,4},{0,-1},{0,-1},{0,-1},{0,-1},{-10,4},{10,4},{0,-1},{10,0},{0,-1},{10,4},
+    {0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{0,-1},{-10,6},{0,-1},{0,-1},{0,7},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,6},
+    {0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,6},{-10,0},{-10,-1},{0,-1},{-10,0},{0,-1},{-10,7},
+    {0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,1},{0,-1},{0,-1},{0,-1},{0,0},{0,-1},{0,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,6},{0,0},{0,-1},{0,1},
+    {0,-1},{0,-1},{0,7},{-10,0},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{-10,0},{0,-1},{-10,6},
+    {0,-1},{-10,-1},{0,-1},{-10,0},{0,-1},{-10,6},{0,-1},{0,-1},{10,6},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,3},{0,-1},
+    {0,3},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,3},{10,1},{0,-1},{10,3},{0,-1},{0,3},
+    {0,-1},{10,3},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,3},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,6},{0,6},{0,-1},{0,0},{0,-1},{0,2},{0,-1},{-10,6},{0,-1},{0,0},{0,-1},{0,1},
+    {0,-1},{0,-1},{0,6},{0,7},{10,7},{0,-1},{0,-1},{-10,6},{0,-1},{-10,6},{10,6},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{10,-1},{0,-1},{10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,3},
+    {-10,0},{0,-1},{-10,7},{0,-1},{0,-1},{0,7},{-10,0},{-10,3},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},
+    {-10,0},{0,-1},{-10,1},{0,-1},{0,-1},{-10,2},{-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{-10,1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,4},{-10,0},{-10,1},{0,-1},{0,7},{0,-1},{-10,7},
+    {0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},
+    {0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{-10,1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{-10,0},{0,-1},{-10,7},{0,-1},{0,-1},{0,7},{-10,0},{-10,-1},{0,-1},
+    {0,7},{0,-1},{-10,2},{0,-1},{0,-1},{0,7},{-10,7},{10,7},{0,-1},{0,-1},{0,-1},{-10,1},
+    {0,-1},{0,-1},{0,-1},{10,7},{0,-1},{-10,5},{-10,0},{-10,1},{0,-1},{0,7},{0,-1},{-10,7},
+    {0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{0,7},{0,-1},{0,-1},{0,-1},{10,7},{0,-1},{-10,7},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,7},{-10,0},{0,-1},{-10,7},
+    {0,-1},{0,-1},{0,7},{-10,0},{-10,-1},{0,-1},{-10,5},{10,5},{0,-1},{10,5},{0,-1},{-10,5},
+    {0,-1},{-10,7},{0,-1},{10,5},{0,-1},{-10,5},{0,-1},{0,-1},{10,5},{-10,5},{10,5},{0,-1},
+    {0,-1},{-10,7},{0,-1},{-10,7},{10,5},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,7},{0,-1},{-10,7},
+    {0,-1},{0,-1},{0,7},{-10,0},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},
+    {10,0},{0,-1},{10,-1},{0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{10,7},{0,-1},{-10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,7},{0,-1},{-10,7},
+    {0,-1},{0,-1},{0,7},{-10,7},{10,7},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{-10,0},{0,-1},{-10,1},
+    {0,-1},{0,-1},{-10,2},{-10,2},{10,7},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{-10,7},{0,7},{0,-1},{0,7},{0,-1},{-10,7},{0,-1},{-10,7},{0,-1},
+    {-10,0},{0,-1},{-10,2},{0,-1},{0,-1},{0,7},{-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{-10,1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,3},{-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,7},
+    {0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{0,7},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,4},{-10,0},{0,-1},{-10,7},
+    {0,-1},{0,-1},{0,7},{-10,0},{-10,-1},{0,-1},{-10,4},{10,4},{0,-1},{10,4},{0,-1},{-10,4},
+    {0,-1},{-10,4},{0,-1},{10,4},{0,-1},{-10,4},{0,-1},{0,-1},{10,4},{-10,4},{10,4},{0,-1},
+    {0,-1},{-10,4},{0,-1},{-10,4},{10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{-10,0},{0,-1},{-10,7},{0,-1},{0,-1},{0,7},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},
+    {10,0},{0,-1},{10,-1},{-10,0},{0,-1},{-10,1},{0,-1},{0,-1},{-10,2},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{-10,0},{-10,-1},{0,-1},
+    {-10,0},{0,-1},{-10,7},{0,-1},{-10,-1},{0,-1},{-10,3},{10,3},{0,-1},{10,3},{0,-1},{-10,7},
+    {0,-1},{-10,3},{0,-1},{10,3},{0,-1},{-10,7},{0,-1},{0,-1},{10,3},{-10,7},{10,3},{0,-1},
+    {0,-1},{-10,3},{0,-1},{-10,3},{10,3},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,7},
+    {0,-1},{0,-1},{0,7},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,7},{0,-1},{0,-1},{0,-1},
+    {10,7},{0,-1},{-10,7},{-10,0},{-10,-1},{0,-1},{-10,0},{0,-1},{-10,7},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{10,-1},{0,-1},{10,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{10,-1},{0,-1},
+    {10,-1},{0,-1},{10,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{0,0},{0,-1},{0,3},{0,-1},{-10,2},{0,-1},
+    {-10,0},{0,-1},{-10,5},{0,-1},{0,-1},{10,3},{-10,0},{-10,3},{0,-1},{0,-1},{-10,4},{0,-1},
+    {-10,4},{10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,4},{0,-1},{-10,5},{0,-1},{0,-1},{0,4},
+    {-10,4},{10,4},{0,-1},{0,-1},{0,-1},{0,5},{0,-1},{0,-1},{0,-1},{0,5},{0,-1},{-10,5},
+    {-10,4},{10,4},{0,-1},{10,4},{0,-1},{-10,4},{0,-1},{-10,4},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{10,0},{0,-1},{10,-1},
+    {0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,0},{0,-1},{0,3},{0,-1},{0,-1},{10,3},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{10,3},
+    {0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,5},{-10,0},{-10,-1},{0,-1},{-10,0},{0,-1},{-10,3},
+    {0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,5},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,5},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,5},{-10,0},{0,-1},{-10,1},
+    {0,-1},{0,-1},{-10,5},{-10,0},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{10,0},{0,-1},{10,-1},
+    {0,-1},{-10,-1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,-1},{10,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},
+    {-10,2},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,5},
+    {0,-1},{-10,5},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,2},{10,1},{0,-1},{10,2},{0,-1},{0,2},{0,-1},{10,2},{0,-1},{0,5},{0,-1},{-10,5},
+    {0,-1},{0,-1},{0,5},{-10,5},{10,7},{0,-1},{0,-1},{10,-1},{0,-1},{10,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},{0,-1},{0,-1},{10,2},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},
+    {-10,4},{10,4},{0,-1},{10,0},{0,-1},{10,3},{0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{-10,1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{10,4},{0,-1},{-10,4},{0,-1},{0,-1},{10,4},{-10,4},{10,4},{0,-1},
+    {-10,0},{-10,1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{-10,2},{0,-1},{-10,-1},{0,-1},{10,-1},
+    {0,-1},{0,-1},{10,-1},{-10,-1},{-10,-1},{0,-1},{0,-1},{-10,4},{0,-1},{10,0},{10,4},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,3},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{-10,0},{0,-1},{-10,3},
+    {0,-1},{0,-1},{10,3},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{10,-1},{10,0},{0,-1},{10,-1},
+    {0,-1},{0,-1},{10,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},
+    {-10,-1},{0,-1},{10,-1},{-10,0},{-10,-1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{-10,-1},{0,-1},
+    {-10,2},{10,2},{0,-1},{10,2},{0,-1},{-10,2},{0,-1},{-10,2},{0,-1},{-10,-1},{0,-1},{-10,-1},
+    {0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},{0,-1},{10,-1},{0,-1},{10,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{10,2},{0,-1},{-10,2},{0,-1},{0,-1},{10,2},{-10,2},{10,2},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{10,-1},{10,-1},{0,-1},
+    {10,-1},{0,-1},{10,-1},{0,-1},{10,-1},{0,-1},{0,-1},{-10,2},{0,-1},{-10,2},{10,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{10,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{0,0},{0,-1},{0,3},
+    {0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,0},{0,4},{0,-1},{0,0},{0,-1},{0,2},{0,-1},{-10,4},{0,-1},{0,0},{0,-1},{0,1},
+    {0,-1},{0,-1},{0,4},{0,0},{0,4},{0,-1},{0,-1},{-10,4},{0,-1},{-10,4},{10,4},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{-10,0},{0,-1},{-10,7},
+    {0,-1},{-10,-1},{0,-1},{0,0},{0,-1},{0,3},{0,-1},{0,-1},{10,3},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,0},{0,-1},{0,1},
+    {0,-1},{0,-1},{0,7},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,1},{0,-1},{0,-1},{0,-1},
+    {0,0},{0,-1},{0,7},{-10,0},{-10,-1},{0,-1},{-10,0},{0,-1},{-10,7},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {10,0},{0,-1},{10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,2},{0,-1},{0,2},{10,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,0},{0,1},{0,-1},{0,0},{0,-1},{0,7},{0,-1},{0,7},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,6},{0,-1},{0,-1},{0,-1},{0,6},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,3},{-10,0},{0,-1},{-10,1},{0,-1},{0,-1},{-10,3},
+    {-10,0},{-10,3},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},
+    {0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{10,6},{0,-1},{-10,6},{0,-1},{0,-1},{10,6},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{10,6},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,5},
+    {-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,4},{0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{10,6},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,6},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,6},{-10,0},{0,-1},{-10,1},
+    {0,-1},{0,-1},{-10,-1},{-10,0},{-10,-1},{0,-1},{0,6},{0,-1},{-10,2},{0,-1},{0,-1},{10,6},
+    {-10,2},{0,6},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,3},
+    {-10,6},{10,6},{0,-1},{10,6},{0,-1},{-10,6},{0,-1},{-10,6},{0,-1},{0,-1},{0,-1},{0,6},
+    {0,-1},{0,-1},{0,-1},{0,6},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,5},{10,6},{0,-1},{-10,6},{0,-1},{0,-1},{10,6},{-10,6},{10,6},{0,-1},
+    {-10,5},{10,5},{0,-1},{10,5},{0,-1},{-10,6},{0,-1},{-10,5},{0,-1},{10,5},{0,-1},{-10,5},
+    {0,-1},{0,-1},{10,5},{-10,5},{10,5},{0,-1},{0,-1},{-10,6},{0,-1},{-10,6},{10,5},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},
+    {0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{10,6},
+    {0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{10,6},{0,-1},{-10,6},{0,-1},{0,-1},{10,6},{-10,0},{-10,4},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,-1},{-10,1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{10,6},{0,-1},{-10,6},{0,-1},{0,-1},{10,6},{-10,6},{10,6},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},
+    {10,0},{0,-1},{10,-1},{-10,0},{0,-1},{-10,2},{0,-1},{0,-1},{10,6},{-10,0},{-10,2},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{-10,6},{10,6},{0,-1},
+    {10,6},{0,-1},{-10,6},{0,-1},{-10,6},{0,-1},{-10,0},{0,-1},{-10,1},{0,-1},{0,-1},{-10,2},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,6},{0,-1},{0,-1},{0,-1},{0,6},{0,-1},{-10,6},
+    {-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,3},{0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{0,6},
+    {0,-1},{0,-1},{0,-1},{0,6},{0,-1},{-10,6},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,6},{-10,0},{0,-1},{-10,1},{0,-1},{0,-1},{-10,4},{-10,0},{-10,4},{0,-1},
+    {-10,4},{10,4},{0,-1},{10,4},{0,-1},{-10,4},{0,-1},{-10,4},{0,-1},{10,4},{0,-1},{-10,6},
+    {0,-1},{0,-1},{10,4},{-10,4},{10,4},{0,-1},{0,-1},{-10,4},{0,-1},{-10,4},{10,4},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,6},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,6},{-10,0},{0,-1},{-10,1},
+    {0,-1},{0,-1},{-10,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{-10,0},{0,-1},{-10,1},
+    {0,-1},{0,-1},{-10,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{10,6},{0,-1},{0,-1},{0,-1},
+    {-10,0},{0,-1},{-10,6},{-10,0},{-10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},
+    {-10,6},{10,3},{0,-1},{10,3},{0,-1},{-10,6},{0,-1},{-10,6},{0,-1},{10,3},{0,-1},{-10,6},
+    {0,-1},{0,-1},{10,3},{-10,6},{10,3},{0,-1},{0,-1},{-10,6},{0,-1},{-10,6},{10,3},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,6},{0,-1},{-10,6},{0,-1},{0,-1},{0,6},{-10,6},{0,6},{0,-1},
+    {0,-1},{0,-1},{0,6},{0,-1},{0,-1},{0,-1},{0,6},{0,-1},{-10,6},{-10,6},{10,6},{0,-1},
+    {10,6},{0,-1},{-10,6},{0,-1},{-10,6},{0,-1},{0,-1},{10,-1},{0,-1},{10,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{10,-1},{10,-1},{0,-1},{10,-1},{0,-1},{10,-1},{0,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{10,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{0,-1},{-10,-1},
+    {0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {-10,-1},{0,-1},{10,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{0,-1},{-10,-1},
+    {0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{10,-1},{-10,-1},{0,-1},{-10,-1},
+    {0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},
+    {-10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{0,-1},{-10,-1},
+    {0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{10,-1},{-10,-1},{0,-1},{-10,-1},
+    {0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {-10,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},
+    {-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},
+    {0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},
+    {-10,-1},{-10,-1},{0,-1},{10,-1},{10,-1},{0,-1},{10,-1},{0,-1},{10,-1},{0,-1},{10,-1},{0,-1},
+    {10,-1},{0,-1},{10,-1},{0,-1},{0,-1},{10,-1},{10,-1},{10,-1},{0,-1},{0,-1},{10,-1},{0,-1},
+    {10,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,1},{0,-1},{0,-1},{10,3},
+    {0,0},{0,4},{0,-1},{0,-1},{0,-1},{10,3},{0,-1},{0,-1},{0,-1},{0,5},{0,-1},{-10,5},
+    {-10,4},{10,4},{0,-1},{10,4},{0,-1},{-10,4},{0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{10,2},
+    {0,-1},{0,-1},{0,-1},{10,2},{0,-1},{0,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,5},{10,0},{0,-1},{10,1},{0,-1},{0,-1},{10,4},{10,0},{10,4},{0,-1},
+    {10,0},{10,4},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{-10,2},{0,-1},{10,0},{0,-1},{10,-1},
+    {0,-1},{0,-1},{10,-1},{-10,0},{-10,4},{0,-1},{0,-1},{-10,4},{0,-1},{-10,4},{10,4},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,3},{-10,0},{0,-1},{-10,1},
+    {0,-1},{0,-1},{-10,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{10,0},{0,-1},{10,-1},
+    {0,-1},{0,-1},{10,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},
+    {10,0},{0,-1},{10,-1},{-10,0},{-10,-1},{0,-1},{-10,-1},{0,-1},{10,-1},{0,-1},{-10,-1},{0,-1},
+    {0,2},{10,2},{0,-1},{10,0},{0,-1},{10,2},{0,-1},{0,2},{0,-1},{0,5},{0,-1},{-10,5},
+    {0,-1},{0,-1},{10,3},{-10,5},{0,5},{0,-1},{0,-1},{10,-1},{0,-1},{10,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{10,2},{0,-1},{0,2},{0,-1},{0,-1},{10,2},{0,2},{10,2},{0,-1},
+    {0,-1},{0,-1},{0,5},{0,-1},{0,-1},{0,-1},{0,5},{0,-1},{-10,5},{10,-1},{10,-1},{0,-1},
+    {10,-1},{0,-1},{10,-1},{0,-1},{10,-1},{0,-1},{0,-1},{10,1},{0,-1},{10,0},{10,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,5},{10,5},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{-10,5},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},
+    {0,-1},{0,-1},{0,-1},{10,2},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{10,0},{0,-1},{10,1},{0,-1},{0,-1},{10,3},{10,0},{10,4},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},
+    {10,0},{0,-1},{10,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,-1},{10,-1},{-10,0},{-10,2},{0,-1},
+    {0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{10,-1},{10,0},{10,4},{0,-1},
+    {10,0},{0,-1},{10,-1},{0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},
+    {0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,-1},{10,-1},
+    {-10,0},{-10,-1},{0,-1},{10,2},{0,-1},{-10,2},{0,-1},{0,-1},{10,2},{-10,2},{10,2},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{10,-1},{10,-1},{0,-1},
+    {10,-1},{0,-1},{10,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},
+    {10,2},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},
+    {10,-1},{0,-1},{10,-1},{0,-1},{0,-1},{10,-1},{10,-1},{10,-1},{0,-1},{-10,2},{10,2},{0,-1},
+    {10,0},{0,-1},{10,-1},{0,-1},{-10,2},{0,-1},{-10,-1},{0,-1},{10,-1},{0,-1},{0,-1},{10,-1},
+    {-10,-1},{-10,-1},{0,-1},{0,-1},{10,-1},{0,-1},{10,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,4},{10,4},{0,-1},{10,4},{0,-1},{-10,4},{0,-1},{-10,4},{0,-1},{10,3},{0,-1},{0,3},
+    {0,-1},{0,-1},{10,3},{0,0},{0,4},{0,-1},{0,-1},{-10,4},{0,-1},{-10,4},{10,4},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,0},{0,-1},{0,1},{0,-1},{0,-1},{0,4},{0,0},{0,4},{0,-1},
+    {0,-1},{0,-1},{0,1},{0,-1},{0,-1},{0,-1},{0,0},{0,-1},{0,4},{-10,4},{10,4},{0,-1},
+    {10,4},{0,-1},{-10,4},{0,-1},{-10,4},{0,-1},{0,-1},{-10,4},{0,-1},{-10,4},{10,4},{0,-1},
+    {0,-1},{0,-1},{0,-1},{10,0},{10,4},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{-10,4},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,1},
+    {0,-1},{0,-1},{-10,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{10,3},{0,-1},{0,-1},{0,-1},
+    {0,0},{0,-1},{0,3},{-10,0},{-10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,1},{0,-1},{0,-1},{0,-1},{0,0},{0,-1},{0,2},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,1},{0,-1},{0,-1},{-10,-1},
+    {-10,0},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{-10,-1},{0,-1},{10,-1},{0,-1},{-10,-1},{0,-1},
+    {10,0},{0,-1},{10,-1},{0,-1},{0,-1},{10,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {-10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{10,0},{10,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,3},{10,3},{0,-1},{10,3},{0,-1},{0,3},{0,-1},{0,3},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,2},{10,2},{0,-1},
+    {10,2},{0,-1},{0,2},{0,-1},{0,2},{0,-1},{0,0},{0,-1},{0,1},{0,-1},{0,-1},{0,-1},
+    {0,0},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{10,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},
+    {10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,2},{0,4},{0,-1},{0,0},{0,-1},{0,2},{0,-1},{-10,4},{0,-1},
+    {-10,0},{0,-1},{-10,4},{0,-1},{0,-1},{0,5},{-10,4},{10,4},{0,-1},{0,-1},{-10,3},{0,-1},
+    {0,0},{0,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,4},{0,-1},{-10,5},{0,-1},{0,-1},{0,2},
+    {-10,4},{10,4},{0,-1},{0,-1},{0,-1},{0,5},{0,-1},{0,-1},{0,-1},{10,4},{0,-1},{-10,4},
+    {-10,0},{-10,1},{0,-1},{0,0},{0,-1},{0,4},{0,-1},{-10,4},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,5},
+    {0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{0,-1},{-10,2},{0,-1},{0,-1},{0,2},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,3},{-10,0},{-10,-1},{0,-1},{0,0},{0,-1},{0,3},
+    {0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,5},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,5},{-10,0},{0,-1},{-10,5},
+    {0,-1},{0,-1},{0,5},{-10,0},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,0},{0,-1},{0,6},
+    {0,-1},{-10,-1},{0,-1},{-10,0},{0,-1},{-10,5},{0,-1},{0,-1},{10,6},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,1},{0,-1},
+    {-10,2},{0,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{10,1},{0,-1},{-10,0},{0,-1},{-10,5},
+    {0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,6},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,1},{10,1},{0,-1},{0,0},{0,-1},{0,2},{0,-1},{10,-1},{0,-1},{10,1},{0,-1},{-10,5},
+    {0,-1},{0,-1},{0,5},{10,-1},{10,-1},{0,-1},{0,-1},{-10,6},{0,-1},{0,6},{10,6},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},{0,-1},{0,-1},{0,2},
+    {-10,2},{10,4},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},
+    {-10,4},{10,4},{0,-1},{0,0},{0,-1},{0,3},{0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{-10,1},
+    {0,-1},{0,-1},{0,-1},{10,4},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{10,4},{0,-1},{-10,4},{0,-1},{0,-1},{0,4},{-10,4},{10,4},{0,-1},
+    {-10,0},{-10,1},{0,-1},{0,2},{0,-1},{-10,2},{0,-1},{-10,2},{0,-1},{-10,-1},{0,-1},{-10,-1},
+    {0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},{0,-1},{-10,4},{0,-1},{0,0},{0,4},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{-10,0},{0,-1},{-10,3},
+    {0,-1},{0,-1},{0,3},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{10,-1},{-10,0},{0,-1},{-10,2},
+    {0,-1},{0,-1},{10,6},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{-10,0},{-10,-1},{0,-1},{0,0},{0,-1},{0,6},{0,-1},{-10,-1},{0,-1},
+    {-10,2},{10,1},{0,-1},{0,2},{0,-1},{-10,2},{0,-1},{10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},
+    {0,-1},{0,-1},{-10,-1},{10,-1},{10,-1},{0,-1},{0,-1},{10,1},{0,-1},{0,6},{10,6},{0,-1},
+    {0,-1},{0,-1},{0,-1},{10,1},{0,-1},{-10,2},{0,-1},{0,-1},{0,2},{10,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{10,-1},{10,0},{10,1},{0,-1},
+    {10,6},{0,-1},{0,6},{0,-1},{10,-1},{0,-1},{0,-1},{-10,2},{0,-1},{-10,2},{0,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,6},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{0,0},{0,-1},{0,3},
+    {0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{-10,1},{0,-1},{0,0},{0,-1},{0,2},{0,-1},{-10,4},{0,-1},{0,0},{0,-1},{0,1},
+    {0,-1},{0,-1},{0,4},{-10,4},{10,4},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,4},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,0},{0,-1},{0,2},
+    {0,-1},{-10,-1},{0,-1},{-10,0},{0,-1},{-10,6},{0,-1},{0,-1},{0,6},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,0},{0,-1},{0,1},
+    {0,-1},{0,-1},{0,2},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,6},{0,-1},{0,-1},{0,-1},
+    {-10,0},{0,-1},{-10,6},{-10,0},{-10,-1},{0,-1},{0,0},{0,-1},{0,6},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {-10,0},{0,-1},{-10,6},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,1},{10,1},{0,-1},{0,0},{0,-1},{0,6},{0,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,6},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,4},{0,-1},{-10,2},{0,-1},{0,-1},{0,2},{-10,4},{10,4},{0,-1},{0,-1},{0,-1},{-10,1},
+    {0,-1},{0,-1},{0,-1},{10,4},{0,-1},{-10,4},{-10,0},{-10,1},{0,-1},{0,0},{0,-1},{0,3},
+    {0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,4},{0,0},{0,-1},{0,1},
+    {0,-1},{0,-1},{0,4},{-10,0},{-10,-1},{0,-1},{-10,2},{10,4},{0,-1},{0,2},{0,-1},{-10,2},
+    {0,-1},{-10,4},{0,-1},{-10,0},{0,-1},{-10,1},{0,-1},{0,-1},{-10,4},{-10,4},{10,4},{0,-1},
+    {0,-1},{-10,4},{0,-1},{0,0},{0,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,2},
+    {0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,0},{0,-1},{0,1},{0,-1},{0,-1},{0,3},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},
+    {10,0},{0,-1},{10,-1},{-10,0},{0,-1},{-10,2},{0,-1},{0,-1},{0,2},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{-10,0},{-10,-1},{0,-1},
+    {0,0},{0,-1},{0,5},{0,-1},{-10,-1},{0,-1},{0,1},{10,1},{0,-1},{0,0},{0,-1},{0,2},
+    {0,-1},{10,-1},{0,-1},{10,1},{0,-1},{-10,5},{0,-1},{0,-1},{0,5},{10,-1},{10,-1},{0,-1},
+    {0,-1},{-10,3},{0,-1},{0,0},{0,3},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{0,1},
+    {0,-1},{0,-1},{0,2},{10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},
+    {10,-1},{0,-1},{10,-1},{-10,0},{-10,-1},{0,-1},{0,0},{0,-1},{0,5},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{10,1},{0,-1},{0,5},{10,5},{0,-1},{0,-1},{0,-1},{0,-1},{-10,5},{10,1},{0,-1},
+    {10,5},{0,-1},{-10,5},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,5},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,2},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{-10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{10,1},{0,-1},{0,1},
+    {0,-1},{0,-1},{0,3},{10,0},{10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{0,2},{0,-1},{-10,2},
+    {0,-1},{0,-1},{0,2},{-10,2},{10,4},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{0,0},{0,4},{0,-1},{0,0},{0,-1},{0,4},{0,-1},{-10,4},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},
+    {10,0},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,2},{0,-1},{0,-1},{0,-1},
+    {-10,0},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},
+    {0,0},{0,-1},{0,1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{10,1},{0,-1},{-10,2},
+    {0,-1},{0,-1},{0,2},{10,-1},{10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {10,-1},{0,-1},{10,-1},{0,1},{10,1},{0,-1},{0,0},{0,-1},{0,3},{0,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{10,1},{0,-1},{0,1},{0,-1},{0,-1},{0,-1},
+    {10,-1},{-10,-1},{0,-1},{-10,2},{10,1},{0,-1},{0,2},{0,-1},{-10,2},{0,-1},{10,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},{10,-1},{10,-1},{0,-1},{0,-1},{0,1},{0,-1},
+    {0,0},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{0,0},{0,-1},{0,2},
+    {0,-1},{-10,3},{0,-1},{10,4},{0,-1},{-10,4},{0,-1},{0,-1},{0,4},{-10,4},{10,4},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,3},{0,-1},{0,-1},{0,-1},{0,-1},{0,0},{0,-1},{0,1},
+    {0,-1},{0,-1},{0,2},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,4},{0,-1},{0,-1},{0,-1},
+    {10,4},{0,-1},{-10,4},{-10,0},{-10,-1},{0,-1},{0,0},{0,-1},{0,4},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{-10,4},{0,-1},{-10,4},{10,4},{0,-1},{0,-1},{0,-1},{0,-1},{-10,4},{10,4},{0,-1},
+    {10,4},{0,-1},{-10,4},{0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,4},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},{0,-1},{0,-1},{0,2},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{-10,0},{-10,-1},{0,-1},
+    {0,0},{0,-1},{0,3},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,2},{0,-1},{0,-1},{0,-1},
+    {-10,0},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},
+    {0,0},{0,-1},{0,1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {-10,0},{0,-1},{-10,2},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},
+    {-10,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,3},{0,-1},{0,3},{10,3},{0,-1},{0,-1},{0,-1},{0,-1},{10,0},{10,1},{0,-1},
+    {10,3},{0,-1},{0,3},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,3},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,0},{0,-1},{0,2},{0,-1},{-10,-1},{0,-1},
+    {10,1},{0,-1},{0,1},{0,-1},{0,-1},{0,-1},{10,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,5},
+    {0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,1},{10,4},{0,-1},{-10,0},{0,-1},{-10,5},{0,-1},{-10,4},{0,-1},{-10,0},{0,-1},{-10,5},
+    {0,-1},{0,-1},{0,5},{-10,4},{10,4},{0,-1},{0,-1},{-10,4},{0,-1},{-10,4},{10,4},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,0},{0,-1},{0,3},
+    {0,-1},{-10,-1},{0,-1},{-10,0},{0,-1},{-10,5},{0,-1},{0,-1},{10,3},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,5},
+    {0,-1},{0,-1},{0,5},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,5},{0,-1},{0,-1},{0,-1},
+    {-10,0},{0,-1},{-10,5},{-10,0},{-10,-1},{0,-1},{-10,0},{0,-1},{-10,5},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {10,0},{0,-1},{10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{-10,2},{10,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,1},{10,1},{0,-1},{-10,0},{0,-1},{-10,5},{0,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,2},{0,-1},{-10,2},{0,-1},{-10,-1},{0,-1},{-10,-1},
+    {0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},{0,-1},{-10,4},{0,-1},{-10,4},{10,4},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,1},{0,-1},{0,-1},{-10,2},{-10,2},{10,4},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{-10,4},{10,4},{0,-1},
+    {10,4},{0,-1},{-10,4},{0,-1},{-10,4},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{10,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},
+    {0,-1},{0,-1},{10,3},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{-10,0},{-10,-1},{0,-1},{-10,0},{0,-1},{-10,3},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},
+    {-10,-1},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{-10,-1},{0,-1},
+    {-10,-1},{0,-1},{10,-1},{0,-1},{0,-1},{10,-1},{-10,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{-10,2},{10,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{10,1},{0,-1},
+    {10,2},{0,-1},{-10,2},{0,-1},{10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},
+    {10,-1},{10,-1},{0,-1},{0,-1},{10,-1},{0,-1},{10,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {-10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{0,0},{0,-1},{0,4},{0,-1},{-10,4},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,0},{0,-1},{0,3},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,0},{0,-1},{0,2},{0,-1},{-10,-1},{0,-1},
+    {0,0},{0,-1},{0,1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{-10,2},{10,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,4},{0,-1},{-10,6},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{10,3},{0,-1},{0,-1},{0,-1},{0,-1},{-10,6},{10,6},{0,-1},
+    {10,2},{0,-1},{-10,4},{0,-1},{-10,4},{0,-1},{0,6},{0,-1},{-10,4},{0,-1},{0,-1},{10,4},
+    {-10,4},{0,6},{0,-1},{0,-1},{-10,5},{0,-1},{10,0},{10,5},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,0},{0,2},{0,-1},{0,7},{0,-1},{-10,2},{0,-1},{-10,3},{0,-1},
+    {0,6},{0,-1},{-10,1},{0,-1},{0,-1},{-10,3},{-10,3},{0,6},{0,-1},{0,-1},{0,5},{0,-1},
+    {-10,5},{10,5},{0,-1},{0,-1},{0,-1},{0,-1},{0,5},{0,-1},{-10,1},{0,-1},{0,-1},{-10,2},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,5},
+    {-10,5},{10,5},{0,-1},{10,5},{0,-1},{-10,5},{0,-1},{-10,5},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,6},
+    {0,-1},{-10,6},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,7},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{-10,1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{-10,6},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,6},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,0},{0,3},{0,-1},
+    {10,6},{0,-1},{-10,4},{0,-1},{-10,3},{0,-1},{10,6},{0,-1},{-10,4},{0,-1},{0,-1},{10,3},
+    {-10,4},{10,7},{0,-1},{0,-1},{-10,3},{0,-1},{-10,4},{10,6},{0,-1},{0,-1},{0,-1},{0,-1},
+    {10,4},{0,-1},{-10,4},{0,-1},{0,-1},{10,4},{-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{10,4},
+    {0,-1},{0,-1},{0,-1},{10,4},{0,-1},{-10,4},{-10,0},{-10,1},{0,-1},{10,4},{0,-1},{-10,4},
+    {0,-1},{-10,4},{0,-1},{0,-1},{0,1},{0,-1},{0,0},{0,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,0},{0,1},{0,-1},{10,0},{0,-1},{10,4},{0,-1},{0,4},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,3},{0,-1},{-10,1},{0,-1},{0,-1},{-10,2},
+    {-10,2},{0,3},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,3},
+    {-10,1},{0,3},{0,-1},{-10,0},{0,-1},{-10,3},{0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{-10,-1},
+    {0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},
+    {0,0},{0,1},{0,-1},{0,7},{0,-1},{-10,6},{0,-1},{0,2},{0,-1},{10,6},{0,-1},{-10,6},
+    {0,-1},{0,-1},{10,6},{-10,6},{0,6},{0,-1},{0,-1},{0,1},{0,-1},{-10,7},{0,7},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,1},{0,-1},{0,0},{0,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,0},{0,1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,7},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,6},{0,-1},{0,-1},{0,-1},{0,-1},{10,0},{10,6},{0,-1},{10,0},{0,-1},{10,-1},
+    {0,-1},{-10,6},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,-1},{10,-1},{10,0},{10,7},{0,-1},
+    {0,-1},{-10,6},{0,-1},{10,0},{10,6},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{-10,2},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,4},{0,-1},{-10,6},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},
+    {-10,2},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,3},
+    {0,-1},{-10,6},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,2},{10,2},{0,-1},{10,2},{0,-1},{-10,2},{0,-1},{-10,6},{0,-1},{0,6},{0,-1},{-10,1},
+    {0,-1},{0,-1},{-10,6},{-10,6},{0,6},{0,-1},{0,-1},{10,-1},{0,-1},{10,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{0,2},{0,-1},{-10,4},{0,-1},{-10,2},{0,-1},
+    {-10,0},{0,-1},{-10,4},{0,-1},{0,-1},{10,4},{-10,0},{-10,3},{0,-1},{0,-1},{-10,3},{0,-1},
+    {0,5},{10,5},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,4},{0,-1},{0,-1},{10,2},
+    {-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{10,4},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,4},
+    {-10,0},{-10,-1},{0,-1},{10,0},{0,-1},{10,4},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,2},{0,-1},
+    {-10,2},{0,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,4},
+    {0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,5},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,2},{0,-1},{-10,1},{0,-1},{0,-1},{-10,2},{-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{-10,-1},
+    {0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,5},{10,5},{0,-1},{10,5},{0,-1},{-10,5},
+    {0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{10,5},{0,-1},{-10,5},
+    {0,-1},{0,-1},{10,5},{-10,0},{-10,-1},{0,-1},{-10,1},{0,2},{0,-1},{-10,0},{0,-1},{-10,2},
+    {0,-1},{-10,2},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},
+    {0,-1},{0,5},{0,-1},{-10,7},{10,5},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{10,0},{0,-1},{10,-1},
+    {0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{-10,-1},{0,-1},{10,0},{0,-1},{10,-1},
+    {0,-1},{0,-1},{10,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,3},{0,-1},{-10,4},{0,-1},{0,-1},{10,4},
+    {-10,3},{0,3},{0,-1},{0,-1},{0,-1},{10,4},{0,-1},{0,-1},{0,-1},{10,4},{0,-1},{-10,4},
+    {-10,3},{0,3},{0,-1},{0,3},{0,-1},{-10,4},{0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{10,4},
+    {0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,4},{-10,0},{0,-1},{-10,4},{0,-1},{0,-1},{10,4},{-10,0},{-10,-1},{0,-1},
+    {0,0},{0,1},{0,-1},{0,2},{0,-1},{-10,4},{0,-1},{0,2},{0,-1},{0,4},{0,-1},{-10,4},
+    {0,-1},{0,-1},{10,4},{-10,4},{0,4},{0,-1},{0,-1},{0,1},{0,-1},{0,0},{0,4},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,3},{0,-1},{-10,1},
+    {0,-1},{0,-1},{-10,3},{-10,3},{0,3},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{10,-1},{0,2},{0,-1},{-10,1},
+    {0,-1},{0,-1},{-10,2},{-10,2},{0,2},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{0,0},{0,1},{0,-1},{0,7},{0,-1},{-10,7},{0,-1},{0,7},{0,-1},
+    {0,0},{0,3},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{-10,3},{0,-1},{10,0},{0,-1},{10,-1},
+    {0,-1},{0,-1},{10,-1},{10,0},{10,7},{0,-1},{0,-1},{-10,3},{0,-1},{0,0},{0,3},{0,-1},
+    {0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,-1},{10,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{-10,0},{-10,-1},{0,-1},
+    {10,0},{0,-1},{10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,1},{0,-1},{0,0},{0,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,0},{0,1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,7},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,7},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},
+    {-10,2},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,4},
+    {0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{10,0},{0,-1},{10,2},{0,-1},{-10,-1},{0,-1},{-10,0},{0,-1},{-10,4},
+    {0,-1},{0,-1},{10,4},{-10,0},{-10,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{10,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{10,2},{0,-1},{10,2},{0,-1},{-10,2},
+    {0,-1},{-10,2},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},
+    {0,-1},{10,-1},{0,-1},{10,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{-10,2},
+    {0,-1},{0,-1},{10,2},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{10,-1},{-10,-1},{0,-1},{10,-1},{0,-1},{10,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{-10,2},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{10,0},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,7},{10,7},{0,-1},{10,0},{0,-1},{10,4},{0,-1},{0,7},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,7},{0,-1},
+    {-10,7},{10,7},{0,-1},{0,-1},{0,-1},{0,-1},{0,7},{10,7},{0,-1},{10,7},{0,-1},{-10,7},
+    {0,-1},{0,7},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,7},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,5},{10,5},{0,-1},{10,7},{0,-1},{-10,5},{0,-1},{-10,5},{0,-1},{10,7},{0,-1},{-10,5},
+    {0,-1},{0,-1},{10,7},{-10,5},{10,7},{0,-1},{0,-1},{-10,5},{0,-1},{-10,5},{10,5},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,7},{0,-1},{10,0},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {10,0},{10,7},{0,-1},{10,0},{0,-1},{10,3},{0,-1},{0,7},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{10,3},{0,-1},{0,-1},{0,-1},{0,-1},{-10,4},{10,4},{0,-1},{10,4},{0,-1},{-10,4},
+    {0,-1},{-10,4},{0,-1},{10,4},{0,-1},{-10,4},{0,-1},{0,-1},{10,4},{-10,4},{10,7},{0,-1},
+    {0,-1},{-10,4},{0,-1},{-10,4},{10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,3},{10,7},{0,-1},{10,7},{0,-1},{-10,3},{0,-1},{-10,3},{0,-1},{10,3},{0,-1},{-10,3},
+    {0,-1},{0,-1},{10,3},{-10,3},{10,7},{0,-1},{0,-1},{-10,3},{0,-1},{-10,3},{10,7},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,7},{0,-1},{-10,7},{10,7},{0,-1},
+    {0,-1},{0,-1},{0,-1},{10,0},{10,7},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,7},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,7},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{10,1},{0,-1},{10,0},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{10,0},{10,7},{0,-1},
+    {10,0},{0,-1},{10,-1},{0,-1},{0,7},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{-10,7},{10,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,7},{10,7},{0,-1},{10,7},{0,-1},{-10,7},{0,-1},{0,7},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,0},{0,1},{0,-1},
+    {10,4},{0,-1},{-10,4},{0,-1},{0,2},{0,-1},{0,1},{0,-1},{-10,4},{0,-1},{0,-1},{10,4},
+    {0,0},{0,3},{0,-1},{0,-1},{0,5},{0,-1},{-10,4},{10,4},{0,-1},{0,-1},{0,-1},{0,-1},
+    {10,2},{0,-1},{-10,4},{0,-1},{0,-1},{10,4},{0,0},{0,6},{0,-1},{0,-1},{0,-1},{10,4},
+    {0,-1},{0,-1},{0,-1},{0,4},{0,-1},{-10,4},{10,0},{10,5},{0,-1},{10,4},{0,-1},{-10,4},
+    {0,-1},{-10,5},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,1},{0,1},{0,-1},{-10,0},{0,-1},{-10,4},{0,-1},{0,4},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,1},{0,-1},{-10,1},{0,-1},{0,-1},{-10,-1},
+    {0,0},{0,2},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{0,6},{0,-1},{-10,3},
+    {-10,1},{10,5},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,5},{0,-1},{0,-1},{0,-1},{-10,1},
+    {0,-1},{0,-1},{0,-1},{0,5},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,5},{10,5},{0,-1},{-10,1},{0,-1},{0,-1},{-10,-1},{-10,5},{10,5},{0,-1},
+    {-10,1},{0,1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,2},{0,-1},{-10,0},{0,-1},{-10,1},
+    {0,-1},{0,-1},{-10,-1},{-10,6},{0,6},{0,-1},{0,-1},{-10,1},{0,-1},{-10,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,2},{0,-1},{10,0},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,0},{0,1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,3},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{10,3},{0,-1},{0,-1},{0,-1},{0,-1},{0,0},{0,6},{0,-1},{10,0},{0,-1},{10,-1},
+    {0,-1},{-10,6},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,-1},{10,-1},{0,0},{0,6},{0,-1},
+    {0,-1},{-10,6},{0,-1},{10,0},{10,5},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,1},{0,-1},{-10,4},{0,-1},{0,-1},{10,4},{0,0},{0,3},{0,-1},{0,-1},{0,-1},{10,3},
+    {0,-1},{0,-1},{0,-1},{0,3},{0,-1},{-10,4},{-10,4},{0,3},{0,-1},{10,4},{0,-1},{-10,4},
+    {0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{10,4},{0,-1},{0,-1},{0,-1},{0,4},{0,-1},{-10,4},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,4},{10,4},{0,-1},{-10,4},
+    {0,-1},{0,-1},{10,4},{-10,0},{-10,4},{0,-1},{0,0},{0,1},{0,-1},{0,4},{0,-1},{-10,4},
+    {0,-1},{0,2},{0,-1},{10,0},{0,-1},{10,1},{0,-1},{0,-1},{10,4},{0,0},{0,4},{0,-1},
+    {0,-1},{0,1},{0,-1},{-10,4},{0,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},
+    {0,-1},{0,-1},{0,-1},{0,3},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{-10,3},{-10,0},{0,-1},{-10,1},{0,-1},{0,-1},{-10,-1},{-10,3},{0,3},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {-10,-1},{0,-1},{10,-1},{0,1},{0,-1},{-10,1},{0,-1},{0,-1},{-10,-1},{0,0},{0,2},{0,-1},
+    {0,-1},{0,-1},{10,6},{0,-1},{0,-1},{0,-1},{0,6},{0,-1},{-10,6},{-10,1},{0,1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{0,-1},{0,6},{0,-1},{0,0},{0,1},{0,-1},{10,0},{0,-1},{10,-1},
+    {0,-1},{0,2},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,-1},{10,-1},{0,0},{0,3},{0,-1},
+    {0,-1},{0,6},{0,-1},{10,0},{10,6},{0,-1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},
+    {0,-1},{0,-1},{10,-1},{0,0},{0,6},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},
+    {10,0},{0,-1},{10,-1},{10,0},{10,6},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{-10,6},{0,-1},
+    {0,-1},{0,1},{0,-1},{0,0},{0,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,0},{0,1},{0,-1},
+    {10,0},{0,-1},{10,-1},{0,-1},{0,6},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,6},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{-10,2},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,4},{0,-1},{-10,6},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{10,2},{0,-1},{10,2},{0,-1},{-10,4},
+    {0,-1},{-10,6},{0,-1},{-10,0},{0,-1},{-10,4},{0,-1},{0,-1},{10,4},{-10,6},{0,6},{0,-1},
+    {0,-1},{10,-1},{0,-1},{10,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,1},{10,2},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,2},{0,-1},{-10,0},{0,-1},{-10,1},
+    {0,-1},{0,-1},{-10,-1},{-10,6},{0,6},{0,-1},{0,-1},{10,-1},{0,-1},{-10,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{10,2},{0,-1},{-10,1},{0,-1},{0,-1},{-10,-1},{0,2},{10,2},{0,-1},
+    {0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{0,6},{0,-1},{-10,6},{10,-1},{10,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{0,-1},{10,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{-10,6},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{10,0},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},
+    {10,0},{0,-1},{10,-1},{0,-1},{-10,6},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{-10,4},{0,-1},{0,-1},{10,4},
+    {0,0},{0,3},{0,-1},{0,-1},{0,-1},{10,4},{0,-1},{0,-1},{0,-1},{0,4},{0,-1},{-10,4},
+    {10,0},{10,5},{0,-1},{10,4},{0,-1},{-10,4},{0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{10,1},
+    {0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,4},{10,0},{0,-1},{10,1},{0,-1},{0,-1},{10,4},{-10,0},{-10,-1},{0,-1},
+    {-10,4},{10,5},{0,-1},{10,4},{0,-1},{-10,4},{0,-1},{0,2},{0,-1},{10,4},{0,-1},{-10,4},
+    {0,-1},{0,-1},{10,4},{-10,4},{0,4},{0,-1},{0,-1},{0,5},{0,-1},{-10,4},{10,5},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{-10,2},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{10,1},{0,-1},{-10,1},
+    {0,-1},{0,-1},{-10,-1},{10,0},{10,5},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{-10,0},{0,-1},{-10,1},
+    {0,-1},{0,-1},{-10,-1},{-10,2},{0,2},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{-10,1},{10,5},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,5},{0,-1},
+    {0,0},{0,3},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{-10,3},{0,-1},{10,0},{0,-1},{10,-1},
+    {0,-1},{0,-1},{10,-1},{0,0},{0,3},{0,-1},{0,-1},{-10,3},{0,-1},{10,0},{10,5},{0,-1},
+    {0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,-1},{10,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{-10,0},{-10,-1},{0,-1},
+    {10,0},{0,-1},{10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,5},{0,-1},{10,0},{10,5},{0,-1},
+    {0,-1},{0,-1},{0,-1},{10,0},{10,5},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,5},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,5},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},
+    {0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,4},{10,0},{0,-1},{10,1},{0,-1},{0,-1},{10,4},{0,0},{0,3},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},
+    {10,0},{0,-1},{10,-1},{0,1},{0,-1},{-10,4},{0,-1},{0,-1},{10,4},{0,0},{0,2},{0,-1},
+    {0,-1},{0,-1},{10,4},{0,-1},{0,-1},{0,-1},{0,4},{0,-1},{-10,4},{0,0},{0,1},{0,-1},
+    {0,4},{0,-1},{-10,4},{0,-1},{0,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{10,1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},
+    {0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{0,2},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,1},{0,-1},{-10,1},{0,-1},{0,-1},{-10,-1},
+    {0,0},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,-1},{10,-1},{0,0},{0,3},{0,-1},
+    {0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,-1},{0,0},{0,3},{0,-1},
+    {10,0},{0,-1},{10,-1},{0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},
+    {10,0},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},
+    {10,0},{0,-1},{10,-1},{0,-1},{0,-1},{10,-1},{-10,0},{-10,-1},{0,-1},{0,0},{0,1},{0,-1},
+    {10,0},{0,-1},{10,-1},{0,-1},{0,2},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,-1},{10,-1},
+    {0,0},{0,-1},{0,-1},{0,-1},{0,1},{0,-1},{0,0},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {10,0},{10,2},{0,-1},{10,2},{0,-1},{-10,4},{0,-1},{-10,2},{0,-1},{10,4},{0,-1},{-10,4},
+    {0,-1},{0,-1},{10,4},{-10,0},{-10,3},{0,-1},{0,-1},{10,-1},{0,-1},{10,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{10,0},{0,-1},{10,1},{0,-1},{0,-1},{10,2},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{10,4},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,4},{10,-1},{-10,-1},{0,-1},
+    {10,-1},{0,-1},{10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{10,1},{0,-1},{-10,4},{10,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,4},{10,4},{0,-1},{10,4},{0,-1},{-10,4},{0,-1},{-10,4},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{-10,1},
+    {0,-1},{0,-1},{-10,-1},{-10,2},{10,2},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{10,-1},{10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{10,2},{0,-1},{0,-1},{0,-1},{10,2},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{10,-1},{0,-1},{10,-1},{0,-1},{0,-1},{-10,-1},
+    {10,-1},{-10,-1},{0,-1},{-10,1},{10,2},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{-10,2},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},{0,-1},{10,-1},{0,-1},
+    {-10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,3},{0,-1},{10,0},{10,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{10,0},{10,3},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{-10,3},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {10,0},{0,-1},{10,-1},{0,-1},{-10,-1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,-1},{10,-1},
+    {-10,0},{-10,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},
+    {10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,1},{0,1},{0,-1},{-10,0},{0,-1},{-10,4},{0,-1},{0,3},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,4},{0,-1},{0,-1},{0,-1},{0,-1},{-10,4},{10,2},{0,-1},{10,4},{0,-1},{-10,4},
+    {0,-1},{0,2},{0,-1},{0,1},{0,-1},{-10,4},{0,-1},{0,-1},{10,4},{0,0},{0,4},{0,-1},
+    {0,-1},{10,1},{0,-1},{-10,4},{10,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,1},{0,1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,2},{0,-1},{0,1},{0,-1},{-10,1},
+    {0,-1},{0,-1},{-10,-1},{0,0},{0,3},{0,-1},{0,-1},{-10,1},{0,-1},{-10,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,1},{0,-1},{0,-1},{-10,-1},{-10,5},{0,5},{0,-1},
+    {0,-1},{0,-1},{-10,1},{0,-1},{0,-1},{0,-1},{0,5},{0,-1},{-10,5},{-10,1},{10,5},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{0,-1},{-10,5},{0,-1},{0,-1},{-10,1},{0,-1},{-10,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,1},{0,1},{0,-1},{-10,-1},{0,-1},{10,-1},{0,-1},{0,5},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,2},{0,-1},{10,0},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,0},{0,1},{0,-1},
+    {10,0},{0,-1},{10,-1},{0,-1},{0,5},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,4},{0,1},{0,-1},{10,4},{0,-1},{-10,4},
+    {0,-1},{0,2},{0,-1},{10,0},{0,-1},{10,1},{0,-1},{0,-1},{10,3},{0,0},{0,3},{0,-1},
+    {0,-1},{-10,4},{0,-1},{-10,4},{10,4},{0,-1},{0,-1},{0,-1},{0,-1},{10,4},{0,-1},{-10,4},
+    {0,-1},{0,-1},{10,4},{-10,4},{0,4},{0,-1},{0,-1},{0,-1},{10,4},{0,-1},{0,-1},{0,-1},
+    {0,4},{0,-1},{-10,4},{-10,4},{10,4},{0,-1},{10,4},{0,-1},{-10,4},{0,-1},{-10,4},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,0},{0,1},{0,-1},
+    {10,0},{0,-1},{10,-1},{0,-1},{0,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,4},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,1},{0,-1},{0,-1},{-10,-1},{-10,3},{0,3},{0,-1},
+    {0,-1},{0,-1},{10,3},{0,-1},{0,-1},{0,-1},{0,3},{0,-1},{-10,3},{-10,0},{-10,1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},
+    {-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},{-10,1},{0,1},{0,-1},
+    {-10,-1},{0,-1},{10,-1},{0,-1},{0,2},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,-1},{10,-1},
+    {0,0},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,2},{0,-1},{10,0},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,0},{0,1},{0,-1},
+    {10,0},{0,-1},{10,-1},{0,-1},{0,3},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{10,0},{10,2},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,2},{0,-1},
+    {10,0},{0,-1},{10,-1},{0,-1},{0,-1},{10,-1},{0,0},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},
+    {10,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,2},{0,-1},{-10,2},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,1},{0,-1},
+    {-10,0},{0,-1},{-10,4},{0,-1},{0,4},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,1},{0,1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,3},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{10,2},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{0,-1},{0,2},{0,-1},{0,1},{0,-1},{-10,1},{0,-1},{0,-1},{-10,-1},
+    {0,0},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{-10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,6},{0,-1},{-10,6},{10,6},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,6},{10,6},{0,-1},{10,0},{0,-1},{10,4},{0,-1},{-10,6},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,6},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,6},{0,-1},
+    {0,6},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,6},{10,6},{0,-1},{10,6},{0,-1},{-10,6},
+    {0,-1},{-10,6},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,3},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,5},{10,6},{0,-1},{10,5},{0,-1},{-10,5},{0,-1},{-10,5},{0,-1},{10,6},{0,-1},{-10,5},
+    {0,-1},{0,-1},{10,6},{-10,5},{10,6},{0,-1},{0,-1},{-10,5},{0,-1},{-10,5},{10,5},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,6},{0,-1},{-10,6},{10,6},{0,-1},{0,-1},{0,-1},{0,-1},
+    {10,0},{10,1},{0,-1},{10,0},{0,-1},{10,3},{0,-1},{10,3},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,6},{0,-1},{0,-1},{0,-1},{0,-1},{-10,4},{10,6},{0,-1},{10,4},{0,-1},{-10,4},
+    {0,-1},{-10,4},{0,-1},{10,4},{0,-1},{-10,4},{0,-1},{0,-1},{10,4},{-10,4},{10,4},{0,-1},
+    {0,-1},{-10,4},{0,-1},{-10,4},{10,6},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,3},{10,6},{0,-1},{10,6},{0,-1},{-10,3},{0,-1},{-10,3},{0,-1},{10,6},{0,-1},{-10,3},
+    {0,-1},{0,-1},{10,6},{-10,3},{10,6},{0,-1},{0,-1},{-10,3},{0,-1},{-10,3},{10,6},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,6},{0,-1},{0,6},{10,6},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,6},{10,6},{0,-1},{10,6},{0,-1},{-10,6},{0,-1},{-10,6},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,6},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,6},{0,-1},{10,0},{10,6},{0,-1},{0,-1},{0,-1},{0,-1},{10,0},{10,1},{0,-1},
+    {10,0},{0,-1},{10,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,6},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,6},{0,-1},{10,0},{10,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,6},{10,6},{0,-1},{10,6},{0,-1},{-10,6},{0,-1},{-10,6},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,4},
+    {0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{-10,0},{0,-1},{-10,4},{0,-1},{-10,-1},{0,-1},{-10,0},{0,-1},{-10,4},
+    {0,-1},{0,-1},{10,4},{-10,0},{-10,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{0,2},{0,-1},{-10,2},
+    {0,-1},{-10,2},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},
+    {0,-1},{-10,3},{0,-1},{0,5},{10,5},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,1},
+    {0,-1},{0,-1},{-10,2},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{-10,0},{-10,-1},{0,-1},{10,5},{0,-1},{-10,5},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{-10,2},{0,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,5},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,4},{0,-1},{-10,3},{0,-1},{10,4},{0,-1},{-10,4},
+    {0,-1},{0,-1},{10,4},{-10,4},{10,4},{0,-1},{0,-1},{-10,3},{0,-1},{-10,3},{0,3},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,4},{0,-1},{0,-1},{10,4},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{10,4},{0,-1},{0,-1},{0,-1},{10,4},{0,-1},{-10,4},{-10,0},{-10,-1},{0,-1},
+    {-10,0},{0,-1},{-10,4},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,2},{0,-1},{-10,2},{0,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{-10,1},{0,-1},{-10,0},{0,-1},{-10,4},{0,-1},{-10,4},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,4},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{0,-1},{-10,1},
+    {0,-1},{0,-1},{-10,2},{-10,0},{-10,2},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{-10,3},{0,3},{0,-1},{0,3},{0,-1},{-10,3},{0,-1},{-10,3},{0,-1},
+    {0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},
+    {-10,-1},{-10,-1},{0,-1},{-10,2},{0,2},{0,-1},{0,2},{0,-1},{-10,2},{0,-1},{-10,2},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},{0,-1},{0,1},{0,-1},
+    {0,0},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},{-10,0},{-10,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{10,0},{10,1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,3},{0,-1},{0,-1},{0,-1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {10,0},{0,-1},{10,-1},{0,-1},{-10,-1},{0,-1},{10,0},{0,-1},{10,-1},{0,-1},{0,-1},{10,-1},
+    {10,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,1},{0,-1},{-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,0},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{-10,0},{0,-1},{-10,4},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{-10,2},{0,-1},{-10,2},{10,2},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{-10,0},{-10,-1},{0,-1},{10,2},{0,-1},{-10,2},{0,-1},{-10,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,2},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {-10,0},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{10,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{10,-1},{0,-1},{10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{10,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{10,-1},{10,-1},{0,-1},{10,-1},{0,-1},{10,-1},{0,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{10,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{10,-1},{0,-1},{10,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{10,-1},{0,-1},
+    {10,-1},{0,-1},{10,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{10,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{10,-1},{10,-1},{0,-1},{10,-1},{0,-1},{10,-1},{0,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{-10,-1},{0,-1},
+    {-10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},
+    {-10,-1},{-10,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{-10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},
+    {10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{-10,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{10,-1},{0,-1},
+    {10,-1},{-10,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},{0,-1},
+    {0,-1},{0,-1},{0,-1}
+}};
+
+#endif